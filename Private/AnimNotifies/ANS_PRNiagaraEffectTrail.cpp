@@ -2,9 +2,11 @@
 
 
 #include "AnimNotifies/ANS_PRNiagaraEffectTrail.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
 #include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
 
 UANS_PRNiagaraEffectTrail::UANS_PRNiagaraEffectTrail(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -12,31 +14,161 @@ UANS_PRNiagaraEffectTrail::UANS_PRNiagaraEffectTrail(const FObjectInitializer& O
 	SocketName = TEXT("root");
 	StartSocket = NAME_None;
 	EndSocket =	NAME_None;
+	StartSocketVariableName = TEXT("StartSocket");
+	EndSocketVariableName = TEXT("EndSocket");
+	TrailParameters = FPRNiagaraParameterBlock();
+
+	// Trail은 프레임마다 샘플을 갱신하므로 다른 이펙트보다 높은 Significance에서만 Spawn합니다.
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.4f, 0.0f, 1);
+
+	// SubFrameSampling
+	StartSamplesVariableName = TEXT("StartSocketSamples");
+	EndSamplesVariableName = TEXT("EndSocketSamples");
+	SubFrameSampleRate = 120.0f;
+	MaxSamplesPerTick = 8;
+	SampleBufferCapacity = 32;
+	TrailSampleBuffers.Empty();
+	SubmitStartLocations.Empty();
+	SubmitEndLocations.Empty();
+}
+
+void UANS_PRNiagaraEffectTrail::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	// NotifyTick은 바로 실행하므로 NotifyBegin을 큐에 저장하면 첫 Tick에 Trail이 없습니다. Significance만 확인하고 바로 Spawn합니다.
+	if(UPRAnimNotifyDispatchSubsystem::PassesAnimNotifySignificance(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Effect, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin, MeshComp, EventReference))
+	{
+		BeginTimedEffect(MeshComp, Animation, TotalDuration, EventReference);
+	}
+
+	// 이전 Trail의 샘플이 이어지지 않도록 링 버퍼를 초기화합니다.
+	if(MeshComp)
+	{
+		TrailSampleBuffers.FindOrAdd(MeshComp, EventReference).Reset(SampleBufferCapacity);
+	}
 }
 
 void UANS_PRNiagaraEffectTrail::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
 	if(MeshComp)
 	{
+		UNiagaraComponent* TrailComponent = nullptr;
+		APRNiagaraEffect* NiagaraEffect = GetSpawnedNiagaraEffect(MeshComp, EventReference);
 		if(IsValid(NiagaraEffect))
 		{
-			NiagaraEffect->GetNiagaraEffect()->SetVectorParameter(TEXT("StartSocket"), MeshComp->GetSocketLocation(StartSocket));
-			NiagaraEffect->GetNiagaraEffect()->SetVectorParameter(TEXT("EndSocket"), MeshComp->GetSocketLocation(EndSocket));
+			TrailComponent = NiagaraEffect->GetNiagaraEffect();
+		}
+		else if(!GetOwnerEffectSystem(MeshComp))
+		{
+			// EffectSystem이 없어 엔진의 방식으로 Spawn한 경우만 엔진의 Component를 사용합니다.
+			// EffectSystem이 Significance나 Spawn 예산에 의해 Spawn하지 않은 경우는 Trail을 갱신하지 않습니다.
+			TrailComponent = Cast<UNiagaraComponent>(GetSpawnedEffect(MeshComp));
 		}
-		else
+
+		// Significance에 의해 Trail을 Spawn하지 않았을 경우 Socket의 위치를 샘플링하지 않습니다.
+		if(IsValid(TrailComponent))
 		{
-#if WITH_EDITOR
-			PR_LOG_SCREEN_INFO(0, "%s NiagaraEffect does not exist in the EffectSystem", *Template.GetName());
-#endif
-			
-			UFXSystemComponent* FXComponent = GetSpawnedEffect(MeshComp);
-			if(IsValid(FXComponent))
+			const FVector StartLocation = MeshComp->GetSocketLocation(StartSocket);
+			const FVector EndLocation = MeshComp->GetSocketLocation(EndSocket);
+			TrailParameters.SetVectorParameter(StartSocketVariableName, StartLocation);
+			TrailParameters.SetVectorParameter(EndSocketVariableName, EndLocation);
+
+			// 프레임 사이의 Socket 위치를 일정한 시간 간격으로 링 버퍼에 추가합니다.
+			FPRTrailSampleRingBuffer& SampleBuffer = TrailSampleBuffers.FindOrAdd(MeshComp, EventReference);
+			if(SampleBuffer.StartLocations.Num() != SampleBufferCapacity)
 			{
-				FXComponent->SetVectorParameter(TEXT("StartSocket"), MeshComp->GetSocketLocation(StartSocket));
-				FXComponent->SetVectorParameter(TEXT("EndSocket"), MeshComp->GetSocketLocation(EndSocket));
+				SampleBuffer.Reset(SampleBufferCapacity);
 			}
+			AddSubFrameSamples(SampleBuffer, StartLocation, EndLocation, FrameDeltaTime);
+
+			TrailParameters.ApplyToComponent(TrailComponent);
+			SubmitTrailSamples(TrailComponent, SampleBuffer);
 		}
 	}
-	
+
 	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 }
+
+void UANS_PRNiagaraEffectTrail::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	// 링 버퍼의 배열은 다음 Trail에서 재사용합니다. 제거된 SkeletalMeshComponent의 링 버퍼는 저장소에서 정리합니다.
+	TrailSampleBuffers.Remove(MeshComp, EventReference);
+
+	// NotifyBegin을 바로 실행하므로 같은 이벤트가 다시 시작된 후에 이전 NotifyEnd가 실행되지 않도록 바로 실행합니다.
+	EndTimedEffect(MeshComp, Animation, EventReference);
+}
+
+void UANS_PRNiagaraEffectTrail::AddSubFrameSamples(FPRTrailSampleRingBuffer& SampleBuffer, const FVector& StartLocation, const FVector& EndLocation, float FrameDeltaTime) const
+{
+	const float SampleInterval = 1.0f / FMath::Max(SubFrameSampleRate, 1.0f);
+
+	// 첫 프레임은 현재 위치만 추가합니다.
+	if(SampleBuffer.KeyCount == 0)
+	{
+		SampleBuffer.AddKey(StartLocation, EndLocation, SampleBuffer.ElapsedTime);
+		SampleBuffer.AddSample(StartLocation, EndLocation);
+		SampleBuffer.NextSampleTime = SampleBuffer.ElapsedTime + SampleInterval;
+		return;
+	}
+
+	// 시간이 지나지 않은 프레임은 보간할 구간이 없습니다.
+	if(FrameDeltaTime <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	SampleBuffer.ElapsedTime += FrameDeltaTime;
+	const float CurrentTime = SampleBuffer.ElapsedTime;
+
+	// 이전 프레임(P1)부터 현재 프레임(P2)까지의 구간을 보간합니다.
+	// P0는 그 이전 프레임의 위치이며, 없을 경우 P1에서 반대 방향으로 외삽합니다. P3는 현재 속도로 다음 프레임의 위치를 외삽합니다.
+	const int32 LastKeyIndex = SampleBuffer.KeyCount - 1;
+	const float T1 = SampleBuffer.KeyTimes[LastKeyIndex];
+	const float T2 = CurrentTime;
+	const float T0 = SampleBuffer.KeyCount > 1 ? SampleBuffer.KeyTimes[0] : T1 - FrameDeltaTime;
+	const float T3 = T2 + FrameDeltaTime;
+
+	const FVector& Start1 = SampleBuffer.KeyStartLocations[LastKeyIndex];
+	const FVector& End1 = SampleBuffer.KeyEndLocations[LastKeyIndex];
+	const FVector Start0 = SampleBuffer.KeyCount > 1 ? SampleBuffer.KeyStartLocations[0] : Start1 * 2.0f - StartLocation;
+	const FVector End0 = SampleBuffer.KeyCount > 1 ? SampleBuffer.KeyEndLocations[0] : End1 * 2.0f - EndLocation;
+	const FVector Start3 = StartLocation * 2.0f - Start1;
+	const FVector End3 = EndLocation * 2.0f - End1;
+
+	// 프레임이 크게 늦어졌을 경우 최근 MaxSamplesPerTick개의 샘플만 계산합니다.
+	const float EarliestSampleTime = CurrentTime - SampleInterval * (MaxSamplesPerTick - 1);
+	SampleBuffer.NextSampleTime = FMath::Max(SampleBuffer.NextSampleTime, FMath::Max(EarliestSampleTime, T1 + KINDA_SMALL_NUMBER));
+
+	while(SampleBuffer.NextSampleTime <= CurrentTime)
+	{
+		const float SampleTime = SampleBuffer.NextSampleTime;
+		SampleBuffer.AddSample(FMath::CubicCRSplineInterp(Start0, Start1, StartLocation, Start3, T0, T1, T2, T3, SampleTime),
+								FMath::CubicCRSplineInterp(End0, End1, EndLocation, End3, T0, T1, T2, T3, SampleTime));
+		SampleBuffer.NextSampleTime += SampleInterval;
+	}
+
+	SampleBuffer.AddKey(StartLocation, EndLocation, CurrentTime);
+}
+
+void UANS_PRNiagaraEffectTrail::SubmitTrailSamples(UNiagaraComponent* NiagaraComponent, const FPRTrailSampleRingBuffer& SampleBuffer)
+{
+	if(!IsValid(NiagaraComponent) || SampleBuffer.SampleCount == 0)
+	{
+		return;
+	}
+
+	// 링 버퍼의 샘플을 오래된 순서대로 정렬합니다.
+	const int32 Capacity = SampleBuffer.StartLocations.Num();
+	const int32 OldestIndex = (SampleBuffer.NextIndex - SampleBuffer.SampleCount + Capacity) % Capacity;
+	SubmitStartLocations.Reset(SampleBuffer.SampleCount);
+	SubmitEndLocations.Reset(SampleBuffer.SampleCount);
+	for(int32 Count = 0; Count < SampleBuffer.SampleCount; Count++)
+	{
+		const int32 SampleIndex = (OldestIndex + Count) % Capacity;
+		SubmitStartLocations.Emplace(SampleBuffer.StartLocations[SampleIndex]);
+		SubmitEndLocations.Emplace(SampleBuffer.EndLocations[SampleIndex]);
+	}
+
+	// 프레임마다 샘플마다 파라미터를 설정하지 않고 배열로 한 번에 전달합니다.
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(NiagaraComponent, StartSamplesVariableName, SubmitStartLocations);
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(NiagaraComponent, EndSamplesVariableName, SubmitEndLocations);
+}
@@ -2,6 +2,7 @@
 
 
 #include "AnimNotifies/ANS_PRSetActorRotation.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 
 UANS_PRSetActorRotation::UANS_PRSetActorRotation(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -14,14 +15,33 @@ void UANS_PRSetActorRotation::NotifyBegin(USkeletalMeshComponent* MeshComp, UAni
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	SetCurrentRotation(MeshComp);
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Rotation, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin, MeshComp, Animation, EventReference, TotalDuration))
+	{
+		SetCurrentRotation(MeshComp);
+	}
 }
 
 void UANS_PRSetActorRotation::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation,	const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyEnd(MeshComp, Animation, EventReference);
 	
-	SetOwnerRotation(MeshComp);
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Rotation, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd, MeshComp, Animation, EventReference))
+	{
+		SetOwnerRotation(MeshComp);
+	}
+}
+
+void UANS_PRSetActorRotation::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	// NotifyBegin과 NotifyEnd는 같은 타입의 명령이므로 실행 순서가 유지됩니다.
+	if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin)
+	{
+		SetCurrentRotation(Command.MeshComp.Get());
+	}
+	else if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd)
+	{
+		SetOwnerRotation(Command.MeshComp.Get());
+	}
 }
 
 void UANS_PRSetActorRotation::SetCurrentRotation(USkeletalMeshComponent* MeshComp)
@@ -2,41 +2,87 @@
 
 
 #include "AnimNotifies/ANS_PRTimedParticleEffect.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
+#include "Effects/PRParticleEffect.h"
 
 UANS_PRTimedParticleEffect::UANS_PRTimedParticleEffect(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	ParticleEffect = nullptr;
+	EffectInstances.Empty();
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.25f, 0.0f, 1);
 }
 
 void UANS_PRTimedParticleEffect::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	ParticleEffect = SpawnParticleEffect(MeshComp);
-	if(IsValid(ParticleEffect))
+	// 이펙트의 Spawn은 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 이펙트와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Effect, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin, MeshComp, Animation, EventReference, TotalDuration))
 	{
-		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		BeginTimedEffect(MeshComp, Animation, TotalDuration, EventReference);
 	}
-	else
+}
+
+void UANS_PRTimedParticleEffect::NotifyEnd(class USkeletalMeshComponent* MeshComp, class UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Effect, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd, MeshComp, Animation, EventReference))
 	{
-		Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		EndTimedEffect(MeshComp, Animation, EventReference);
 	}
 }
 
-void UANS_PRTimedParticleEffect::NotifyEnd(class USkeletalMeshComponent* MeshComp, class UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+void UANS_PRTimedParticleEffect::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
 {
+	// NotifyBegin과 NotifyEnd는 같은 타입의 명령이므로 실행 순서가 유지됩니다.
+	if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin)
+	{
+		BeginTimedEffect(Command.MeshComp.Get(), Command.Animation.Get(), Command.TotalDuration, Command.EventReference);
+	}
+	else if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd)
+	{
+		EndTimedEffect(Command.MeshComp.Get(), Command.Animation.Get(), Command.EventReference);
+	}
+}
+
+void UANS_PRTimedParticleEffect::BeginTimedEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	APRParticleEffect* ParticleEffect = SpawnParticleEffect(MeshComp);
 	if(IsValid(ParticleEffect))
 	{
-		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner))
+		// 같은 몽타주를 재생하는 다른 캐릭터가 덮어쓰지 않도록 인스턴스별로 저장합니다.
+		FPRTimedEffectInstance& EffectInstance = EffectInstances.FindOrAdd(MeshComp, EventReference);
+		EffectInstance.EffectRef.Reset(ParticleEffect);
+		UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+	}
+	else
+	{
+		EffectInstances.Remove(MeshComp, EventReference);
+
+		// EffectSystem이 Significance, Spawn 예산, Pool의 최대 크기에 의해 Spawn하지 않은 경우에도 일반적인 방법으로 Spawn하지 않습니다.
+		// EffectSystem이 없을 경우만 일반적인 방법으로 Spawn합니다.
+		if(GetOwnerEffectSystem(MeshComp))
 		{
-			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
-			if(EffectSystem)
-			{
-				EffectSystem->DeactivateObject(ParticleEffect);
-			}
+			UAnimNotifyState::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 		}
+		else
+		{
+			Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+		}
+	}
+}
+
+void UANS_PRTimedParticleEffect::EndTimedEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	FPRTimedEffectInstance* EffectInstance = EffectInstances.Find(MeshComp, EventReference);
+	if(EffectInstance)
+	{
+		// 실행이 끝나 이미 Pool에 반환되었거나 다시 Spawn된 이펙트는 비활성화하지 않습니다.
+		EffectInstance->EffectRef.Release();
+		EffectInstances.Remove(MeshComp, EventReference);
+	}
+	else if(GetOwnerEffectSystem(MeshComp))
+	{
+		UAnimNotifyState::NotifyEnd(MeshComp, Animation, EventReference);
 	}
 	else
 	{
@@ -44,6 +90,24 @@ void UANS_PRTimedParticleEffect::NotifyEnd(class USkeletalMeshComponent* MeshCom
 	}
 }
 
+const FPRAnimNotifySignificanceSettings& UANS_PRTimedParticleEffect::GetAnimNotifySignificanceSettings() const
+{
+	return SignificanceSettings;
+}
+
+APRParticleEffect* UANS_PRTimedParticleEffect::GetSpawnedParticleEffect(const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+{
+	const FPRTimedEffectInstance* EffectInstance = EffectInstances.Find(MeshComp, EventReference);
+	return EffectInstance ? Cast<APRParticleEffect>(EffectInstance->EffectRef.Get()) : nullptr;
+}
+
+UPREffectSystemComponent* UANS_PRTimedParticleEffect::GetOwnerEffectSystem(const USkeletalMeshComponent* MeshComp) const
+{
+	const APRBaseCharacter* PROwner = MeshComp ? Cast<APRBaseCharacter>(MeshComp->GetOwner()) : nullptr;
+	
+	return IsValid(PROwner) ? PROwner->GetEffectSystem() : nullptr;
+}
+
 APRParticleEffect* UANS_PRTimedParticleEffect::SpawnParticleEffect(USkeletalMeshComponent* MeshComp)
 {
 	if (ValidateParameters(MeshComp))
@@ -2,12 +2,44 @@
 
 
 #include "AnimNotifies/ANS_PRVault.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRPlayerCharacter.h"
 
 void UANS_PRVault::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration,	const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Vault, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin, MeshComp, Animation, EventReference, TotalDuration))
+	{
+		SetOwnerVaultState(MeshComp);
+	}
+}
+
+void UANS_PRVault::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+	
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Vault, EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd, MeshComp, Animation, EventReference))
+	{
+		ResetOwnerVaultState(MeshComp);
+	}
+}
+
+void UANS_PRVault::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	// NotifyBegin과 NotifyEnd는 같은 타입의 명령이므로 실행 순서가 유지됩니다.
+	if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyBegin)
+	{
+		SetOwnerVaultState(Command.MeshComp.Get());
+	}
+	else if(Command.Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd)
+	{
+		ResetOwnerVaultState(Command.MeshComp.Get());
+	}
+}
+
+void UANS_PRVault::SetOwnerVaultState(USkeletalMeshComponent* MeshComp)
+{
 	if(MeshComp)
 	{
 		APRPlayerCharacter* PRPlayer = Cast<APRPlayerCharacter>(MeshComp->GetOwner());
@@ -18,10 +50,8 @@ void UANS_PRVault::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBa
 	}
 }
 
-void UANS_PRVault::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+void UANS_PRVault::ResetOwnerVaultState(USkeletalMeshComponent* MeshComp)
 {
-	Super::NotifyEnd(MeshComp, Animation, EventReference);
-	
 	if(MeshComp)
 	{
 		APRPlayerCharacter* PRPlayer = Cast<APRPlayerCharacter>(MeshComp->GetOwner());
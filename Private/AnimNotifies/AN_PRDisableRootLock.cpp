@@ -2,13 +2,23 @@
 
 
 #include "AnimNotifies/AN_PRDisableRootLock.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "AnimInstances/PRBaseAnimInstance.h"
 
 void UAN_PRDisableRootLock::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 	
-	DisableRootLock(MeshComp);
+	// 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 노티파이와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_RootLock, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		DisableRootLock(MeshComp);
+	}
+}
+
+void UAN_PRDisableRootLock::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	DisableRootLock(Command.MeshComp.Get());
 }
 
 void UAN_PRDisableRootLock::DisableRootLock(USkeletalMeshComponent* MeshComp)
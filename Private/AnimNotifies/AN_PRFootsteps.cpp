@@ -2,9 +2,9 @@
 
 
 #include "AnimNotifies/AN_PRFootsteps.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
-#include "Components/AudioComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PRFootstepSubsystem.h"
 
 UAN_PRFootsteps::UAN_PRFootsteps(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -13,55 +13,69 @@ UAN_PRFootsteps::UAN_PRFootsteps(const FObjectInitializer& ObjectInitializer)
 	bDebug = false;
 	
 	TraceDistance = 150.0f;
+	bSkipTraceWhenNotRendered = true;
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.1f, 0.5f, 3);
+
+	// Effect
+	EffectLocationOffset = FVector::ZeroVector;
+	EffectRotationOffset = FRotator::ZeroRotator;
+	EffectScaleOffset = FVector::OneVector;
+	BoneName = NAME_None;
+	FootprintDecalMaterial = nullptr;
+	FootprintDecalSize = FVector(10.0f, 15.0f, 8.0f);
 }
 
 void UAN_PRFootsteps::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 
-	PlayFootsteps(MeshComp);
-	ActivateFootstepsEffect(MeshComp);
+	// 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 노티파이와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Footstep, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		PlayFootsteps(MeshComp);
+	}
+}
+
+void UAN_PRFootsteps::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	PlayFootsteps(Command.MeshComp.Get());
+}
+
+const FPRAnimNotifySignificanceSettings& UAN_PRFootsteps::GetAnimNotifySignificanceSettings() const
+{
+	return SignificanceSettings;
 }
 
 void UAN_PRFootsteps::PlayFootsteps(USkeletalMeshComponent* MeshComp)
 {
-	if(MeshComp)
+	if(!MeshComp || !MeshComp->GetWorld())
 	{
-		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner) && PROwner->GetFootstepsSound())
-		{
-			FHitResult HitResult;
-			const FVector TraceStart = MeshComp->GetOwner()->GetActorLocation();
-			const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, TraceDistance);
-			TArray<AActor*> ActorsToIgnore;
-			ActorsToIgnore.Add(MeshComp->GetOwner());
+		return;
+	}
 
-			// 디버그 옵션을 설정합니다.
-			EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-			if(bDebug)
-			{
-				DebugType = EDrawDebugTrace::ForDuration;
-			}
+	APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
+	UPRFootstepSubsystem* FootstepSubsystem = MeshComp->GetWorld()->GetSubsystem<UPRFootstepSubsystem>();
+	if(!IsValid(PROwner) || !FootstepSubsystem)
+	{
+		return;
+	}
 
-			bool bIsHit = UKismetSystemLibrary::LineTraceSingle(MeshComp->GetWorld(), TraceStart, TraceEnd, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																true, ActorsToIgnore, DebugType, HitResult, true);
-			if(bIsHit)
-			{
-				UAudioComponent* FootstepsAudioComp = UGameplayStatics::SpawnSoundAtLocation(MeshComp->GetWorld(), PROwner->GetFootstepsSound(), HitResult.Location);
-				if(IsValid(FootstepsAudioComp))
-				{
-					FootstepsAudioComp->Play();
-					// FootstepsAudioComp->SetIntParameter(TEXT("Gender"), static_cast<int32>(PROwner->GetGender()));
-					FootstepsAudioComp->SetIntParameter(TEXT("SurfaceType"), static_cast<int32>(UGameplayStatics::GetSurfaceType(HitResult)));
-					// FootstepAudioComp->SetFloatParameter(TEXT("VolumeMultiplier"), VolumeMultiplier);
-					// FootstepAudioComp->SetFloatParameter(TEXT("PitchMultiplier"), PitchMultiplier);
-					// FootstepAudioComp->SetBoolParameter(TEXT("PlayFootstep"), bPlayFootstep);
-				}
-			}
-		}
+	// 발소리와 발자국 데칼이 없을 경우 바닥을 탐색하지 않습니다.
+	if(!PROwner->GetFootstepsSound() && !FootprintDecalMaterial)
+	{
+		return;
 	}
-}
 
-void UAN_PRFootsteps::ActivateFootstepsEffect(USkeletalMeshComponent* MeshComp)
-{
+	// 본의 위치에서 아래로 바닥을 탐색합니다. 본이 지정되지 않았을 경우 액터의 위치를 사용합니다.
+	FPRFootstepRequest FootstepRequest;
+	FootstepRequest.MeshComp = MeshComp;
+	FootstepRequest.Sound = PROwner->GetFootstepsSound();
+	FootstepRequest.FootprintDecalMaterial = FootprintDecalMaterial;
+	FootstepRequest.TraceStart = (BoneName.IsNone() ? PROwner->GetActorLocation() : MeshComp->GetSocketLocation(BoneName)) + EffectLocationOffset;
+	FootstepRequest.TraceEnd = FootstepRequest.TraceStart - FVector(0.0f, 0.0f, TraceDistance);
+	FootstepRequest.FootprintDecalSize = FootprintDecalSize * EffectScaleOffset;
+	FootstepRequest.FootprintDecalRotationOffset = EffectRotationOffset;
+	FootstepRequest.bDebug = bDebug;
+
+	FootstepSubsystem->RequestFootstep(FootstepRequest, bSkipTraceWhenNotRendered);
 }
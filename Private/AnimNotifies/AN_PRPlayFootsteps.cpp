@@ -2,9 +2,9 @@
 
 
 #include "AnimNotifies/AN_PRPlayFootsteps.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
-#include "Components/AudioComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "Subsystems/PRFootstepSubsystem.h"
 
 UAN_PRPlayFootsteps::UAN_PRPlayFootsteps(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -13,51 +13,51 @@ UAN_PRPlayFootsteps::UAN_PRPlayFootsteps(const FObjectInitializer& ObjectInitial
 	bDebug = false;
 	
 	TraceDistance = 150.0f;
+	bSkipTraceWhenNotRendered = true;
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.1f, 0.5f, 3);
+	bUseSurfaceCache = true;
 }
 
 void UAN_PRPlayFootsteps::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 
-	PlayFootsteps(MeshComp);
+	// 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 노티파이와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Footstep, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		PlayFootsteps(MeshComp);
+	}
+}
+
+void UAN_PRPlayFootsteps::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	PlayFootsteps(Command.MeshComp.Get());
+}
+
+const FPRAnimNotifySignificanceSettings& UAN_PRPlayFootsteps::GetAnimNotifySignificanceSettings() const
+{
+	return SignificanceSettings;
 }
 
 void UAN_PRPlayFootsteps::PlayFootsteps(USkeletalMeshComponent* MeshComp)
 {
-	if(MeshComp)
+	if(MeshComp && MeshComp->GetWorld())
 	{
 		APRBaseCharacter* PROwner = Cast<APRBaseCharacter>(MeshComp->GetOwner());
-		if(IsValid(PROwner) && PROwner->GetFootstepsSound())
+		UPRFootstepSubsystem* FootstepSubsystem = MeshComp->GetWorld()->GetSubsystem<UPRFootstepSubsystem>();
+		if(IsValid(PROwner) && PROwner->GetFootstepsSound() && FootstepSubsystem)
 		{
-			FHitResult HitResult;
-			const FVector TraceStart = MeshComp->GetOwner()->GetActorLocation();
-			const FVector TraceEnd = TraceStart - FVector(0.0f, 0.0f, TraceDistance);
-			TArray<AActor*> ActorsToIgnore;
-			ActorsToIgnore.Add(MeshComp->GetOwner());
-
-			EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-			if(bDebug)
-			{
-				DebugType = EDrawDebugTrace::ForDuration;
-			}
-
-			bool bIsHit = UKismetSystemLibrary::LineTraceSingle(MeshComp->GetWorld(), TraceStart, TraceEnd, UEngineTypes::ConvertToTraceType(ECC_Visibility),
-																true, ActorsToIgnore, DebugType, HitResult, true);
-			if(bIsHit)
-			{
-				UAudioComponent* FootstepsAudioComp = UGameplayStatics::SpawnSoundAtLocation(MeshComp->GetWorld(), PROwner->GetFootstepsSound(), HitResult.Location);
-				if(IsValid(FootstepsAudioComp))
-				{
-					FootstepsAudioComp->Play();
-					FootstepsAudioComp->SetIntParameter(TEXT("Gender"), static_cast<int32>(PROwner->GetGender()));
-					FootstepsAudioComp->SetIntParameter(TEXT("SurfaceType"), static_cast<int32>(UGameplayStatics::GetSurfaceType(HitResult)));
-					// FootstepAudioComp->SetFloatParameter(TEXT("VolumeMultiplier"), VolumeMultiplier);
-					// FootstepAudioComp->SetFloatParameter(TEXT("PitchMultiplier"), PitchMultiplier);
-					// FootstepAudioComp->SetBoolParameter(TEXT("PlayFootstep"), bPlayFootstep);
-				}
-			}
+			// 바닥의 탐색과 발소리의 재생은 FootstepSubsystem에서 비동기 Trace가 완료된 후에 실행합니다.
+			FPRFootstepRequest FootstepRequest;
+			FootstepRequest.MeshComp = MeshComp;
+			FootstepRequest.Sound = PROwner->GetFootstepsSound();
+			FootstepRequest.TraceStart = PROwner->GetActorLocation();
+			FootstepRequest.TraceEnd = FootstepRequest.TraceStart - FVector(0.0f, 0.0f, TraceDistance);
+			FootstepRequest.Gender = static_cast<int32>(PROwner->GetGender());
+			FootstepRequest.bUseSurfaceCache = bUseSurfaceCache;
+			FootstepRequest.bDebug = bDebug;
+
+			FootstepSubsystem->RequestFootstep(FootstepRequest, bSkipTraceWhenNotRendered);
 		}
 	}
 }
-
-
@@ -2,11 +2,36 @@
 
 
 #include "AnimNotifies/AN_PRPlayNiagaraEffect.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
-#include "Effects/PRNiagaraEffect.h"
+
+UAN_PRPlayNiagaraEffect::UAN_PRPlayNiagaraEffect(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.25f, 0.0f, 1);
+}
+
+void UAN_PRPlayNiagaraEffect::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	// 이펙트의 Spawn은 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 이펙트와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Effect, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		Super::Notify(MeshComp, Animation, EventReference);
+	}
+}
+
+void UAN_PRPlayNiagaraEffect::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	Super::Notify(Command.MeshComp.Get(), Command.Animation.Get(), Command.EventReference);
+}
+
+const FPRAnimNotifySignificanceSettings& UAN_PRPlayNiagaraEffect::GetAnimNotifySignificanceSettings() const
+{
+	return SignificanceSettings;
+}
 
 UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
@@ -28,34 +53,30 @@ UFXSystemComponent* UAN_PRPlayNiagaraEffect::SpawnEffect(USkeletalMeshComponent*
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
 			if(EffectSystem)
 			{
-				APRNiagaraEffect* SpawnNiagaraEffect = nullptr;
 				// Attached가 true이면 특정 소켓에 연결된 위치에 Effect를 Spawn합니다.
 				if(Attached)
 				{
-					SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
+					ReturnComp = EffectSystem->SpawnNiagaraSystemAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
 				}
 				else
 				{
 					// 특정 위치에 Effect를 Spawn합니다.
 					const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
-					SpawnNiagaraEffect = EffectSystem->SpawnNiagaraEffectAtLocation(Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true);
+					ReturnComp = EffectSystem->SpawnNiagaraSystemAtLocation(Template, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * RotationOffsetQuat).Rotator(), Scale, true);
 				}
 
-				if(IsValid(SpawnNiagaraEffect))
+				if(ReturnComp)
 				{
-					ReturnComp = SpawnNiagaraEffect->GetFXSystemComponent();
-					if(ReturnComp)
-					{
-						ReturnComp->SetUsingAbsoluteScale(bAbsoluteScale);
-						ReturnComp->SetRelativeScale3D_Direct(Scale);
-
-						return ReturnComp;
-					}
+					ReturnComp->SetUsingAbsoluteScale(bAbsoluteScale);
+					ReturnComp->SetRelativeScale3D_Direct(Scale);
 				}
+
+				// EffectSystem이 Significance에 의해 Spawn하지 않거나 지연한 경우에도 일반적인 방법으로 Spawn하지 않습니다.
+				return ReturnComp;
 			}
 		}
 
-		// EffectSystem이 없거나 Effect가 존재하지 않을 경우 일반적인 방법으로 Effect를 Spawn합니다.
+		// EffectSystem이 없을 경우 일반적인 방법으로 Effect를 Spawn합니다.
 		if(Attached)
 		{
 			ReturnComp = UNiagaraFunctionLibrary::SpawnSystemAttached(Template, MeshComp, SocketName, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset, true);
@@ -2,12 +2,37 @@
 
 
 #include "AnimNotifies/AN_PRPlayParticleEffect.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
 #include "Particles/ParticleSystem.h"
-#include "Effects/PRParticleEffect.h"
 #include "Kismet/GameplayStatics.h"
 
+UAN_PRPlayParticleEffect::UAN_PRPlayParticleEffect(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SignificanceSettings = FPRAnimNotifySignificanceSettings(false, 0.25f, 0.0f, 1);
+}
+
+void UAN_PRPlayParticleEffect::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	// 이펙트의 Spawn은 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 이펙트와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Effect, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		Super::Notify(MeshComp, Animation, EventReference);
+	}
+}
+
+void UAN_PRPlayParticleEffect::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	Super::Notify(Command.MeshComp.Get(), Command.Animation.Get(), Command.EventReference);
+}
+
+const FPRAnimNotifySignificanceSettings& UAN_PRPlayParticleEffect::GetAnimNotifySignificanceSettings() const
+{
+	return SignificanceSettings;
+}
+
 UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation)
 {
 	UParticleSystemComponent* ReturnComp = nullptr;
@@ -28,31 +53,24 @@ UParticleSystemComponent* UAN_PRPlayParticleEffect::SpawnParticleSystem(USkeleta
 			UPREffectSystemComponent* EffectSystem = PROwner->GetEffectSystem();
 			if(EffectSystem)
 			{
-				APRParticleEffect* SpawnParticleEffect = nullptr;
 				// Attached가 true이면 특정 소켓에 연결된 위치에 Effect를 Spawn합니다.
 				if(Attached)
 				{
-					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
+					ReturnComp = EffectSystem->SpawnParticleSystemAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, Scale, true);
 				}
 				else
 				{
 					// 특정 위치에 Effect를 Spawn합니다.
 					const FTransform MeshTransform = MeshComp->GetSocketTransform(SocketName);
-					SpawnParticleEffect = EffectSystem->SpawnParticleEffectAtLocation(PSTemplate, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * FQuat(RotationOffset)).Rotator(), Scale, true);
+					ReturnComp = EffectSystem->SpawnParticleSystemAtLocation(PSTemplate, MeshTransform.TransformPosition(LocationOffset), (MeshTransform.GetRotation() * FQuat(RotationOffset)).Rotator(), Scale, true);
 				}
 
-				if(IsValid(SpawnParticleEffect))
-				{
-					ReturnComp = SpawnParticleEffect->GetParticleEffect();
-					if(ReturnComp)
-					{
-						return ReturnComp;
-					}
-				}
+				// EffectSystem이 Significance에 의해 Spawn하지 않거나 지연한 경우에도 일반적인 방법으로 Spawn하지 않습니다.
+				return ReturnComp;
 			}
 		}
 
-		// EffectSystem이 없거나 Effect가 존재하지 않을 경우 일반적인 방법으로 Effect를 Spawn합니다.
+		// EffectSystem이 없을 경우 일반적인 방법으로 Effect를 Spawn합니다.
 		if(Attached)
 		{
 			ReturnComp = UGameplayStatics::SpawnEmitterAttached(PSTemplate, MeshComp, SocketName, LocationOffset, RotationOffset, EAttachLocation::KeepRelativeOffset, true);
@@ -2,6 +2,7 @@
 
 
 #include "AnimNotifies/AN_PRSetActorRotation.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 
 UAN_PRSetActorRotation::UAN_PRSetActorRotation(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -13,7 +14,16 @@ void UAN_PRSetActorRotation::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 	
-	SetOwnerRotation(MeshComp);
+	// 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 노티파이와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_Rotation, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		SetOwnerRotation(MeshComp);
+	}
+}
+
+void UAN_PRSetActorRotation::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	SetOwnerRotation(Command.MeshComp.Get());
 }
 
 void UAN_PRSetActorRotation::SetOwnerRotation(USkeletalMeshComponent* MeshComp)
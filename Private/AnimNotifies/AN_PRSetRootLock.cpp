@@ -2,6 +2,7 @@
 
 
 #include "AnimNotifies/AN_PRSetRootLock.h"
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
 #include "AnimInstances/PRBaseAnimInstance.h"
 
 UAN_PRSetRootLock::UAN_PRSetRootLock(const FObjectInitializer& ObjectInitializer)
@@ -14,7 +15,16 @@ void UAN_PRSetRootLock::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBa
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 
-	SetRootLock(MeshComp);
+	// 애니메이션의 업데이트가 끝난 후 AnimNotifyDispatchSubsystem에서 다른 노티파이와 함께 실행합니다.
+	if(!UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(this, EPRAnimNotifyCommandType::AnimNotifyCommandType_RootLock, EPRAnimNotifyPhase::AnimNotifyPhase_Notify, MeshComp, Animation, EventReference))
+	{
+		SetRootLock(MeshComp);
+	}
+}
+
+void UAN_PRSetRootLock::ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command)
+{
+	SetRootLock(Command.MeshComp.Get());
 }
 
 FString UAN_PRSetRootLock::GetNotifyName_Implementation() const
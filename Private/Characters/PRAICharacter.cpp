@@ -16,6 +16,7 @@ APRAICharacter::APRAICharacter()
 
 	// Activate
 	bActivate = false;
+	ActivationCount = 0;
 }
 
 void APRAICharacter::BeginPlay()
@@ -38,6 +39,7 @@ bool APRAICharacter::IsActivate_Implementation() const
 void APRAICharacter::Activate_Implementation()
 {
 	bActivate = true;
+	ActivationCount++;
 	SetActorHiddenInGame(!bActivate);
 	SetActorTickEnabled(bActivate);
 }
@@ -54,6 +56,11 @@ int32 APRAICharacter::GetPoolIndex_Implementation() const
 	return INDEX_NONE;
 }
 
+int32 APRAICharacter::GetActivationCount_Implementation() const
+{
+	return ActivationCount;
+}
+
 float APRAICharacter::GetLifespan_Implementation() const
 {
 	return INDEX_NONE;
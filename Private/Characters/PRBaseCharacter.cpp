@@ -10,6 +10,9 @@
 #include "Components/PREffectSystemComponent.h"
 #include "Components/PRMovementSystemComponent.h"
 #include "Components/PRWeaponSystemComponent.h"
+#include "Subsystems/PRHitSparkSubsystem.h"
+#include "Subsystems/PRDecalSubsystem.h"
+#include "ProjectReplicaGameInstance.h"
 #include "MotionWarpingComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
@@ -54,6 +57,9 @@ APRBaseCharacter::APRBaseCharacter()
 
 	// DamageSystem
 	DamageSystem = CreateDefaultSubobject<UPRDamageSystemComponent>(TEXT("DamageSystem"));
+	HitSparkNiagaraEffect = nullptr;
+	HitMarkDecalMaterial = nullptr;
+	HitMarkDecalSize = FVector(8.0f, 16.0f, 16.0f);
 	
 	// StatSystem
 	StatSystem = CreateDefaultSubobject<UPRStatSystemComponent>(TEXT("StatSystem"));
@@ -197,14 +203,18 @@ void APRBaseCharacter::DoDamage()
 	ActorsToIgnore.Emplace(this);
 
 	// Debug 실행을 설정합니다.
-	EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-	if(bDamageSystemDebug)
-	{
-		DebugType = EDrawDebugTrace::ForDuration;
-	}
+	const EDrawDebugTrace::Type DebugType = PRDebugDraw::GetDrawDebugTrace(EPRDebugDrawCategory::DebugDrawCategory_Damage, bDamageSystemDebug);
 
 	TSet<AActor*> UniqueActors;
 
+	// 히트 스파크는 월드에 하나의 NiagaraComponent로 모아 렌더링합니다.
+	UPRHitSparkSubsystem* HitSparkSubsystem = HitSparkNiagaraEffect ? GetWorld()->GetSubsystem<UPRHitSparkSubsystem>() : nullptr;
+	const UProjectReplicaGameInstance* PRGameInstance = Cast<UProjectReplicaGameInstance>(GetGameInstance());
+	const FLinearColor HitSparkColor = PRGameInstance ? PRGameInstance->GetElementColor(DamageElementType) : FLinearColor::White;
+
+	// 히트 자국은 DecalSubsystem의 링 버퍼에 모아 배치합니다.
+	UPRDecalSubsystem* DecalSubsystem = HitMarkDecalMaterial ? GetWorld()->GetSubsystem<UPRDecalSubsystem>() : nullptr;
+
 	bIsHit = UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), TraceStart, TraceEnd, 20.0f, ObjectTypes, false, ActorsToIgnore, DebugType, HitResults, true);
 	if(bIsHit)
 	{
@@ -240,8 +250,20 @@ void APRBaseCharacter::DoDamage()
 				bool bWasDamaged = IPRDamageableInterface::Execute_TakeDamage(HitResult.GetActor(), DamageInfo);
 				if(bWasDamaged)
 				{
-					// GetEffectSystem()->SpawnNiagaraEffectAtLocation(HitEffect,HitResult.Location);
-					UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), HitNiagaraEffect, HitResult.Location);
+					if(HitSparkSubsystem)
+					{
+						HitSparkSubsystem->AddHitSpark(HitSparkNiagaraEffect, HitResult.ImpactPoint, HitResult.ImpactNormal, HitSparkColor);
+					}
+					else
+					{
+						// GetEffectSystem()->SpawnNiagaraEffectAtLocation(HitEffect,HitResult.Location);
+						UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), HitNiagaraEffect, HitResult.Location);
+					}
+
+					if(DecalSubsystem)
+					{
+						DecalSubsystem->AddDecalOnSurface(HitMarkDecalMaterial, HitResult.ImpactPoint, HitResult.ImpactNormal, HitMarkDecalSize, FMath::FRandRange(0.0f, 360.0f));
+					}
 				}
 			}
 		}
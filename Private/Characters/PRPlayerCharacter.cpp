@@ -3,6 +3,7 @@
 
 #include "Characters/PRPlayerCharacter.h"
 #include "Data/PRInputConfigDataAsset.h"
+#include "Data/PREffectPresetDataAsset.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -18,7 +19,6 @@
 #include "Components/PREffectSystemComponent.h"
 #include "Components/PRWeaponSystemComponent.h"
 #include "Controllers/PRPlayerController.h"
-#include "Effects/PRNiagaraEffect.h"
 
 APRPlayerCharacter::APRPlayerCharacter()
 {
@@ -60,6 +60,7 @@ APRPlayerCharacter::APRPlayerCharacter()
 	
 	// DoubleJump
 	DoubleJumpNiagaraEffect = nullptr;
+	DoubleJumpEffectPreset = nullptr;
 	RootSocketName = FName("root");
 	LeftFootSocketName = FName("foot_l");
 	RightFootSocketName = FName("foot_r");
@@ -102,6 +103,12 @@ APRPlayerCharacter::APRPlayerCharacter()
 void APRPlayerCharacter::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// 더블 점프 프리셋의 에셋과 Pool을 미리 준비합니다.
+	if(DoubleJumpEffectPreset && GetEffectSystem())
+	{
+		GetEffectSystem()->PreloadEffectPreset(DoubleJumpEffectPreset);
+	}
 }
 
 void APRPlayerCharacter::PostInitializeComponents()
@@ -110,7 +117,7 @@ void APRPlayerCharacter::PostInitializeComponents()
 
 	// VaultCollision
 	VaultCollision->OnComponentBeginOverlap.AddDynamic(this, &APRPlayerCharacter::OnVaultCollisionBeginOverlap);
-	if(bVaultDebug)
+	if(PRDebugDraw::IsEnabled(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug))
 	{
 		VaultCollision->SetHiddenInGame(false);
 	}
@@ -509,17 +516,19 @@ void APRPlayerCharacter::DoubleJump()
 	PlayAnimMontage(DoubleJumpAnimMontage);
 
 	// 더블점프 이펙트 생성
-	if(DoubleJumpNiagaraEffect)
+	if(DoubleJumpEffectPreset)
 	{
-		const FVector CenterLocation = GetMesh()->GetSocketLocation(FName("root"));
-		const FVector LeftFootLocation = GetMesh()->GetSocketLocation(FName("foot_l"));
-		const FVector RightFootLocation = GetMesh()->GetSocketLocation(FName("foot_r"));
-		const FVector NewSpawnEffectLocation = FVector(CenterLocation.X, CenterLocation.Y, UKismetMathLibrary::Min(LeftFootLocation.Z, RightFootLocation.Z));
+		// 이펙트와 사운드를 하나의 프리셋으로 한 번에 Spawn합니다.
+		GetEffectSystem()->SpawnEffectPresetAtLocation(DoubleJumpEffectPreset, GetDoubleJumpEffectLocation(), GetActorRotation());
+	}
+	else if(DoubleJumpNiagaraEffect)
+	{
+		const FVector NewSpawnEffectLocation = GetDoubleJumpEffectLocation();
 
-		APRNiagaraEffect* DoubleJumpEffect = GetEffectSystem()->SpawnNiagaraEffectAtLocation(DoubleJumpNiagaraEffect, NewSpawnEffectLocation);
+		UNiagaraComponent* DoubleJumpEffect = GetEffectSystem()->SpawnNiagaraSystemAtLocation(DoubleJumpNiagaraEffect, NewSpawnEffectLocation);
 		// if(DoubleJumpEffect)
 		// {
-		// 	DoubleJumpEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColor, Signaturecolor)
+		// 	DoubleJumpEffect->SetVariableLinearColor(EffectColor, Signaturecolor)
 		// }
 	}
 
@@ -531,6 +540,16 @@ void APRPlayerCharacter::DoubleJump()
 	LaunchCharacter(Velocity, true, true);
 	ActivateAerial(false);
 }
+
+FVector APRPlayerCharacter::GetDoubleJumpEffectLocation() const
+{
+	// Root 본의 수평 위치와 두 발 중 낮은 발의 높이를 사용합니다.
+	const FVector CenterLocation = GetMesh()->GetSocketLocation(RootSocketName);
+	const FVector LeftFootLocation = GetMesh()->GetSocketLocation(LeftFootSocketName);
+	const FVector RightFootLocation = GetMesh()->GetSocketLocation(RightFootSocketName);
+
+	return FVector(CenterLocation.X, CenterLocation.Y, UKismetMathLibrary::Min(LeftFootLocation.Z, RightFootLocation.Z));
+}
 #pragma endregion 
 
 #pragma region Vaulting
@@ -546,21 +565,14 @@ void APRPlayerCharacter::ExecuteVault()
 		ActorsToIgnore.Add(this);
 
 		// 디버그 옵션을 설정합니다.
-		EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-		if(bVaultDebug)
-		{
-			DebugType = EDrawDebugTrace::ForDuration;
-		}
+		const EDrawDebugTrace::Type DebugType = PRDebugDraw::GetDrawDebugTrace(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug);
 
 		// 캐릭터가 뛰어넘을 수 있는 거리 안에 오브젝트가 존재하는 Trace를 실행합니다.
 		bool bIsHit = UKismetSystemLibrary::SphereTraceSingle(GetWorld(), TraceStart, TraceEnd, VaultableObjectTraceRadius, UEngineTypes::ConvertToTraceType(ECC_Visibility),
 																false, ActorsToIgnore, DebugType, HitResult, true);
 		if(bIsHit)
 		{
-			if(bVaultDebug)
-			{
-				DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 10.0f, 12, FColor::Blue, false, 5.0f);
-			}
+			PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug, DrawDebugSphere(GetWorld(), HitResult.ImpactPoint, 10.0f, 12, FColor::Blue, false, 5.0f));
 			
 			CalculateVaultableObjectDepth(HitResult.ImpactPoint);
 			
@@ -606,11 +618,7 @@ void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 		ActorsToIgnore.Add(this);
 
 		// 디버그 옵션을 설정합니다.
-		EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-		if(bVaultDebug)
-		{
-			DebugType = EDrawDebugTrace::ForDuration;
-		}
+		const EDrawDebugTrace::Type DebugType = PRDebugDraw::GetDrawDebugTrace(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug);
 
 		// 뛰어넘을 장애물과 캐릭터 사이의 거리를 측정합니다.
 		bool bIsHit = UKismetSystemLibrary::SphereTraceSingle(GetWorld(), TraceStart, TraceEnd, VaultableObjectTraceRadius, UEngineTypes::ConvertToTraceType(ECC_Visibility),
@@ -632,17 +640,11 @@ void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 				if(Index == 0)
 				{
 					VaultStartLocation = HitResult.ImpactPoint;
-					if(bVaultDebug)
-					{
-						DrawDebugSphere(GetWorld(), VaultStartLocation, 15.0f, 12, FColor::White, false, 5.0f);
-					}
+					PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug, DrawDebugSphere(GetWorld(), VaultStartLocation, 15.0f, 12, FColor::White, false, 5.0f));
 				}
 
 				VaultingLocation = HitResult.ImpactPoint;
-				if(bVaultDebug)
-				{
-					DrawDebugSphere(GetWorld(), VaultingLocation, 10.0f, 12, FColor::Yellow, false, 5.0f);
-				}
+				PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug, DrawDebugSphere(GetWorld(), VaultingLocation, 10.0f, 12, FColor::Yellow, false, 5.0f));
 			
 				bCanVaultWarp = true;
 			}
@@ -655,9 +657,9 @@ void APRPlayerCharacter::CalculateVaultableObjectDepth(FVector TraceImpactPoint)
 		}
 	}
 
-	if(bVaultDebug && VaultingLocation != FVector::ZeroVector)
+	if(VaultingLocation != FVector::ZeroVector)
 	{
-		DrawDebugSphere(GetWorld(), VaultingLocation, 15.0f, 12, FColor::Purple, false, 5.0f);
+		PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug, DrawDebugSphere(GetWorld(), VaultingLocation, 15.0f, 12, FColor::Purple, false, 5.0f));
 	}
 
 	ExecuteVaultMotionWarp();
@@ -672,21 +674,14 @@ void APRPlayerCharacter::CalculateVaultLandLocation(FVector TraceEndLocation)
 	ActorsToIgnore.Add(this);
 
 	// 디버그 옵션을 설정합니다.
-	EDrawDebugTrace::Type DebugType = EDrawDebugTrace::None;
-	if(bVaultDebug)
-	{
-		DebugType = EDrawDebugTrace::ForDuration;
-	}
+	const EDrawDebugTrace::Type DebugType = PRDebugDraw::GetDrawDebugTrace(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug);
 	
 	bool bIsLandHit = UKismetSystemLibrary::LineTraceSingle(GetWorld(), TraceStart, TraceEnd, UEngineTypes::ConvertToTraceType(ECC_Visibility),
 																	true, ActorsToIgnore, DebugType, HitResult, true);
 	if(bIsLandHit)
 	{
 		VaultLandLocation = HitResult.ImpactPoint;
-		if(bVaultDebug)
-		{
-			DrawDebugSphere(GetWorld(), VaultLandLocation, 10.0f, 12, FColor::Cyan, false, 5.0f);
-		}
+		PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug, DrawDebugSphere(GetWorld(), VaultLandLocation, 10.0f, 12, FColor::Cyan, false, 5.0f));
 	}
 }
 
@@ -0,0 +1,433 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Commandlets/PREffectPoolSettingsCommandlet.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Animation/AnimSequenceBase.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DataTable.h"
+#include "Misc/PackageName.h"
+#include "UObject/SavePackage.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "AnimNotifies/ANS_PRTimedNiagaraEffect.h"
+#include "AnimNotifies/ANS_PRTimedParticleEffect.h"
+#include "AnimNotifies/AN_PRPlayNiagaraEffect.h"
+#include "AnimNotifies/AN_PRPlayParticleEffect.h"
+#include "Characters/PRPlayerCharacter.h"
+#include "Components/PREffectSystemComponent.h"
+#include "Weapons/PRDualMeleeWeapon.h"
+
+UPREffectPoolSettingsCommandlet::UPREffectPoolSettingsCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+
+	SearchPaths.Empty();
+	DefaultEffectLifespan = 2.0f;
+	InstanceCount = 1;
+	MaxPoolSize = 32;
+	bAllowShrink = false;
+	bDryRun = false;
+	NiagaraPoolSettingsDataTable = nullptr;
+	ParticlePoolSettingsDataTable = nullptr;
+	EffectUsages.Empty();
+	EffectLifespans.Empty();
+}
+
+int32 UPREffectPoolSettingsCommandlet::Main(const FString& Params)
+{
+#if WITH_EDITOR
+	ParseParameters(Params);
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	// 블루프린트를 먼저 검색하여 지정되지 않은 데이터 테이블을 캐릭터의 EffectSystem에서 가져옵니다.
+	GatherBlueprintEffectUsages(AssetRegistry);
+	if(!NiagaraPoolSettingsDataTable && !ParticlePoolSettingsDataTable)
+	{
+		PR_LOG_ERROR("Pool settings data table not found. Pass -NiagaraTable= or -ParticleTable=.");
+		return 1;
+	}
+
+	// 일회성 이펙트의 활성화 구간을 계산할 수 있도록 데이터 테이블의 수명을 먼저 가져옵니다.
+	CacheEffectLifespans();
+	GatherAnimationEffectUsages(AssetRegistry);
+
+	int32 ChangedRowCount = 0;
+	if(NiagaraPoolSettingsDataTable)
+	{
+		const int32 ChangedNiagaraRowCount = UpdatePoolSettingsDataTable(NiagaraPoolSettingsDataTable, &FPRNiagaraEffectPoolSettings::NiagaraSystem);
+		if(ChangedNiagaraRowCount > 0 && !bDryRun && !SaveDataTable(NiagaraPoolSettingsDataTable))
+		{
+			return 1;
+		}
+
+		ChangedRowCount += ChangedNiagaraRowCount;
+	}
+
+	if(ParticlePoolSettingsDataTable)
+	{
+		const int32 ChangedParticleRowCount = UpdatePoolSettingsDataTable(ParticlePoolSettingsDataTable, &FPRParticleEffectPoolSettings::ParticleSystem);
+		if(ChangedParticleRowCount > 0 && !bDryRun && !SaveDataTable(ParticlePoolSettingsDataTable))
+		{
+			return 1;
+		}
+
+		ChangedRowCount += ChangedParticleRowCount;
+	}
+
+	PR_LOG(Display, "Found %d effects, %s %d pool settings rows.", EffectUsages.Num(), bDryRun ? TEXT("would change") : TEXT("changed"), ChangedRowCount);
+
+	return 0;
+#else
+	return 1;
+#endif
+}
+
+#if WITH_EDITOR
+void UPREffectPoolSettingsCommandlet::ParseParameters(const FString& Params)
+{
+	FString PathsParam;
+	if(FParse::Value(*Params, TEXT("Paths="), PathsParam, false))
+	{
+		PathsParam.ParseIntoArray(SearchPaths, TEXT("+"));
+	}
+
+	if(SearchPaths.IsEmpty())
+	{
+		SearchPaths.Emplace(TEXT("/Game"));
+	}
+
+	FString DataTablePath;
+	if(FParse::Value(*Params, TEXT("NiagaraTable="), DataTablePath))
+	{
+		NiagaraPoolSettingsDataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	}
+
+	if(FParse::Value(*Params, TEXT("ParticleTable="), DataTablePath))
+	{
+		ParticlePoolSettingsDataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+	}
+
+	FParse::Value(*Params, TEXT("Instances="), InstanceCount);
+	FParse::Value(*Params, TEXT("MaxPoolSize="), MaxPoolSize);
+	FParse::Value(*Params, TEXT("DefaultLifespan="), DefaultEffectLifespan);
+	InstanceCount = FMath::Max(InstanceCount, 1);
+	MaxPoolSize = FMath::Max(MaxPoolSize, 1);
+	bAllowShrink = FParse::Param(*Params, TEXT("AllowShrink"));
+	bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+}
+
+void UPREffectPoolSettingsCommandlet::GatherBlueprintEffectUsages(IAssetRegistry& AssetRegistry)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Emplace(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = true;
+	for(const FString& SearchPath : SearchPaths)
+	{
+		Filter.PackagePaths.Emplace(*SearchPath);
+	}
+
+	TArray<FAssetData> BlueprintAssets;
+	AssetRegistry.GetAssets(Filter, BlueprintAssets);
+	for(const FAssetData& BlueprintAsset : BlueprintAssets)
+	{
+		// 무기와 캐릭터가 아닌 블루프린트는 불러오지 않도록 태그로 부모 클래스를 먼저 확인합니다.
+		FString NativeParentClassPath;
+		if(!BlueprintAsset.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+		{
+			continue;
+		}
+
+		const UClass* NativeParentClass = FSoftClassPath(FPackageName::ExportTextPathToObjectPath(NativeParentClassPath)).ResolveClass();
+		if(!NativeParentClass
+			|| (!NativeParentClass->IsChildOf(APRBaseWeapon::StaticClass()) && !NativeParentClass->IsChildOf(APRBaseCharacter::StaticClass())))
+		{
+			continue;
+		}
+
+		const UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset());
+		if(!Blueprint || !Blueprint->GeneratedClass)
+		{
+			continue;
+		}
+
+		const FString SourceName = Blueprint->GetPathName();
+		const UObject* DefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
+		if(const APRBaseWeapon* Weapon = Cast<APRBaseWeapon>(DefaultObject))
+		{
+			// 발도와 납도마다 무기의 외형 수만큼 Spawn하며, 발도 직후 납도하면 두 번의 Spawn이 겹칠 수 있습니다.
+			const int32 WeaponMeshCount = Weapon->IsA<APRDualMeleeWeapon>() ? 2 : 1;
+			AddEffectUsage(Weapon->GetSpawnNiagaraEffect(), WeaponMeshCount * 2, SourceName);
+		}
+		else if(const APRBaseCharacter* Character = Cast<APRBaseCharacter>(DefaultObject))
+		{
+			const UPREffectSystemComponent* EffectSystem = Character->GetEffectSystem();
+			if(EffectSystem)
+			{
+				if(!NiagaraPoolSettingsDataTable)
+				{
+					NiagaraPoolSettingsDataTable = EffectSystem->GetNiagaraPoolSettingsDataTable();
+				}
+
+				if(!ParticlePoolSettingsDataTable)
+				{
+					ParticlePoolSettingsDataTable = EffectSystem->GetParticlePoolSettingsDataTable();
+				}
+			}
+
+			if(const APRPlayerCharacter* PlayerCharacter = Cast<APRPlayerCharacter>(Character))
+			{
+				AddEffectUsage(PlayerCharacter->GetDoubleJumpNiagaraEffect(), 1, SourceName);
+			}
+		}
+	}
+}
+
+void UPREffectPoolSettingsCommandlet::GatherAnimationEffectUsages(IAssetRegistry& AssetRegistry)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Emplace(UAnimSequenceBase::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+	for(const FString& SearchPath : SearchPaths)
+	{
+		Filter.PackagePaths.Emplace(*SearchPath);
+	}
+
+	TArray<FAssetData> AnimationAssets;
+	AssetRegistry.GetAssets(Filter, AnimationAssets);
+	for(int32 Index = 0; Index < AnimationAssets.Num(); Index++)
+	{
+		GatherAnimationEffectUsage(Cast<UAnimSequenceBase>(AnimationAssets[Index].GetAsset()));
+
+		// 많은 애니메이션을 불러올 때 메모리가 계속 늘어나지 않도록 주기적으로 정리합니다.
+		if((Index + 1) % 256 == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+}
+
+void UPREffectPoolSettingsCommandlet::GatherAnimationEffectUsage(const UAnimSequenceBase* Animation)
+{
+	if(!Animation)
+	{
+		return;
+	}
+
+	// 노티파이의 시간을 재생 속도를 적용한 실제 시간으로 변환합니다.
+	const float RateScale = FMath::Abs(Animation->RateScale) > KINDA_SMALL_NUMBER ? FMath::Abs(Animation->RateScale) : 1.0f;
+	const float PlayLength = Animation->GetPlayLength() / RateScale;
+
+	TMap<UFXSystemAsset*, TArray<TPair<float, float>>> EffectActiveIntervals;
+	for(const FAnimNotifyEvent& NotifyEvent : Animation->Notifies)
+	{
+		UFXSystemAsset* EffectAsset = nullptr;
+		float ActiveTime = 0.0f;
+		if(const UANS_PRTimedNiagaraEffect* TimedNiagaraEffect = Cast<UANS_PRTimedNiagaraEffect>(NotifyEvent.NotifyStateClass))
+		{
+			EffectAsset = TimedNiagaraEffect->Template;
+			ActiveTime = NotifyEvent.GetDuration() / RateScale;
+		}
+		else if(const UANS_PRTimedParticleEffect* TimedParticleEffect = Cast<UANS_PRTimedParticleEffect>(NotifyEvent.NotifyStateClass))
+		{
+			EffectAsset = TimedParticleEffect->PSTemplate;
+			ActiveTime = NotifyEvent.GetDuration() / RateScale;
+		}
+		else if(const UAN_PRPlayNiagaraEffect* PlayNiagaraEffect = Cast<UAN_PRPlayNiagaraEffect>(NotifyEvent.Notify))
+		{
+			EffectAsset = PlayNiagaraEffect->Template;
+			ActiveTime = GetEffectLifespan(EffectAsset);
+		}
+		else if(const UAN_PRPlayParticleEffect* PlayParticleEffect = Cast<UAN_PRPlayParticleEffect>(NotifyEvent.Notify))
+		{
+			EffectAsset = PlayParticleEffect->PSTemplate;
+			ActiveTime = GetEffectLifespan(EffectAsset);
+		}
+
+		if(!EffectAsset)
+		{
+			continue;
+		}
+
+		// 길이가 없는 구간도 최소 한 프레임은 활성화된 것으로 계산합니다.
+		const float StartTime = NotifyEvent.GetTriggerTime() / RateScale;
+		EffectActiveIntervals.FindOrAdd(EffectAsset).Emplace(StartTime, StartTime + FMath::Max(ActiveTime, 1.0f / 30.0f));
+	}
+
+	const FString SourceName = Animation->GetPathName();
+	for(const auto& EffectActiveInterval : EffectActiveIntervals)
+	{
+		AddEffectUsage(EffectActiveInterval.Key, EstimateConcurrentCount(EffectActiveInterval.Value, PlayLength), SourceName);
+	}
+}
+
+int32 UPREffectPoolSettingsCommandlet::EstimateConcurrentCount(const TArray<TPair<float, float>>& ActiveIntervals, float PlayLength) const
+{
+	float LatestEndTime = 0.0f;
+	for(const TPair<float, float>& ActiveInterval : ActiveIntervals)
+	{
+		LatestEndTime = FMath::Max(LatestEndTime, ActiveInterval.Value);
+	}
+
+	// 마지막 이펙트가 끝날 때까지 애니메이션을 연속으로 재생한 것으로 보고 구간을 반복합니다.
+	constexpr int32 MaxRepeatCount = 16;
+	const int32 RepeatCount = PlayLength > KINDA_SMALL_NUMBER ? FMath::Min(FMath::CeilToInt(LatestEndTime / PlayLength), MaxRepeatCount) + 1 : 1;
+
+	// 시작은 +1, 끝은 -1로 기록한 후 시간 순서대로 더하여 가장 많이 겹치는 수를 찾습니다.
+	TArray<TPair<float, int32>> IntervalEvents;
+	IntervalEvents.Reserve(ActiveIntervals.Num() * RepeatCount * 2);
+	for(int32 RepeatIndex = 0; RepeatIndex < RepeatCount; RepeatIndex++)
+	{
+		const float RepeatOffset = PlayLength * RepeatIndex;
+		for(const TPair<float, float>& ActiveInterval : ActiveIntervals)
+		{
+			IntervalEvents.Emplace(ActiveInterval.Key + RepeatOffset, 1);
+			IntervalEvents.Emplace(ActiveInterval.Value + RepeatOffset, -1);
+		}
+	}
+
+	// 같은 시간에 끝나는 이펙트는 Pool에 먼저 반환되므로 끝을 먼저 처리합니다.
+	IntervalEvents.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key == B.Key ? A.Value < B.Value : A.Key < B.Key;
+	});
+
+	int32 ConcurrentCount = 0;
+	int32 MaxConcurrentCount = 0;
+	for(const TPair<float, int32>& IntervalEvent : IntervalEvents)
+	{
+		ConcurrentCount += IntervalEvent.Value;
+		MaxConcurrentCount = FMath::Max(MaxConcurrentCount, ConcurrentCount);
+	}
+
+	return MaxConcurrentCount;
+}
+
+void UPREffectPoolSettingsCommandlet::AddEffectUsage(UFXSystemAsset* EffectAsset, int32 ConcurrentCount, const FString& SourceName)
+{
+	if(!EffectAsset || ConcurrentCount <= 0)
+	{
+		return;
+	}
+
+	FPREffectPoolUsage& EffectUsage = EffectUsages.FindOrAdd(EffectAsset);
+	if(ConcurrentCount > EffectUsage.MaxConcurrentCount)
+	{
+		EffectUsage.MaxConcurrentCount = ConcurrentCount;
+		EffectUsage.SourceName = SourceName;
+	}
+}
+
+void UPREffectPoolSettingsCommandlet::CacheEffectLifespans()
+{
+	if(NiagaraPoolSettingsDataTable)
+	{
+		NiagaraPoolSettingsDataTable->ForeachRow<FPRNiagaraEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRNiagaraEffectPoolSettings& Settings)
+		{
+			EffectLifespans.Emplace(Settings.NiagaraSystem, Settings.EffectLifespan);
+		});
+	}
+
+	if(ParticlePoolSettingsDataTable)
+	{
+		ParticlePoolSettingsDataTable->ForeachRow<FPRParticleEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRParticleEffectPoolSettings& Settings)
+		{
+			EffectLifespans.Emplace(Settings.ParticleSystem, Settings.EffectLifespan);
+		});
+	}
+}
+
+float UPREffectPoolSettingsCommandlet::GetEffectLifespan(UFXSystemAsset* EffectAsset) const
+{
+	const float* EffectLifespan = EffectLifespans.Find(EffectAsset);
+
+	return EffectLifespan && *EffectLifespan > 0.0f ? *EffectLifespan : DefaultEffectLifespan;
+}
+
+template<typename RowType, typename AssetType>
+int32 UPREffectPoolSettingsCommandlet::UpdatePoolSettingsDataTable(UDataTable* DataTable, TObjectPtr<AssetType> RowType::* EffectAssetMember)
+{
+	int32 ChangedRowCount = 0;
+	for(const auto& EffectUsage : EffectUsages)
+	{
+		AssetType* EffectAsset = Cast<AssetType>(EffectUsage.Key);
+		if(!EffectAsset)
+		{
+			continue;
+		}
+
+		const int32 PoolSize = FMath::Clamp(EffectUsage.Value.MaxConcurrentCount * InstanceCount, 1, MaxPoolSize);
+
+		// 같은 이펙트를 가진 행을 찾습니다. 행의 이름은 이펙트와 다를 수 있습니다.
+		RowType* PoolSettings = nullptr;
+		for(const auto& Row : DataTable->GetRowMap())
+		{
+			RowType* RowData = reinterpret_cast<RowType*>(Row.Value);
+			if(RowData && RowData->*EffectAssetMember == EffectAsset)
+			{
+				PoolSettings = RowData;
+				break;
+			}
+		}
+
+		if(!PoolSettings)
+		{
+			PR_LOG(Display, "%s: add %s (PoolSize %d, from %s)", *DataTable->GetName(), *EffectAsset->GetName(), PoolSize, *EffectUsage.Value.SourceName);
+			if(!bDryRun)
+			{
+				// 이펙트의 이름을 행의 이름으로 사용하고, 이미 있는 이름이면 번호를 붙입니다.
+				FName RowName = EffectAsset->GetFName();
+				for(int32 Suffix = 1; DataTable->GetRowMap().Contains(RowName); Suffix++)
+				{
+					RowName = FName(EffectAsset->GetFName(), Suffix);
+				}
+
+				RowType NewPoolSettings;
+				NewPoolSettings.*EffectAssetMember = EffectAsset;
+				NewPoolSettings.PoolSize = PoolSize;
+				DataTable->Modify();
+				DataTable->AddRow(RowName, NewPoolSettings);
+			}
+
+			ChangedRowCount++;
+		}
+		else if(PoolSettings->PoolSize < PoolSize || (bAllowShrink && PoolSettings->PoolSize != PoolSize))
+		{
+			PR_LOG(Display, "%s: update %s (PoolSize %d -> %d, from %s)", *DataTable->GetName(), *EffectAsset->GetName(), PoolSettings->PoolSize, PoolSize, *EffectUsage.Value.SourceName);
+			if(!bDryRun)
+			{
+				DataTable->Modify();
+				PoolSettings->PoolSize = PoolSize;
+			}
+
+			ChangedRowCount++;
+		}
+	}
+
+	return ChangedRowCount;
+}
+
+bool UPREffectPoolSettingsCommandlet::SaveDataTable(UDataTable* DataTable) const
+{
+	UPackage* Package = DataTable->GetOutermost();
+	Package->MarkPackageDirty();
+
+	const FString PackageFileName = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	if(!UPackage::SavePackage(Package, DataTable, *PackageFileName, SaveArgs))
+	{
+		PR_LOG_ERROR("Failed to save %s.", *PackageFileName);
+		return false;
+	}
+
+	return true;
+}
+#endif
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Common/PRDebugDraw.h"
+#include "HAL/IConsoleManager.h"
+
+#if PR_ENABLE_DEBUG_DRAW
+namespace PRDebugDraw
+{
+	/** 카테고리별 디버그 드로우의 활성화 여부입니다. 기본적으로 모두 비활성화합니다. */
+	int32 GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_MAX)] = {};
+
+	/** 오브젝트 Pool의 동적 생성과 예측 확장을 표시하는 콘솔 변수입니다. */
+	static FAutoConsoleVariableRef CVarPRDebugPools(
+		TEXT("pr.Debug.Pools"),
+		GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_Pools)],
+		TEXT("Draws dynamic spawns and predictive growth of object pools. 0: off, 1: on"),
+		ECVF_Cheat);
+
+	/** 이펙트의 활성화 위치를 표시하는 콘솔 변수입니다. */
+	static FAutoConsoleVariableRef CVarPRDebugEffects(
+		TEXT("pr.Debug.Effects"),
+		GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_Effects)],
+		TEXT("Draws the location of activated effects. 0: off, 1: on"),
+		ECVF_Cheat);
+
+	/** Vault의 Trace와 위치를 표시하는 콘솔 변수입니다. */
+	static FAutoConsoleVariableRef CVarPRDebugVault(
+		TEXT("pr.Debug.Vault"),
+		GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_Vault)],
+		TEXT("Draws vault traces and locations. 0: off, 1: on"),
+		ECVF_Cheat);
+
+	/** 발소리와 발자국의 Trace를 표시하는 콘솔 변수입니다. */
+	static FAutoConsoleVariableRef CVarPRDebugFootsteps(
+		TEXT("pr.Debug.Footsteps"),
+		GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_Footsteps)],
+		TEXT("Draws footstep traces. 0: off, 1: on"),
+		ECVF_Cheat);
+
+	/** 공격의 Trace를 표시하는 콘솔 변수입니다. */
+	static FAutoConsoleVariableRef CVarPRDebugDamage(
+		TEXT("pr.Debug.Damage"),
+		GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_Damage)],
+		TEXT("Draws damage traces. 0: off, 1: on"),
+		ECVF_Cheat);
+}
+#endif
@@ -2,11 +2,62 @@
 
 
 #include "Components/PRBaseObjectPoolSystemComponent.h"
+#include "RenderCore.h"
+#include "Subsystems/PRBakedPoolSubsystem.h"
 
 UPRBaseObjectPoolSystemComponent::UPRBaseObjectPoolSystemComponent()
 {
+	// 예측 확장을 위해 일정한 주기로 Tick 함수를 사용합니다.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickInterval = 0.1f;
+	
 	DynamicLifespan = 60.0f;
 	DynamicPoolSize = 3;
+
+	// PredictiveGrowth
+	bEnablePredictiveGrowth = true;
+	AcquireRateSmoothingFactor = 0.3f;
+	DemandLookaheadTime = 0.5f;
+	GrowthThresholdRatio = 0.8f;
+	MaxPredictiveGrowthPerUpdate = 1;
+	MaxPredictivePoolSize = 32;
+	IdleFrameTimeThreshold = 1.0f / 60.0f;
+	PoolDemandStats.Empty();
+	PredictivelyGrownObjects.Empty();
+}
+
+void UPRBaseObjectPoolSystemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Pool이 생성된 후 스트리밍된 레벨의 미리 배치된 Pool 오브젝트를 Pool에 추가하도록 바인딩합니다.
+	UPRBakedPoolSubsystem* BakedPoolSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPRBakedPoolSubsystem>() : nullptr;
+	if(BakedPoolSubsystem)
+	{
+		BakedPoolActorsRegisteredHandle = BakedPoolSubsystem->OnBakedPoolActorsRegisteredDelegate.AddUObject(this, &UPRBaseObjectPoolSystemComponent::AdoptBakedPoolActors);
+		AdoptBakedPoolActors();
+	}
+}
+
+void UPRBaseObjectPoolSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UPRBakedPoolSubsystem* BakedPoolSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPRBakedPoolSubsystem>() : nullptr;
+	if(BakedPoolSubsystem)
+	{
+		BakedPoolSubsystem->OnBakedPoolActorsRegisteredDelegate.Remove(BakedPoolActorsRegisteredHandle);
+	}
+	
+	Super::EndPlay(EndPlayReason);
+}
+
+void UPRBaseObjectPoolSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if(bEnablePredictiveGrowth)
+	{
+		UpdatePredictiveGrowth(DeltaTime);
+	}
 }
 
 void UPRBaseObjectPoolSystemComponent::DestroyComponent(bool bPromoteChildren)
@@ -25,6 +76,8 @@ void UPRBaseObjectPoolSystemComponent::InitializeObjectPool()
 void UPRBaseObjectPoolSystemComponent::ClearAllObjectPool()
 {
 	// 자식 클래스에서 오버라이딩하여 사용합니다.
+
+	ClearPoolDemandStats();
 }
 
 bool UPRBaseObjectPoolSystemComponent::IsPoolableObject(UObject* PoolableObject) const
@@ -129,3 +182,160 @@ void UPRBaseObjectPoolSystemComponent::ClearDynamicDestroyObjectList(FPRDynamicD
 	//
 	// NewDynamicDestroyObjectList.List.Empty();
 }
+
+#pragma region BakedPool
+AActor* UPRBaseObjectPoolSystemComponent::ClaimBakedPoolActor(UObject* PoolKey) const
+{
+	UPRBakedPoolSubsystem* BakedPoolSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPRBakedPoolSubsystem>() : nullptr;
+	if(BakedPoolSubsystem)
+	{
+		return BakedPoolSubsystem->ClaimBakedActor(PoolKey);
+	}
+
+	return nullptr;
+}
+
+void UPRBaseObjectPoolSystemComponent::AdoptBakedPoolActors()
+{
+	// 자식 클래스에서 오버라이딩하여 사용합니다.
+}
+#pragma endregion
+
+#pragma region PredictiveGrowth
+FPRPoolDemandStats UPRBaseObjectPoolSystemComponent::GetPoolDemandStats(UObject* PoolKey) const
+{
+	const FPRPoolDemandStats* DemandStats = PoolDemandStats.Find(PoolKey);
+	if(DemandStats)
+	{
+		return *DemandStats;
+	}
+
+	return FPRPoolDemandStats();
+}
+
+void UPRBaseObjectPoolSystemComponent::RecordPoolAcquire(UObject* PoolKey, UObject* AcquiredObject, bool bDynamicSpawned)
+{
+	if(!PoolKey || !IsValid(AcquiredObject))
+	{
+		return;
+	}
+
+	FPRPoolDemandStats& DemandStats = PoolDemandStats.FindOrAdd(PoolKey);
+	DemandStats.PendingAcquireCount++;
+
+	if(bDynamicSpawned)
+	{
+		// Pool이 고갈되어 획득 시점에 동적으로 생성했습니다.
+		DemandStats.OnDemandDynamicSpawnCount++;
+		PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Pools, false, DrawPoolAcquireDebug(PoolKey, FColor::Red));
+	}
+	else if(PredictivelyGrownObjects.Remove(AcquiredObject) > 0)
+	{
+		// 예측 확장으로 미리 생성한 오브젝트를 사용하여 동적 생성을 피했습니다.
+		DemandStats.AvoidedDynamicSpawnCount++;
+		PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Pools, false, DrawPoolAcquireDebug(PoolKey, FColor::Green));
+	}
+}
+
+#if PR_ENABLE_DEBUG_DRAW
+void UPRBaseObjectPoolSystemComponent::DrawPoolAcquireDebug(UObject* PoolKey, const FColor& Color) const
+{
+	const AActor* Owner = GetOwner();
+	if(!IsValid(Owner) || !GetWorld())
+	{
+		return;
+	}
+
+	// 동적 생성은 빨간색, 예측 확장으로 피한 동적 생성은 초록색으로 Pool을 가진 액터 위에 표시합니다.
+	const FVector DrawLocation = Owner->GetActorLocation() + FVector(0.0f, 0.0f, 100.0f);
+	DrawDebugSphere(GetWorld(), DrawLocation, 20.0f, 8, Color, false, 1.0f);
+	DrawDebugString(GetWorld(), DrawLocation, FString::Printf(TEXT("%s (%d)"), *GetNameSafe(PoolKey), GetPoolCapacity(PoolKey)), nullptr, Color, 1.0f);
+}
+#endif
+
+void UPRBaseObjectPoolSystemComponent::RemovePredictivelyGrownObject(UObject* PooledObject)
+{
+	PredictivelyGrownObjects.Remove(PooledObject);
+}
+
+void UPRBaseObjectPoolSystemComponent::ClearPoolDemandStats()
+{
+	PoolDemandStats.Empty();
+	PredictivelyGrownObjects.Empty();
+}
+
+int32 UPRBaseObjectPoolSystemComponent::GetPoolCapacity(UObject* PoolKey) const
+{
+	// 자식 클래스에서 오버라이딩하여 사용합니다.
+	
+	return 0;
+}
+
+int32 UPRBaseObjectPoolSystemComponent::GetActivatePoolObjectCount(UObject* PoolKey) const
+{
+	// 자식 클래스에서 오버라이딩하여 사용합니다.
+	
+	return 0;
+}
+
+UObject* UPRBaseObjectPoolSystemComponent::GrowPool(UObject* PoolKey)
+{
+	// 자식 클래스에서 오버라이딩하여 사용합니다.
+	
+	return nullptr;
+}
+
+void UPRBaseObjectPoolSystemComponent::UpdatePredictiveGrowth(float DeltaTime)
+{
+	if(DeltaTime <= 0.0f || PoolDemandStats.IsEmpty())
+	{
+		return;
+	}
+
+	// 게임 스레드의 작업 시간이 목표 프레임 예산 안에 있을 경우에만 Pool을 확장합니다.
+	// 프레임 시간은 VSync나 프레임 제한의 대기 시간을 포함하므로 게임 스레드가 실제로 사용한 시간을 기준으로 합니다.
+	const bool bHasSpareFrameBudget = FPlatformTime::ToMilliseconds(GGameThreadTime) <= IdleFrameTimeThreshold * 1000.0f;
+	int32 RemainingGrowthCount = MaxPredictiveGrowthPerUpdate;
+	
+	TArray<UObject*> PoolKeysToGrow;
+	for(auto& DemandStatsEntry : PoolDemandStats)
+	{
+		FPRPoolDemandStats& DemandStats = DemandStatsEntry.Value;
+
+		// 이번 측정 구간의 획득 빈도를 지수 가중 이동 평균에 반영합니다.
+		const float SampledAcquireRate = DemandStats.PendingAcquireCount / DeltaTime;
+		DemandStats.AcquireRate = FMath::Lerp(DemandStats.AcquireRate, SampledAcquireRate, AcquireRateSmoothingFactor);
+		DemandStats.PendingAcquireCount = 0;
+
+		if(!bHasSpareFrameBudget || !DemandStatsEntry.Key)
+		{
+			continue;
+		}
+
+		// 예측한 수요가 Pool의 크기에 가까우면 확장할 Pool로 지정합니다.
+		const int32 PoolCapacity = GetPoolCapacity(DemandStatsEntry.Key);
+		const float ProjectedDemand = GetActivatePoolObjectCount(DemandStatsEntry.Key) + DemandStats.AcquireRate * DemandLookaheadTime;
+		if(PoolCapacity < MaxPredictivePoolSize
+			&& ProjectedDemand >= PoolCapacity * GrowthThresholdRatio)
+		{
+			PoolKeysToGrow.Emplace(DemandStatsEntry.Key);
+		}
+	}
+
+	for(UObject* PoolKey : PoolKeysToGrow)
+	{
+		if(RemainingGrowthCount <= 0)
+		{
+			break;
+		}
+		
+		UObject* GrownObject = GrowPool(PoolKey);
+		if(IsValid(GrownObject))
+		{
+			PredictivelyGrownObjects.Emplace(GrownObject);
+			PoolDemandStats.FindOrAdd(PoolKey).PredictiveGrowthCount++;
+			RemainingGrowthCount--;
+		}
+	}
+}
+#pragma endregion
@@ -3,628 +3,1903 @@
 
 #include "Components/PREffectSystemComponent.h"
 #include "Characters/PRBaseCharacter.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "HAL/PlatformMemory.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Effects/PRFXComponentPoolManager.h"
+#include "Effects/PRCompositeEffect.h"
+#include "Data/PREffectPresetDataAsset.h"
+#include "Subsystems/PREffectSpawnBudgetSubsystem.h"
+#include "Scalability.h"
+#include "UObject/UObjectIterator.h"
+
+/** 두 NiagaraPoolingBackend의 Spawn 비용, 메모리, GameThread 시간을 비교하는 콘솔 명령어입니다. ex) pr.FX.NiagaraPoolingBenchmark /Game/Effects/NS_Hit.NS_Hit 100 */
+static FAutoConsoleCommandWithWorldAndArgs GPRNiagaraPoolingBenchmarkCommand(
+	TEXT("pr.FX.NiagaraPoolingBenchmark"),
+	TEXT("Compares Actor and NiagaraComponentPool backends. Usage: pr.FX.NiagaraPoolingBenchmark <NiagaraSystemPath> [SpawnCount]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if(Args.IsEmpty() || !World || !World->GetFirstPlayerController())
+		{
+			return;
+		}
+
+		UNiagaraSystem* NiagaraSystem = LoadObject<UNiagaraSystem>(nullptr, *Args[0]);
+		const int32 SpawnCount = Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 100;
+		APRBaseCharacter* PlayerCharacter = Cast<APRBaseCharacter>(World->GetFirstPlayerController()->GetPawn());
+		if(NiagaraSystem && IsValid(PlayerCharacter) && PlayerCharacter->GetEffectSystem())
+		{
+			PlayerCharacter->GetEffectSystem()->RunNiagaraPoolingBenchmark(NiagaraSystem, FMath::Max(SpawnCount, 1));
+		}
+	}));
+
+/** 이펙트 품질 단계의 PoolSizeScale 대신 사용할 값입니다. 0보다 작을 경우 품질 단계의 값을 사용합니다. */
+static TAutoConsoleVariable<float> CVarPRFXPoolSizeScale(
+	TEXT("pr.FX.PoolSizeScale"),
+	-1.0f,
+	TEXT("Overrides the effect pool size scale of the current effects quality. Negative uses the quality setting."),
+	ECVF_Scalability);
+
+/** 이펙트 품질 단계의 MaxPoolSize 대신 사용할 값입니다. 0보다 작거나 같을 경우 품질 단계의 값을 사용합니다. */
+static TAutoConsoleVariable<int32> CVarPRFXMaxPoolSize(
+	TEXT("pr.FX.MaxPoolSize"),
+	0,
+	TEXT("Overrides the hard cap of effects per pool of the current effects quality. 0 uses the quality setting."),
+	ECVF_Scalability);
+
+/** 이펙트 품질 단계의 SpawnProbability 대신 사용할 값입니다. 0보다 작을 경우 품질 단계의 값을 사용합니다. */
+static TAutoConsoleVariable<float> CVarPRFXSpawnProbability(
+	TEXT("pr.FX.SpawnProbability"),
+	-1.0f,
+	TEXT("Overrides the spawn probability of effects spawned at a location. Negative uses the quality setting."),
+	ECVF_Scalability);
+
+/** sg.EffectsQuality 또는 pr.FX 콘솔 변수가 바뀌면 게임 월드의 모든 EffectSystem에 설정 값을 다시 적용합니다. */
+static void OnPREffectScalabilityChanged()
+{
+	for(TObjectIterator<UPREffectSystemComponent> It; It; ++It)
+	{
+		UPREffectSystemComponent* EffectSystem = *It;
+		if(IsValid(EffectSystem) && !EffectSystem->IsTemplate() && EffectSystem->GetWorld() && EffectSystem->GetWorld()->IsGameWorld())
+		{
+			EffectSystem->RefreshEffectScalability();
+		}
+	}
+}
+
+static FAutoConsoleVariableSink GPREffectScalabilitySink(FConsoleCommandDelegate::CreateStatic(&OnPREffectScalabilityChanged));
 
 UPREffectSystemComponent::UPREffectSystemComponent()
 {
-	// NiagaraSystem
+	// EffectSpawnBudget
+	bEnableEffectSpawnBudget = true;
+	EffectSpawnBudgetSettings = FPREffectSpawnBudgetSettings();
+	EffectSpawnBudgetStats = FPREffectSpawnBudgetStats();
+	QueuedEffectSpawnRequests.Empty();
+	bSkipEffectSpawnBudget = false;
+	DispatchingEffectIntensity = 1.0f;
+	
+	// EffectSignificance
+	bEnableEffectSignificance = true;
+	EffectSignificanceSettings = FPREffectSignificanceSettings();
+	EffectSignificanceStats = FPREffectSignificanceStats();
+	DelayedEffectSpawnRequests.Empty();
+	bSkipEffectSignificance = false;
+
+	// EffectSpawnRequest
+	NextEffectSpawnRequestId = 1;
+	DispatchingEffectSpawnRequestId = 0;
+	
+	// FXComponentPool
+	ParticlePoolingBackend = EPREffectPoolingBackend::EffectPoolingBackend_Actor;
+	FXComponentPoolManager = nullptr;
+	
+	// NiagaraPoolingBackend
+	NiagaraPoolingBackend = EPREffectPoolingBackend::EffectPoolingBackend_Actor;
+	ActivePooledNiagaraComponents.Empty();
+	ActivePooledNiagaraComponentCounts.Empty();
+	BenchmarkNiagaraComponents.Empty();
+	bSkipEffectSpawnGates = false;
+	DispatchingNiagaraParameters = nullptr;
+
+	// EffectScalability
+	EffectScalabilitySettings.Empty();
+	EffectScalabilitySettings.Emplace(0.5f, 8, 0.5f);		// Low
+	EffectScalabilitySettings.Emplace(0.75f, 16, 0.75f);	// Medium
+	EffectScalabilitySettings.Emplace(1.0f, 24, 1.0f);		// High
+	EffectScalabilitySettings.Emplace(1.0f, 32, 1.0f);		// Epic
+	EffectScalabilitySettings.Emplace(1.25f, 48, 1.0f);		// Cinematic
+	AppliedEffectScalabilitySettings = FPREffectScalabilitySettings();
+	bSkipEffectSpawnProbability = false;
+
+	// NiagaraWarmUp
+	bWarmUpNiagaraEffectPool = true;
+	WarmUpTickCount = 2;
+	WarmUpTickDelta = 1.0f / 30.0f;
+	FirstUseHitchThreshold = 2.0f;
+	NiagaraWarmUpStats = FPRNiagaraWarmUpStats();
+	NiagaraFirstUseTimes.Empty();
+	WarmedNiagaraSystems.Empty();
+
+	// CompositeEffect
+	CompositeEffectPool.Empty();
+	bDispatchingEffectPreset = false;
+
+	// AttachedEffect
+	AttachParentCheckInterval = 0.2f;
+	AttachedEffects.Empty();
+	AttachedFXComponents.Empty();
+
+	// EffectPool
 	NiagaraPoolSettingsDataTable = nullptr;
-	NiagaraPool = FPRNiagaraEffectObjectPool();
-	ActivateNiagaraIndexList = FPRActivateNiagaraEffectIndexList();
-	UsedNiagaraIndexList = FPRUsedNiagaraEffectIndexList();
-	DynamicDestroyNiagaraList = FPRDynamicDestroyNiagaraEffectList();
-
-	// ParticleSystem
 	ParticlePoolSettingsDataTable = nullptr;
-	ParticlePool = FPRParticleEffectObjectPool();
-	ActivateParticleIndexList = FPRActivateParticleEffectIndexList();
-	UsedParticleIndexList = FPRUsedParticleEffectIndexList();
-	DynamicDestroyParticleList = FPRDynamicDestroyParticleEffectList();
+	EffectPoolSettingsIndex.Empty();
+	EffectPool = FPREffectObjectPool();
+	ActivateEffectIndexList = FPRActivateEffectIndexList();
+	UsedEffectIndexList = FPRUsedEffectIndexList();
+	DynamicDestroyEffectList = FPRDynamicDestroyEffectList();
+}
+
+void UPREffectSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if(!DelayedEffectSpawnRequests.IsEmpty())
+	{
+		ProcessDelayedEffectSpawnRequests(DeltaTime);
+	}
 }
 
 #pragma region PRBaseObjectPoolSystem
 void UPREffectSystemComponent::InitializeObjectPool()
 {
-	InitializeNiagaraPool();
-	InitializeParticlePool();
+	InitializeEffectPool();
 }
 
 void UPREffectSystemComponent::ClearAllObjectPool()
 {
-	ClearAllNiagaraPool();
-	ClearAllParticlePool();
+	// 데이터 테이블의 변경 델리게이트에 바인딩된 함수를 제거합니다.
+	if(NiagaraPoolSettingsDataTable)
+	{
+		NiagaraPoolSettingsDataTable->OnDataTableChanged().Remove(NiagaraPoolSettingsChangedHandle);
+	}
+	NiagaraPoolSettingsChangedHandle.Reset();
+	
+	if(ParticlePoolSettingsDataTable)
+	{
+		ParticlePoolSettingsDataTable->OnDataTableChanged().Remove(ParticlePoolSettingsChangedHandle);
+	}
+	ParticlePoolSettingsChangedHandle.Reset();
+	
+	// 부착된 이펙트의 목록과 타이머를 초기화합니다.
+	AttachedEffects.Empty();
+	AttachedFXComponents.Empty();
+	if(GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(AttachParentCheckTimerHandle);
+	}
+	
+	// 지연한 Spawn 요청과 예산을 초과하여 미룬 요청을 제거하고, 결과를 기다리는 호출자에게 Spawn하지 않았음을 전달합니다.
+	TArray<int32> PendingRequestIds;
+	for(const FPRDelayedEffectSpawnRequest& DelayedRequest : DelayedEffectSpawnRequests)
+	{
+		PendingRequestIds.Emplace(DelayedRequest.RequestId);
+	}
+	for(const FPRDelayedEffectSpawnRequest& QueuedRequest : QueuedEffectSpawnRequests)
+	{
+		PendingRequestIds.Emplace(QueuedRequest.RequestId);
+	}
+	DelayedEffectSpawnRequests.Empty();
+	QueuedEffectSpawnRequests.Empty();
+	for(const int32 PendingRequestId : PendingRequestIds)
+	{
+		ResolveEffectSpawnRequest(PendingRequestId, nullptr);
+	}
+	
+	ReleaseAllPooledNiagaraComponents();
+	ClearAllEffectPool();
+
+	Super::ClearAllObjectPool();
 }
-#pragma endregion 
 
-#pragma region NiagaraSystem
-void UPREffectSystemComponent::InitializeNiagaraPool()
+void UPREffectSystemComponent::AdoptBakedPoolActors()
 {
-	ClearAllNiagaraPool();
+	if(!GetPROwner())
+	{
+		return;
+	}
 	
-	// NiagaraSystemPoolSettings 데이터 테이블을 기반으로 NiagaraSystemObjectPool을 생성합니다.
-	if(NiagaraPoolSettingsDataTable)
+	// EffectPool에 미리 배치된 NiagaraEffect와 ParticleEffect를 추가합니다.
+	for(auto& PoolEntry : EffectPool.Pool)
 	{
-		TArray<FName> RowNames = NiagaraPoolSettingsDataTable->GetRowNames();
-		for(const FName& RowName : RowNames)
+		// 언로드된 레벨에 미리 배치되었던 이펙트는 제거되었으므로 Pool에서 제외합니다.
+		PoolEntry.Value.PooledEffects.RemoveAll([](const TObjectPtr<APREffect>& PooledEffect)
+		{
+			return !IsValid(PooledEffect);
+		});
+		
+		// 미리 배치된 이펙트는 이펙트 품질 단계를 적용한 Pool의 크기까지만 추가합니다.
+		const FPREffectPoolSettings* EffectSettings = EffectPoolSettingsIndex.Find(PoolEntry.Key);
+		const int32 TargetPoolSize = GetScaledPoolSize(EffectSettings ? EffectSettings->PoolSize : DynamicPoolSize);
+		if(PoolEntry.Value.PooledEffects.Num() >= TargetPoolSize)
 		{
-			FPRNiagaraEffectPoolSettings* NiagaraSettings = NiagaraPoolSettingsDataTable->FindRow<FPRNiagaraEffectPoolSettings>(RowName, FString(""));
-			if(NiagaraSettings)
+			continue;
+		}
+		
+		TSet<int32> UsedIndexes;
+		for(const auto& PooledEffect : PoolEntry.Value.PooledEffects)
+		{
+			UsedIndexes.Add(GetPoolIndex(PooledEffect));
+		}
+
+		FPRUsedIndexList* UsedIndexList = UsedEffectIndexList.List.Find(PoolEntry.Key);
+		if(UsedIndexList)
+		{
+			UsedIndexes.Append(UsedIndexList->Indexes);
+		}
+
+		while(PoolEntry.Value.PooledEffects.Num() < TargetPoolSize)
+		{
+			APREffect* BakedEffect = Cast<APREffect>(ClaimBakedPoolActor(PoolEntry.Key));
+			if(!BakedEffect)
+			{
+				break;
+			}
+			
+			const int32 NewIndex = FindAvailableIndex(UsedIndexes);
+			UsedIndexes.Add(NewIndex);
+			if(UsedIndexList)
 			{
-				CreateNiagaraPool(*NiagaraSettings);
+				UsedIndexList->Indexes.Add(NewIndex);
 			}
+
+			AdoptBakedEffect(BakedEffect, NewIndex);
+			PoolEntry.Value.PooledEffects.Emplace(BakedEffect);
 		}
 	}
 }
 
-void UPREffectSystemComponent::ClearAllNiagaraPool()
+int32 UPREffectSystemComponent::GetPoolCapacity(UObject* PoolKey) const
 {
-	ActivateNiagaraIndexList.List.Empty();
-	UsedNiagaraIndexList.List.Empty();
-	ClearDynamicDestroyNiagaraList(DynamicDestroyNiagaraList);
-	ClearNiagaraPool(NiagaraPool);
+	const FPREffectPool* PoolEntry = EffectPool.Pool.Find(Cast<UFXSystemAsset>(PoolKey));
+	if(PoolEntry)
+	{
+		return PoolEntry->PooledEffects.Num();
+	}
+
+	return 0;
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+int32 UPREffectSystemComponent::GetActivatePoolObjectCount(UObject* PoolKey) const
 {
-	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SpawnEffect);
-	if(IsValid(ActivateableNiagaraEffect))
+	const FPRActivateIndexList* ActivateIndexList = ActivateEffectIndexList.List.Find(Cast<UFXSystemAsset>(PoolKey));
+	if(ActivateIndexList)
 	{
-		// NiagaraEffect를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
-		ActivateableNiagaraEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
-	
-		return ActivateableNiagaraEffect;
+		return ActivateIndexList->Indexes.Num();
 	}
 
-	return nullptr;
+	return 0;
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+UObject* UPREffectSystemComponent::GrowPool(UObject* PoolKey)
 {
-	APRNiagaraEffect* ActivateableNiagaraEffect = InitializeNiagaraEffect(SpawnEffect);
-	if(IsValid(ActivateableNiagaraEffect))
+	UFXSystemAsset* EffectAsset = Cast<UFXSystemAsset>(PoolKey);
+	if(!IsCreateEffectPool(EffectAsset) || GetPoolCapacity(EffectAsset) >= AppliedEffectScalabilitySettings.MaxPoolSize)
+	{
+		return nullptr;
+	}
+	
+	// 미리 생성한 이펙트는 동적으로 생성한 이펙트처럼 사용되지 않으면 DynamicLifespan 후에 제거됩니다.
+	APREffect* GrownEffect = SpawnDynamicEffectInWorld(EffectAsset);
+	if(IsValid(GrownEffect))
 	{
-		// NiagaraEffect를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
-		ActivateableNiagaraEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
+		OnDynamicEffectDeactivate(GrownEffect);
+	}
 	
-		return ActivateableNiagaraEffect;
+	return GrownEffect;
+}
+#pragma endregion 
+
+#pragma region AttachedEffect
+void UPREffectSystemComponent::RegisterAttachedEffect(APREffect* AttachedEffect, USceneComponent* AttachParent)
+{
+	if(!GetWorld() || !IsValid(AttachedEffect) || !IsValid(AttachParent))
+	{
+		return;
 	}
 
-	return nullptr;
+	AttachedEffects.Emplace(AttachedEffect, AttachParent);
+	StartAttachParentCheckTimer();
+}
+
+void UPREffectSystemComponent::UnregisterAttachedEffect(APREffect* AttachedEffect)
+{
+	AttachedEffects.Remove(AttachedEffect);
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::GetActivateableNiagaraEffect(UNiagaraSystem* NiagaraSystem)
+void UPREffectSystemComponent::RegisterAttachedFXComponent(UFXSystemComponent* AttachedFXComponent, USceneComponent* AttachParent)
 {
-	// NiagaraSystem이 유효하지 않을 경우 nullptr을 반환합니다.
-	if(!NiagaraSystem)
+	if(!GetWorld() || !IsValid(AttachedFXComponent) || !IsValid(AttachParent))
 	{
-		return nullptr;
+		return;
 	}
 
-	// 해당 NiagaraSystem에 해당하는 Pool이 생성되었는지 확인하고, 없으면 생성합니다.
-	if(!IsCreateNiagaraPool(NiagaraSystem))
+	AttachedFXComponents.Emplace(AttachedFXComponent, AttachParent);
+	StartAttachParentCheckTimer();
+}
+
+void UPREffectSystemComponent::StartAttachParentCheckTimer()
+{
+	if(GetWorld() && !GetWorld()->GetTimerManager().IsTimerActive(AttachParentCheckTimerHandle))
 	{
-		FPRNiagaraEffectPoolSettings NiagaraPoolSettings = FPRNiagaraEffectPoolSettings(NiagaraSystem, DynamicPoolSize, DynamicLifespan);
-		CreateNiagaraPool(NiagaraPoolSettings);
+		GetWorld()->GetTimerManager().SetTimer(AttachParentCheckTimerHandle, this, &UPREffectSystemComponent::ReclaimOrphanedEffects, AttachParentCheckInterval, true);
 	}
+}
 
-	// NiagaraPool에서 해당 NiagaraSystem의 Pool을 얻습니다.
-	FPRNiagaraEffectPool* PoolEntry = NiagaraPool.Pool.Find(NiagaraSystem);
-	if(!PoolEntry)
+void UPREffectSystemComponent::OnPooledFXComponentDeactivate(UFXSystemComponent* FXComponent)
+{
+	// FXComponentPoolManager는 월드에서 공유하므로 Pool에 반환된 FXComponent를 다른 곳에서 다시 사용하기 전에 목록에서 제거합니다.
+	AttachedFXComponents.Remove(FXComponent);
+}
+
+void UPREffectSystemComponent::ReclaimOrphanedEffects()
+{
+	TArray<APREffect*> OrphanedEffects;
+	for(auto It = AttachedEffects.CreateIterator(); It; ++It)
 	{
-		// 지정된 NiagaraSystem가 없으면 nullptr을 반환합니다.
-		return nullptr;
+		APREffect* AttachedEffect = It.Key();
+		
+		// 이미 비활성화된 이펙트는 목록에서 제거합니다.
+		if(!IsValid(AttachedEffect) || !IsActivateObject(AttachedEffect))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 부착된 Component가 제거되거나 숨겨진 이펙트를 찾습니다.
+		if(!IsValidAttachParent(It.Value().Get()))
+		{
+			OrphanedEffects.Emplace(AttachedEffect);
+		}
 	}
 
-	// 활성화할 NiagaraEffect입니다.	
-	APRNiagaraEffect* ActivateableNiagaraEffect = nullptr;
+	for(APREffect* OrphanedEffect : OrphanedEffects)
+	{
+		// 이펙트를 분리한 후 비활성화하여 Pool에 반환합니다.
+		OrphanedEffect->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		DeactivateObject(OrphanedEffect);
+		AttachedEffects.Remove(OrphanedEffect);
+	}
 
-	// PoolEntry에서 활성화되지 않은 NiagaraEffect를 찾습니다.
-	for(const auto& NiagaraEffect : PoolEntry->PooledEffects)
+	TArray<UFXSystemComponent*> OrphanedFXComponents;
+	for(auto It = AttachedFXComponents.CreateIterator(); It; ++It)
 	{
-		if(!IsActivateNiagaraEffect(NiagaraEffect))
+		// 제거되었거나 실행이 끝난 FXSystemComponent는 목록에서 제거합니다.
+		UFXSystemComponent* AttachedFXComponent = It.Key();
+		if(!IsValid(AttachedFXComponent) || !AttachedFXComponent->IsActive())
 		{
-			ActivateableNiagaraEffect = NiagaraEffect;
+			It.RemoveCurrent();
+			continue;
+		}
 
-			break;
+		if(!IsValidAttachParent(It.Value().Get()))
+		{
+			OrphanedFXComponents.Emplace(AttachedFXComponent);
+		}
+	}
+
+	for(UFXSystemComponent* OrphanedFXComponent : OrphanedFXComponents)
+	{
+		// FXSystemComponent를 분리한 후 비활성화하여 Pool에 반환합니다. FXComponentPoolManager는 반환할 때 Manager에 다시 부착합니다.
+		AttachedFXComponents.Remove(OrphanedFXComponent);
+		OrphanedFXComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		DeactivateFXSystem(OrphanedFXComponent);
+	}
+
+	// 확인할 이펙트가 없으면 타이머를 정지합니다.
+	if(AttachedEffects.IsEmpty() && AttachedFXComponents.IsEmpty() && GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(AttachParentCheckTimerHandle);
+	}
+}
+
+bool UPREffectSystemComponent::IsValidAttachParent(const USceneComponent* AttachParent) const
+{
+	if(!IsValid(AttachParent) || AttachParent->IsBeingDestroyed() || !AttachParent->IsRegistered())
+	{
+		return false;
+	}
+
+	// Component를 소유한 액터가 제거 중이거나 숨겨진 경우 유효하지 않습니다.
+	const AActor* ParentOwner = AttachParent->GetOwner();
+	if(IsValid(ParentOwner) && (ParentOwner->IsActorBeingDestroyed() || ParentOwner->IsHidden()))
+	{
+		return false;
+	}
+
+	return AttachParent->IsVisible();
+}
+#pragma endregion
+
+#pragma region EffectSignificance
+EPREffectSignificance UPREffectSystemComponent::EvaluateEffectSignificance(const FVector& Location, const USceneComponent* AttachParent, bool bCanDowngrade) const
+{
+	// 부착할 Component가 숨겨져 있거나 일정 시간 동안 렌더링되지 않았을 경우 Spawn하지 않습니다.
+	if(AttachParent)
+	{
+		if(!AttachParent->IsVisible())
+		{
+			return EPREffectSignificance::EffectSignificance_Cull;
+		}
+
+		// 한 번도 렌더링되지 않은 Component는 방금 Spawn되었을 수 있으므로 렌더링 여부를 판단하지 않습니다.
+		const UPrimitiveComponent* AttachPrimitive = Cast<UPrimitiveComponent>(AttachParent);
+		if(AttachPrimitive && AttachPrimitive->GetLastRenderTime() > 0.0f
+			&& !AttachPrimitive->WasRecentlyRendered(EffectSignificanceSettings.OwnerRecentlyRenderedTime))
+		{
+			return EPREffectSignificance::EffectSignificance_Cull;
+		}
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	float FOVAngle = 0.0f;
+	if(!GetSignificanceViewPoint(ViewLocation, ViewRotation, FOVAngle))
+	{
+		return EPREffectSignificance::EffectSignificance_Spawn;
+	}
+
+	const float DistanceSquared = FVector::DistSquared(ViewLocation, Location);
+	if(DistanceSquared <= FMath::Square(EffectSignificanceSettings.AlwaysSpawnDistance.GetValue()))
+	{
+		return EPREffectSignificance::EffectSignificance_Spawn;
+	}
+
+	if(DistanceSquared > FMath::Square(EffectSignificanceSettings.CullDistance.GetValue()))
+	{
+		return EPREffectSignificance::EffectSignificance_Cull;
+	}
+
+	// 부착하는 이펙트는 부착할 Component의 렌더링 여부로 판단하므로 위치로 Spawn하는 이펙트만 시야를 확인합니다.
+	if(!AttachParent)
+	{
+		const float ViewConeHalfAngle = FMath::Clamp(FOVAngle * 0.5f + EffectSignificanceSettings.ViewConeMarginAngle, 0.0f, 180.0f);
+		const FVector DirectionToEffect = (Location - ViewLocation).GetSafeNormal();
+		if(FVector::DotProduct(ViewRotation.Vector(), DirectionToEffect) < FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle)))
+		{
+			return EffectSignificanceSettings.MaxDelayTime > 0.0f ? EPREffectSignificance::EffectSignificance_Delay : EPREffectSignificance::EffectSignificance_Cull;
 		}
 	}
 
-	// PoolEntry의 모든 NiagaraEffect가 활성화되었을 경우 새로운 NiagaraEffect를 생성합니다.
-	if(!ActivateableNiagaraEffect)
+	if(bCanDowngrade && DistanceSquared > FMath::Square(EffectSignificanceSettings.DowngradeDistance.GetValue()))
+	{
+		return EPREffectSignificance::EffectSignificance_Downgrade;
+	}
+
+	return EPREffectSignificance::EffectSignificance_Spawn;
+}
+
+void UPREffectSystemComponent::ResetEffectSignificanceStats()
+{
+	EffectSignificanceStats = FPREffectSignificanceStats();
+}
+
+bool UPREffectSystemComponent::ApplyEffectSignificance(UFXSystemAsset*& SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, const USceneComponent* AttachParent, bool bEffectAutoActivate, bool bReset)
+{
+	if(!bEnableEffectSignificance || bSkipEffectSignificance || !SpawnEffect)
+	{
+		return true;
+	}
+
+	const FPREffectPoolSettings EffectSettings = GetEffectPoolSettingsFromDataTable(SpawnEffect);
+	const EPREffectSignificance Significance = EvaluateEffectSignificance(Location, AttachParent, EffectSettings.DowngradeEffectAsset != nullptr);
+	RecordEffectSignificance(Significance);
+
+	switch(Significance)
 	{
-		ActivateableNiagaraEffect = SpawnDynamicNiagaraEffectInWorld(NiagaraSystem);
+	case EPREffectSignificance::EffectSignificance_Downgrade:
+		// 이펙트 프리셋은 대체 이펙트 없이 그대로 Spawn합니다.
+		if(!bDispatchingEffectPreset)
+		{
+			SpawnEffect = EffectSettings.DowngradeEffectAsset;
+		}
+		return true;
+	case EPREffectSignificance::EffectSignificance_Delay:
+		{
+			// 지연한 요청은 하나의 이펙트로 다시 Spawn되므로 이펙트 프리셋은 지연하지 않고 Spawn하지 않습니다.
+			if(bDispatchingEffectPreset)
+			{
+				return false;
+			}
+			
+			FPRDelayedEffectSpawnRequest DelayedRequest;
+			DelayedRequest.EffectAsset = SpawnEffect;
+			DelayedRequest.Location = Location;
+			DelayedRequest.Rotation = Rotation;
+			DelayedRequest.Scale = Scale;
+			DelayedRequest.bEffectAutoActivate = bEffectAutoActivate;
+			DelayedRequest.bReset = bReset;
+			DelayedRequest.RemainingDelayTime = EffectSignificanceSettings.MaxDelayTime;
+			DelayedRequest.RequestId = IssueEffectSpawnRequestId();
+			if(DispatchingNiagaraParameters)
+			{
+				DelayedRequest.NiagaraParameters = *DispatchingNiagaraParameters;
+			}
+			
+			DelayedEffectSpawnRequests.Emplace(DelayedRequest);
+		}
+		return false;
+	case EPREffectSignificance::EffectSignificance_Cull:
+		return false;
+	default:
+		return true;
+	}
+}
+
+void UPREffectSystemComponent::RecordEffectSignificance(EPREffectSignificance Significance)
+{
+	EffectSignificanceStats.EvaluatedCount++;
+	
+	switch(Significance)
+	{
+	case EPREffectSignificance::EffectSignificance_Spawn:
+		EffectSignificanceStats.SpawnedCount++;
+		break;
+	case EPREffectSignificance::EffectSignificance_Downgrade:
+		EffectSignificanceStats.DowngradedCount++;
+		break;
+	case EPREffectSignificance::EffectSignificance_Delay:
+		EffectSignificanceStats.DelayedCount++;
+		break;
+	case EPREffectSignificance::EffectSignificance_Cull:
+		EffectSignificanceStats.CulledCount++;
+		break;
+	default:
+		break;
 	}
+}
+
+void UPREffectSystemComponent::ProcessDelayedEffectSpawnRequests(float DeltaTime)
+{
+	// 지연한 요청을 Spawn하는 동안 다시 지연 목록에 추가되지 않도록 Significance 평가를 건너뜁니다.
+	// Spawn 확률은 요청할 때 이미 통과하였으므로 다시 적용하지 않습니다.
+	TGuardValue<bool> SkipEffectSignificanceGuard(bSkipEffectSignificance, true);
+	TGuardValue<bool> SkipEffectSpawnProbabilityGuard(bSkipEffectSpawnProbability, true);
+
+	// 델리게이트에서 요청을 취소해도 순회가 어긋나지 않도록 결과는 순회가 끝난 후 전달합니다.
+	TArray<TPair<int32, UFXSystemComponent*>> ResolvedRequests;
 	
-	// 동적으로 생성된 NiagaraEffect일 경우 DynamicEffectDestroyTimer를 정지합니다.
-	if(IsDynamicNiagaraEffect(ActivateableNiagaraEffect))
+	for(int32 Index = DelayedEffectSpawnRequests.Num() - 1; Index >= 0; Index--)
 	{
-		FPRDynamicDestroyObject* DynamicNiagaraList = DynamicDestroyNiagaraList.List.Find(ActivateableNiagaraEffect->GetNiagaraEffectAsset());
-		if(DynamicNiagaraList)
+		FPRDelayedEffectSpawnRequest& DelayedRequest = DelayedEffectSpawnRequests[Index];
+		DelayedRequest.RemainingDelayTime -= DeltaTime;
+
+		UFXSystemAsset* DowngradeEffectAsset = GetEffectPoolSettingsFromDataTable(DelayedRequest.EffectAsset).DowngradeEffectAsset;
+		const EPREffectSignificance Significance = EvaluateEffectSignificance(DelayedRequest.Location, nullptr, DowngradeEffectAsset != nullptr);
+		
+		// 아직 시야 밖에 있고 기다릴 시간이 남아있으면 다음 Tick에 다시 평가합니다.
+		if(Significance == EPREffectSignificance::EffectSignificance_Delay && DelayedRequest.RemainingDelayTime > 0.0f)
 		{
-			FTimerHandle* DynamicDestroyTimer = DynamicNiagaraList->TimerHandles.Find(ActivateableNiagaraEffect);
-			if(DynamicDestroyTimer)
+			continue;
+		}
+
+		const FPRDelayedEffectSpawnRequest Request = DelayedRequest;
+		DelayedEffectSpawnRequests.RemoveAtSwap(Index);
+
+		if(Significance == EPREffectSignificance::EffectSignificance_Delay || Significance == EPREffectSignificance::EffectSignificance_Cull)
+		{
+			EffectSignificanceStats.CulledCount++;
+			if(Significance == EPREffectSignificance::EffectSignificance_Delay)
 			{
-				GetWorld()->GetTimerManager().ClearTimer(*DynamicDestroyTimer);
+				EffectSignificanceStats.DelayExpiredCount++;
 			}
+
+			ResolvedRequests.Emplace(Request.RequestId, nullptr);
+			continue;
 		}
+
+		EffectSignificanceStats.DelayedSpawnedCount++;
+		const bool bDowngrade = Significance == EPREffectSignificance::EffectSignificance_Downgrade;
+		
+		// 예산을 초과하여 다시 미룰 경우 같은 번호로 미루도록 요청의 번호를 전달합니다.
+		TGuardValue<int32> DispatchingEffectSpawnRequestIdGuard(DispatchingEffectSpawnRequestId, Request.RequestId);
+		TGuardValue<const FPRNiagaraParameterBlock*> DispatchingNiagaraParametersGuard(DispatchingNiagaraParameters, Request.NiagaraParameters.IsEmpty() ? nullptr : &Request.NiagaraParameters);
+		UFXSystemComponent* SpawnedComponent = SpawnFXSystemAtLocation(bDowngrade ? DowngradeEffectAsset : Request.EffectAsset.Get(), Request.Location, Request.Rotation, Request.Scale, Request.bEffectAutoActivate, Request.bReset);
+		ResolvedRequests.Emplace(Request.RequestId, SpawnedComponent);
+	}
+
+	for(const TPair<int32, UFXSystemComponent*>& ResolvedRequest : ResolvedRequests)
+	{
+		ResolveEffectSpawnRequest(ResolvedRequest.Key, ResolvedRequest.Value);
+	}
+}
+
+bool UPREffectSystemComponent::GetSignificanceViewPoint(FVector& OutViewLocation, FRotator& OutViewRotation, float& OutFOVAngle) const
+{
+	const APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	if(!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		return false;
 	}
+
+	PlayerController->PlayerCameraManager->GetCameraViewPoint(OutViewLocation, OutViewRotation);
+	OutFOVAngle = PlayerController->PlayerCameraManager->GetFOVAngle();
 	
-	return ActivateableNiagaraEffect;
+	return true;
+}
+#pragma endregion
+
+#pragma region EffectSpawnBudget
+void UPREffectSystemComponent::ResetEffectSpawnBudgetStats()
+{
+	EffectSpawnBudgetStats = FPREffectSpawnBudgetStats();
 }
 
-bool UPREffectSystemComponent::IsActivateNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const
+bool UPREffectSystemComponent::ApplyEffectSpawnBudget(UFXSystemAsset* SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAttached, bool bEffectAutoActivate, bool bReset)
 {
-	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 객체가 아니면 false를 반환합니다.
-	if(!IsValid(NiagaraEffect) || !IsPoolableObject(NiagaraEffect))
+	if(!bEnableEffectSpawnBudget || bSkipEffectSpawnBudget || !SpawnEffect || !GetWorld())
+	{
+		return true;
+	}
+
+	UPREffectSpawnBudgetSubsystem* EffectSpawnBudgetSubsystem = GetWorld()->GetSubsystem<UPREffectSpawnBudgetSubsystem>();
+	if(!EffectSpawnBudgetSubsystem)
+	{
+		return true;
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// 가까운 위치와 시간에 Spawn한 같은 이펙트가 있으면 기존 이펙트의 세기를 높입니다.
+	// 병합된 이펙트는 먼저 Spawn한 요청이 소유하므로 이 요청의 호출자에게는 반환하지 않습니다.
+	if(!bAttached && !bDispatchingEffectPreset && EffectSpawnBudgetSettings.CoalesceRadius > 0.0f)
+	{
+		float CoalescedIntensity = 1.0f;
+		UFXSystemComponent* CoalescedComponent = EffectSpawnBudgetSubsystem->CoalesceEffectSpawn(SpawnEffect, Location, EffectSpawnBudgetSettings.CoalesceRadius, CoalescedIntensity);
+		if(CoalescedComponent)
+		{
+			ApplyEffectIntensity(CoalescedComponent, CoalescedIntensity);
+			EffectSpawnBudgetStats.CoalescedCount++;
+			
+			return false;
+		}
+
+		// 미룬 요청 중에 가까운 같은 이펙트가 있으면 미룬 요청의 세기를 높입니다.
+		const float CoalesceRadiusSquared = FMath::Square(EffectSpawnBudgetSettings.CoalesceRadius);
+		for(FPRDelayedEffectSpawnRequest& QueuedRequest : QueuedEffectSpawnRequests)
+		{
+			if(QueuedRequest.EffectAsset == SpawnEffect && FVector::DistSquared(QueuedRequest.Location, Location) <= CoalesceRadiusSquared)
+			{
+				QueuedRequest.Intensity += 1.0f;
+				EffectSpawnBudgetStats.CoalescedCount++;
+				
+				return false;
+			}
+		}
+	}
+
+	EPREffectSpawnPriority SpawnPriority = EPREffectSpawnPriority::EffectSpawnPriority_Normal;
+	int32 MaxSpawnsPerFrame = 0;
+	GetEffectSpawnBudgetSettings(SpawnEffect, SpawnPriority, MaxSpawnsPerFrame);
+	if(SpawnPriority == EPREffectSpawnPriority::EffectSpawnPriority_High || HasEffectSpawnBudget(SpawnEffect, MaxSpawnsPerFrame))
+	{
+		return true;
+	}
+
+	// 예산을 초과한 요청은 우선순위가 낮거나 부착하는 이펙트나 이펙트 프리셋이거나 대기 목록이 가득 찼으면 버립니다.
+	if(SpawnPriority == EPREffectSpawnPriority::EffectSpawnPriority_Low || bAttached || bDispatchingEffectPreset
+		|| QueuedEffectSpawnRequests.Num() >= EffectSpawnBudgetSettings.MaxQueuedRequests)
 	{
+		EffectSpawnBudgetStats.DroppedCount++;
+		
 		return false;
 	}
 
-	// NiagaraSystem에 해당하는 활성화된 Index 목록을 찾습니다.
-	const FPRActivateIndexList* IndexList = ActivateNiagaraIndexList.List.Find(NiagaraEffect->GetNiagaraEffectAsset());
-	if(IndexList)
+	FPRDelayedEffectSpawnRequest QueuedRequest;
+	QueuedRequest.EffectAsset = SpawnEffect;
+	QueuedRequest.Location = Location;
+	QueuedRequest.Rotation = Rotation;
+	QueuedRequest.Scale = Scale;
+	QueuedRequest.bEffectAutoActivate = bEffectAutoActivate;
+	QueuedRequest.bReset = bReset;
+	QueuedRequest.Priority = SpawnPriority;
+	QueuedRequest.RequestTime = CurrentTime;
+	QueuedRequest.RequestId = IssueEffectSpawnRequestId();
+	if(DispatchingNiagaraParameters)
 	{
-		// 객체의 PoolIndex를 가져오고 객체가 활성화된 상태인지 확인합니다.
-		const int32 PooledIndex = GetPoolIndex(NiagaraEffect);
-		const bool bIsNiagaraEffectActivated = IsActivateObject(NiagaraEffect);
+		QueuedRequest.NiagaraParameters = *DispatchingNiagaraParameters;
+	}
+	
+	QueuedEffectSpawnRequests.Emplace(QueuedRequest);
+	EffectSpawnBudgetStats.QueuedCount++;
 
-		// Index 목록에 해당 Index가 포함되어 있고, 객체가 활성화된 상태이면 true를 반환합니다.
-		return IndexList->Indexes.Contains(PooledIndex) && bIsNiagaraEffectActivated;
+	// 다음 프레임에 미룬 요청을 Spawn합니다.
+	if(QueuedEffectSpawnRequests.Num() == 1)
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UPREffectSystemComponent::ProcessQueuedEffectSpawnRequests);
 	}
 
-	// 위 조건을 모두 만족하지 않으면 false를 반환합니다.
 	return false;
 }
 
-bool UPREffectSystemComponent::IsCreateNiagaraPool(UNiagaraSystem* NiagaraSystem) const
+void UPREffectSystemComponent::RecordEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, UFXSystemComponent* EffectComponent, bool bAttached)
 {
-	return NiagaraPool.Pool.Contains(NiagaraSystem);
+	if(!bEnableEffectSpawnBudget || !SpawnEffect || !GetWorld())
+	{
+		return;
+	}
+
+	// 재사용된 이펙트의 세기를 초기화하거나 미룬 요청에 병합된 세기를 전달합니다.
+	ApplyEffectIntensity(EffectComponent, DispatchingEffectIntensity);
+
+	UPREffectSpawnBudgetSubsystem* EffectSpawnBudgetSubsystem = GetWorld()->GetSubsystem<UPREffectSpawnBudgetSubsystem>();
+	if(EffectSpawnBudgetSubsystem)
+	{
+		// 부착한 이펙트는 병합 대상으로 등록하지 않습니다.
+		const bool bCoalesceTarget = !bAttached && EffectSpawnBudgetSettings.CoalesceRadius > 0.0f;
+		EffectSpawnBudgetSubsystem->RecordEffectSpawn(SpawnEffect, Location, EffectComponent, DispatchingEffectIntensity, bCoalesceTarget ? EffectSpawnBudgetSettings.CoalesceTimeWindow : 0.0f);
+	}
 }
 
-bool UPREffectSystemComponent::IsCreateActivateNiagaraIndexList(UNiagaraSystem* NiagaraSystem) const
+bool UPREffectSystemComponent::HasEffectSpawnBudget(UFXSystemAsset* SpawnEffect, int32 MaxSpawnsPerFrame) const
 {
-	return ActivateNiagaraIndexList.List.Contains(NiagaraSystem);
+	const UPREffectSpawnBudgetSubsystem* EffectSpawnBudgetSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UPREffectSpawnBudgetSubsystem>() : nullptr;
+	if(!EffectSpawnBudgetSubsystem)
+	{
+		return true;
+	}
+
+	const int32 SystemMaxSpawnsPerFrame = MaxSpawnsPerFrame > 0 ? MaxSpawnsPerFrame : EffectSpawnBudgetSettings.DefaultMaxSpawnsPerSystemPerFrame;
+	
+	return EffectSpawnBudgetSubsystem->HasEffectSpawnBudget(SpawnEffect, EffectSpawnBudgetSettings.GlobalMaxSpawnsPerFrame, SystemMaxSpawnsPerFrame);
 }
 
-bool UPREffectSystemComponent::IsCreateUsedNiagaraIndexList(UNiagaraSystem* NiagaraSystem) const
+void UPREffectSystemComponent::GetEffectSpawnBudgetSettings(UFXSystemAsset* SpawnEffect, EPREffectSpawnPriority& OutPriority, int32& OutMaxSpawnsPerFrame) const
 {
-	return UsedNiagaraIndexList.List.Contains(NiagaraSystem);
+	OutPriority = EPREffectSpawnPriority::EffectSpawnPriority_Normal;
+	OutMaxSpawnsPerFrame = 0;
+	
+	const FPREffectPoolSettings* EffectSettings = EffectPoolSettingsIndex.Find(SpawnEffect);
+	if(EffectSettings)
+	{
+		OutPriority = EffectSettings->SpawnPriority;
+		OutMaxSpawnsPerFrame = EffectSettings->MaxSpawnsPerFrame;
+	}
 }
 
-bool UPREffectSystemComponent::IsDynamicNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const
+void UPREffectSystemComponent::ApplyEffectIntensity(UFXSystemComponent* EffectComponent, float Intensity) const
 {
-	// 주어진 객체가 유효한 풀링 가능한 객체인지 확인합니다.
-	if(!IsPoolableObject(NiagaraEffect))
+	if(!IsValid(EffectComponent) || EffectSpawnBudgetSettings.IntensityParameterName.IsNone())
 	{
-		return false;
+		return;
 	}
 
-	const FPRDynamicDestroyObject* DynamicNiagaraList = DynamicDestroyNiagaraList.List.Find(NiagaraEffect->GetNiagaraEffectAsset());
-	if(DynamicNiagaraList)
+	if(UNiagaraComponent* NiagaraComponent = Cast<UNiagaraComponent>(EffectComponent))
 	{
-		return DynamicNiagaraList->TimerHandles.Contains(NiagaraEffect);
+		NiagaraComponent->SetVariableFloat(EffectSpawnBudgetSettings.IntensityParameterName, Intensity);
+	}
+	else if(UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(EffectComponent))
+	{
+		ParticleSystemComponent->SetFloatParameter(EffectSpawnBudgetSettings.IntensityParameterName, Intensity);
 	}
-	
-	return false;
 }
 
-void UPREffectSystemComponent::ClearNiagaraPool(FPRNiagaraEffectObjectPool& TargetNiagaraPool)
+void UPREffectSystemComponent::ProcessQueuedEffectSpawnRequests()
 {
-	// NiagaraPool을 제거합니다.
-	for(auto& PoolEntry : NiagaraPool.Pool)
+	if(QueuedEffectSpawnRequests.IsEmpty() || !GetWorld())
 	{
-		FPRNiagaraEffectPool& Pool = PoolEntry.Value;
-		for(auto& PooledEffect : Pool.PooledEffects)
-		{
-			if(IsValid(PooledEffect))
+		return;
+	}
+
+	// 우선순위가 높은 요청을 먼저, 같은 우선순위에서는 먼저 요청된 것을 먼저 Spawn합니다.
+	QueuedEffectSpawnRequests.StableSort([](const FPRDelayedEffectSpawnRequest& A, const FPRDelayedEffectSpawnRequest& B)
+	{
+		return A.Priority > B.Priority;
+	});
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	TArray<FPRDelayedEffectSpawnRequest> RemainingRequests;
+	TArray<FPRDelayedEffectSpawnRequest> ProcessingRequests = MoveTemp(QueuedEffectSpawnRequests);
+	QueuedEffectSpawnRequests.Reset();
+
+	// 델리게이트에서 요청을 취소하거나 새로 Spawn해도 순회가 어긋나지 않도록 결과는 남은 요청을 다시 보관한 후 전달합니다.
+	TArray<TPair<int32, UFXSystemComponent*>> ResolvedRequests;
+	
+	for(const FPRDelayedEffectSpawnRequest& QueuedRequest : ProcessingRequests)
+	{
+		UFXSystemAsset* QueuedEffect = QueuedRequest.EffectAsset;
+		if(!QueuedEffect)
+		{
+			continue;
+		}
+
+		EPREffectSpawnPriority SpawnPriority = EPREffectSpawnPriority::EffectSpawnPriority_Normal;
+		int32 MaxSpawnsPerFrame = 0;
+		GetEffectSpawnBudgetSettings(QueuedEffect, SpawnPriority, MaxSpawnsPerFrame);
+		if(!HasEffectSpawnBudget(QueuedEffect, MaxSpawnsPerFrame))
+		{
+			// 기다릴 시간이 남아있으면 다음 프레임에 다시 시도합니다.
+			if(CurrentTime - QueuedRequest.RequestTime < EffectSpawnBudgetSettings.MaxQueuedTime)
 			{
-				// Effect를 제거합니다.
-				PooledEffect->ConditionalBeginDestroy();
-				PooledEffect = nullptr;
+				RemainingRequests.Emplace(QueuedRequest);
+			}
+			else
+			{
+				EffectSpawnBudgetStats.DroppedCount++;
+				ResolvedRequests.Emplace(QueuedRequest.RequestId, nullptr);
 			}
+			
+			continue;
+		}
+
+		// 이미 Spawn 확률과 Significance, 예산을 평가한 요청이므로 다시 평가하지 않습니다.
+		TGuardValue<bool> SkipEffectSpawnProbabilityGuard(bSkipEffectSpawnProbability, true);
+		TGuardValue<bool> SkipEffectSignificanceGuard(bSkipEffectSignificance, true);
+		TGuardValue<bool> SkipEffectSpawnBudgetGuard(bSkipEffectSpawnBudget, true);
+		TGuardValue<float> DispatchingEffectIntensityGuard(DispatchingEffectIntensity, QueuedRequest.Intensity);
+		TGuardValue<const FPRNiagaraParameterBlock*> DispatchingNiagaraParametersGuard(DispatchingNiagaraParameters, QueuedRequest.NiagaraParameters.IsEmpty() ? nullptr : &QueuedRequest.NiagaraParameters);
+		UFXSystemComponent* SpawnedComponent = SpawnFXSystemAtLocation(QueuedEffect, QueuedRequest.Location, QueuedRequest.Rotation, QueuedRequest.Scale, QueuedRequest.bEffectAutoActivate, QueuedRequest.bReset);
+		ResolvedRequests.Emplace(QueuedRequest.RequestId, SpawnedComponent);
+		
+		EffectSpawnBudgetStats.QueuedSpawnedCount++;
+	}
+
+	// 예산이 부족하여 남은 요청을 다시 보관하고, 남은 요청이 있으면 다음 프레임에 다시 실행합니다.
+	QueuedEffectSpawnRequests.Append(RemainingRequests);
+	if(!QueuedEffectSpawnRequests.IsEmpty())
+	{
+		GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UPREffectSystemComponent::ProcessQueuedEffectSpawnRequests);
+	}
+
+	for(const TPair<int32, UFXSystemComponent*>& ResolvedRequest : ResolvedRequests)
+	{
+		ResolveEffectSpawnRequest(ResolvedRequest.Key, ResolvedRequest.Value);
+	}
+}
+#pragma endregion
+
+#pragma region EffectSpawnRequest
+FPREffectSpawnHandle UPREffectSystemComponent::RequestFXSystemAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	FPREffectSpawnHandle SpawnHandle;
+	const int32 PendingRequestId = NextEffectSpawnRequestId;
+	SpawnHandle.EffectComponent = SpawnFXSystemAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset);
+
+	// Spawn하지 않고 요청의 번호를 발급하였을 경우 지연한 요청입니다.
+	if(!SpawnHandle.EffectComponent.IsValid() && IsEffectSpawnRequestPending(PendingRequestId))
+	{
+		SpawnHandle.RequestId = PendingRequestId;
+	}
+
+	return SpawnHandle;
+}
+
+bool UPREffectSystemComponent::IsEffectSpawnRequestPending(int32 RequestId) const
+{
+	if(RequestId <= 0)
+	{
+		return false;
+	}
+
+	const auto HasRequestId = [RequestId](const FPRDelayedEffectSpawnRequest& Request)
+	{
+		return Request.RequestId == RequestId;
+	};
+
+	return DelayedEffectSpawnRequests.ContainsByPredicate(HasRequestId) || QueuedEffectSpawnRequests.ContainsByPredicate(HasRequestId);
+}
+
+bool UPREffectSystemComponent::CancelEffectSpawnRequest(int32 RequestId)
+{
+	if(RequestId <= 0)
+	{
+		return false;
+	}
+
+	const auto HasRequestId = [RequestId](const FPRDelayedEffectSpawnRequest& Request)
+	{
+		return Request.RequestId == RequestId;
+	};
+
+	const int32 RemoveCount = DelayedEffectSpawnRequests.RemoveAll(HasRequestId) + QueuedEffectSpawnRequests.RemoveAll(HasRequestId);
+	
+	return RemoveCount > 0;
+}
+
+int32 UPREffectSystemComponent::IssueEffectSpawnRequestId()
+{
+	if(DispatchingEffectSpawnRequestId > 0)
+	{
+		return DispatchingEffectSpawnRequestId;
+	}
+
+	// 0은 지연하지 않은 요청을 나타내므로 발급하지 않습니다.
+	const int32 RequestId = NextEffectSpawnRequestId;
+	NextEffectSpawnRequestId = NextEffectSpawnRequestId == MAX_int32 ? 1 : NextEffectSpawnRequestId + 1;
+	
+	return RequestId;
+}
+
+void UPREffectSystemComponent::ResolveEffectSpawnRequest(int32 RequestId, UFXSystemComponent* EffectComponent)
+{
+	// 다시 지연된 요청은 최종적으로 처리될 때 전달합니다.
+	if(RequestId <= 0 || IsEffectSpawnRequestPending(RequestId))
+	{
+		return;
+	}
+
+	OnEffectSpawnRequestResolvedDelegate.Broadcast(RequestId, EffectComponent);
+}
+#pragma endregion
+
+#pragma region NiagaraPoolingBackend
+UNiagaraComponent* UPREffectSystemComponent::SpawnNiagaraSystemAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<UNiagaraComponent>(SpawnFXSystemAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+UNiagaraComponent* UPREffectSystemComponent::SpawnNiagaraSystemAtLocationWithParameters(UNiagaraSystem* SpawnEffect, const FPRNiagaraParameterBlock& Parameters, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	// Spawn하는 동안 파라미터 블록을 전달하여 어느 Backend를 사용하든 활성화하기 전에 적용되도록 합니다.
+	TGuardValue<const FPRNiagaraParameterBlock*> DispatchingNiagaraParametersGuard(DispatchingNiagaraParameters, Parameters.IsEmpty() ? nullptr : &Parameters);
+	
+	return SpawnNiagaraSystemAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset);
+}
+
+UNiagaraComponent* UPREffectSystemComponent::SpawnNiagaraSystemAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<UNiagaraComponent>(SpawnFXSystemAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+void UPREffectSystemComponent::DeactivateNiagaraSystem(UNiagaraComponent* NiagaraComponent)
+{
+	DeactivateFXSystem(NiagaraComponent);
+}
+
+void UPREffectSystemComponent::SetNiagaraPoolingBackend(EPREffectPoolingBackend NewNiagaraPoolingBackend)
+{
+	NiagaraPoolingBackend = NewNiagaraPoolingBackend;
+}
+
+void UPREffectSystemComponent::RegisterPooledNiagaraComponent(UNiagaraComponent* NiagaraComponent, bool bEffectAutoActivate)
+{
+	if(!IsValid(NiagaraComponent) || !GetWorld())
+	{
+		return;
+	}
+
+	// 실행이 끝나면 엔진의 NiagaraComponent Pool에 반환하도록 바인딩합니다.
+	NiagaraComponent->OnSystemFinished.AddUniqueDynamic(this, &UPREffectSystemComponent::OnPooledNiagaraComponentFinished);
+
+	// PRNiagaraEffect와 같이 데이터 테이블의 EffectLifespan이나 DynamicLifespan이 끝나면 비활성화합니다.
+	FTimerHandle LifespanTimerHandle;
+	const float Lifespan = GetEffectLifespanFromDataTable(NiagaraComponent->GetAsset());
+	if(bEffectAutoActivate && Lifespan > 0.0f)
+	{
+		FTimerDelegate LifespanDelegate = FTimerDelegate::CreateUObject(this, &UPREffectSystemComponent::OnPooledNiagaraComponentLifespanEnd, NiagaraComponent);
+		GetWorld()->GetTimerManager().SetTimer(LifespanTimerHandle, LifespanDelegate, Lifespan, false);
+	}
+
+	ActivePooledNiagaraComponents.Emplace(NiagaraComponent, LifespanTimerHandle);
+	ActivePooledNiagaraComponentCounts.FindOrAdd(NiagaraComponent->GetAsset())++;
+}
+
+bool UPREffectSystemComponent::HasPooledNiagaraComponentCapacity(UNiagaraSystem* NiagaraSystem) const
+{
+	const int32* ActiveCount = ActivePooledNiagaraComponentCounts.Find(NiagaraSystem);
+	
+	return !ActiveCount || *ActiveCount < AppliedEffectScalabilitySettings.MaxPoolSize;
+}
+
+void UPREffectSystemComponent::ReleaseAllPooledNiagaraComponents()
+{
+	if(GetWorld())
+	{
+		for(auto& PooledNiagaraComponent : ActivePooledNiagaraComponents)
+		{
+			GetWorld()->GetTimerManager().ClearTimer(PooledNiagaraComponent.Value);
 		}
+	}
+
+	TArray<TObjectPtr<UNiagaraComponent>> PooledNiagaraComponents;
+	ActivePooledNiagaraComponents.GenerateKeyArray(PooledNiagaraComponents);
+	for(UNiagaraComponent* PooledNiagaraComponent : PooledNiagaraComponents)
+	{
+		if(IsValid(PooledNiagaraComponent))
+		{
+			// 즉시 비활성화하면 OnPooledNiagaraComponentFinished가 실행되어 Pool에 반환됩니다.
+			PooledNiagaraComponent->DeactivateImmediate();
+		}
+	}
+	
+	ActivePooledNiagaraComponents.Empty();
+	ActivePooledNiagaraComponentCounts.Empty();
+	BenchmarkNiagaraComponents.Empty();
+}
+
+void UPREffectSystemComponent::OnPooledNiagaraComponentFinished(UNiagaraComponent* FinishedComponent)
+{
+	if(!IsValid(FinishedComponent))
+	{
+		return;
+	}
+
+	// 재사용되는 NiagaraComponent이므로 바인딩을 해제하고 부착 목록에서 제거합니다.
+	FinishedComponent->OnSystemFinished.RemoveDynamic(this, &UPREffectSystemComponent::OnPooledNiagaraComponentFinished);
+	AttachedFXComponents.Remove(FinishedComponent);
+
+	FTimerHandle* LifespanTimerHandle = ActivePooledNiagaraComponents.Find(FinishedComponent);
+	if(LifespanTimerHandle)
+	{
+		if(GetWorld())
+		{
+			GetWorld()->GetTimerManager().ClearTimer(*LifespanTimerHandle);
+		}
+		
+		if(int32* ActiveCount = ActivePooledNiagaraComponentCounts.Find(FinishedComponent->GetAsset()))
+		{
+			*ActiveCount = FMath::Max(*ActiveCount - 1, 0);
+		}
+	}
+	ActivePooledNiagaraComponents.Remove(FinishedComponent);
+	
+	FinishedComponent->ReleaseToPool();
+}
+
+void UPREffectSystemComponent::OnPooledNiagaraComponentLifespanEnd(UNiagaraComponent* NiagaraComponent)
+{
+	// 이미 Pool에 반환된 NiagaraComponent는 다른 곳에서 사용 중일 수 있으므로 비활성화하지 않습니다.
+	if(ActivePooledNiagaraComponents.Contains(NiagaraComponent) && IsValid(NiagaraComponent))
+	{
+		NiagaraComponent->Deactivate();
+	}
+}
+
+void UPREffectSystemComponent::RunNiagaraPoolingBenchmark(UNiagaraSystem* NiagaraSystem, int32 SpawnCount)
+{
+	if(!NiagaraSystem || !GetWorld())
+	{
+		return;
+	}
+
+	PR_LOG(Log, "Niagara pooling benchmark: %s x %d", *NiagaraSystem->GetName(), SpawnCount);
+	RunNiagaraPoolingBenchmarkStep(NiagaraSystem, SpawnCount, EPREffectPoolingBackend::EffectPoolingBackend_Actor, NiagaraPoolingBackend);
+}
+
+void UPREffectSystemComponent::RunNiagaraPoolingBenchmarkStep(UNiagaraSystem* NiagaraSystem, int32 SpawnCount, EPREffectPoolingBackend BenchmarkBackend, EPREffectPoolingBackend PreviousBackend)
+{
+	if(!NiagaraSystem || !GetWorld() || !GetOwner())
+	{
+		return;
+	}
+
+	NiagaraPoolingBackend = BenchmarkBackend;
+	const FString BackendName = PRCommonEnum::GetEnumDisplayNameToString(TEXT("EPREffectPoolingBackend"), static_cast<uint8>(BenchmarkBackend));
+
+	// Spawn 비용과 메모리 사용량을 측정합니다.
+	// 각 NiagaraPoolingBackend가 같은 수를 Spawn하도록 Spawn 확률, Significance, Spawn 예산을 적용하지 않습니다.
+	const uint64 UsedMemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+	const double SpawnStartTime = FPlatformTime::Seconds();
+	{
+		TGuardValue<bool> SkipEffectSpawnGatesGuard(bSkipEffectSpawnGates, true);
+		for(int32 Index = 0; Index < SpawnCount; Index++)
+		{
+			const FVector SpawnLocation = GetOwner()->GetActorLocation() + FVector(100.0f * (Index % 10), 100.0f * (Index / 10), 0.0f);
+			UNiagaraComponent* SpawnNiagaraComponent = SpawnNiagaraSystemAtLocation(NiagaraSystem, SpawnLocation);
+			if(SpawnNiagaraComponent)
+			{
+				BenchmarkNiagaraComponents.Emplace(SpawnNiagaraComponent);
+			}
+		}
+	}
+	const double SpawnTime = (FPlatformTime::Seconds() - SpawnStartTime) * 1000.0;
+	const int64 UsedMemoryDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(UsedMemoryBefore);
+
+	// Pool의 최대 크기에 의해 Spawn하지 못한 요청이 있을 수 있으므로 실제로 Spawn한 수를 함께 출력합니다.
+	const int32 SpawnedCount = BenchmarkNiagaraComponents.Num();
+	PR_LOG(Log, "[%s] Spawned: %d / %d, Spawn: %.3f ms total, %.4f ms per spawn, Memory: %.2f KB", *BackendName, SpawnedCount, SpawnCount, SpawnTime, SpawnTime / FMath::Max(SpawnedCount, 1), UsedMemoryDelta / 1024.0);
+
+	// 이펙트가 실행 중인 상태의 GameThread 시간을 측정한 후 다음 단계를 실행합니다.
+	FTimerHandle BenchmarkTimerHandle;
+	GetWorld()->GetTimerManager().SetTimer(BenchmarkTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, NiagaraSystem, SpawnCount, SpawnedCount, BenchmarkBackend, PreviousBackend, BackendName]()
+	{
+		PR_LOG(Log, "[%s] GameThread: %.3f ms with %d spawned", *BackendName, FPlatformTime::ToMilliseconds(GGameThreadTime), SpawnedCount);
+
+		for(UNiagaraComponent* BenchmarkNiagaraComponent : BenchmarkNiagaraComponents)
+		{
+			DeactivateNiagaraSystem(BenchmarkNiagaraComponent);
+		}
+		BenchmarkNiagaraComponents.Empty();
+
+		if(BenchmarkBackend == EPREffectPoolingBackend::EffectPoolingBackend_Actor)
+		{
+			RunNiagaraPoolingBenchmarkStep(NiagaraSystem, SpawnCount, EPREffectPoolingBackend::EffectPoolingBackend_NiagaraComponentPool, PreviousBackend);
+		}
+		else if(BenchmarkBackend == EPREffectPoolingBackend::EffectPoolingBackend_NiagaraComponentPool)
+		{
+			RunNiagaraPoolingBenchmarkStep(NiagaraSystem, SpawnCount, EPREffectPoolingBackend::EffectPoolingBackend_ComponentOnly, PreviousBackend);
+		}
+		else
+		{
+			NiagaraPoolingBackend = PreviousBackend;
+			PR_LOG(Log, "Niagara pooling benchmark finished.");
+		}
+	}), 1.0f, false);
+}
+
+void UPREffectSystemComponent::ApplyDispatchingNiagaraParameters(UFXSystemComponent* FXSystemComponent) const
+{
+	if(DispatchingNiagaraParameters)
+	{
+		DispatchingNiagaraParameters->ApplyToComponent(Cast<UNiagaraComponent>(FXSystemComponent));
+	}
+}
+#pragma endregion
+
+#pragma region FXComponentPool
+UFXSystemComponent* UPREffectSystemComponent::SpawnFXSystemAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	const EPREffectPoolingBackend PoolingBackend = GetEffectPoolingBackend(SpawnEffect);
+	if(PoolingBackend == EPREffectPoolingBackend::EffectPoolingBackend_Actor)
+	{
+		APREffect* SpawnedEffect = SpawnEffectAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset);
+		
+		return IsValid(SpawnedEffect) ? SpawnedEffect->GetFXSystemComponent() : nullptr;
+	}
+	
+	if(!CanDispatchEffectSpawn(SpawnEffect, Location, Rotation, Scale, nullptr, bEffectAutoActivate, bReset))
+	{
+		return nullptr;
+	}
+
+	UFXSystemComponent* PooledComponent = nullptr;
+	if(PoolingBackend == EPREffectPoolingBackend::EffectPoolingBackend_ComponentOnly)
+	{
+		// FXComponentPoolManager의 FXComponent를 가져옵니다. 수명과 반환은 FXComponentPoolManager가 관리합니다.
+		APRFXComponentPoolManager* PoolManager = GetFXComponentPoolManager();
+		if(PoolManager)
+		{
+			PooledComponent = PoolManager->SpawnFXComponentAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset, GetEffectLifespanFromDataTable(SpawnEffect), AppliedEffectScalabilitySettings.MaxPoolSize, DispatchingNiagaraParameters);
+		}
+	}
+	else if(UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(SpawnEffect))
+	{
+		if(!HasPooledNiagaraComponentCapacity(NiagaraSystem))
+		{
+			return nullptr;
+		}
+		
+		// 엔진의 NiagaraComponent Pool에서 NiagaraComponent를 가져옵니다. 반환은 EffectSystem이 직접 관리합니다.
+		// 사용자 파라미터를 적용한 후 활성화하도록 자동실행하지 않고 가져옵니다.
+		UNiagaraComponent* PooledNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, NiagaraSystem, Location, Rotation, Scale, false, false, ENCPoolMethod::ManualRelease);
+		ApplyDispatchingNiagaraParameters(PooledNiagaraComponent);
+		if(IsValid(PooledNiagaraComponent) && bEffectAutoActivate)
+		{
+			// 다른 PoolingBackend와 같이 bReset을 그대로 전달합니다.
+			PooledNiagaraComponent->Activate(bReset);
+		}
+		
+		RegisterPooledNiagaraComponent(PooledNiagaraComponent, bEffectAutoActivate);
+		PooledComponent = PooledNiagaraComponent;
+	}
+	RecordEffectSpawn(SpawnEffect, Location, PooledComponent, false);
+		
+	return PooledComponent;
+}
+
+UFXSystemComponent* UPREffectSystemComponent::SpawnFXSystemAttached(UFXSystemAsset* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	const EPREffectPoolingBackend PoolingBackend = GetEffectPoolingBackend(SpawnEffect);
+	if(PoolingBackend == EPREffectPoolingBackend::EffectPoolingBackend_Actor)
+	{
+		APREffect* SpawnedEffect = SpawnEffectAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset);
+		
+		return IsValid(SpawnedEffect) ? SpawnedEffect->GetFXSystemComponent() : nullptr;
+	}
+	
+	if(!IsValid(Parent))
+	{
+		return nullptr;
+	}
+
+	// PREffect와 같은 위치에 부착되도록 소켓의 위치에 Location을 더하고, 소켓의 회전 값에 Rotation을 합성하여 Spawn합니다.
+	const FVector SpawnLocation = Parent->GetSocketLocation(AttachSocketName) + Location;
+	const FRotator SpawnRotation = (Parent->GetSocketQuaternion(AttachSocketName) * Rotation.Quaternion()).Rotator();
+	if(!CanDispatchEffectSpawn(SpawnEffect, SpawnLocation, Rotation, Scale, Parent, bEffectAutoActivate, bReset))
+	{
+		return nullptr;
+	}
+
+	UFXSystemComponent* PooledComponent = nullptr;
+	if(PoolingBackend == EPREffectPoolingBackend::EffectPoolingBackend_ComponentOnly)
+	{
+		// FXComponentPoolManager가 소켓의 위치와 회전 값을 적용하므로 Location과 Rotation을 그대로 전달합니다.
+		APRFXComponentPoolManager* PoolManager = GetFXComponentPoolManager();
+		if(PoolManager)
+		{
+			PooledComponent = PoolManager->SpawnFXComponentAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset, GetEffectLifespanFromDataTable(SpawnEffect), AppliedEffectScalabilitySettings.MaxPoolSize, DispatchingNiagaraParameters);
+		}
+	}
+	else if(UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(SpawnEffect))
+	{
+		if(!HasPooledNiagaraComponentCapacity(NiagaraSystem))
+		{
+			return nullptr;
+		}
+		
+		UNiagaraComponent* PooledNiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAttached(NiagaraSystem, Parent, AttachSocketName, SpawnLocation, SpawnRotation, Scale, EAttachLocation::KeepWorldPosition, false, ENCPoolMethod::ManualRelease, false);
+		ApplyDispatchingNiagaraParameters(PooledNiagaraComponent);
+		if(IsValid(PooledNiagaraComponent) && bEffectAutoActivate)
+		{
+			// 다른 PoolingBackend와 같이 bReset을 그대로 전달합니다.
+			PooledNiagaraComponent->Activate(bReset);
+		}
+		
+		RegisterPooledNiagaraComponent(PooledNiagaraComponent, bEffectAutoActivate);
+		PooledComponent = PooledNiagaraComponent;
+	}
+	RegisterAttachedFXComponent(PooledComponent, Parent);
+	RecordEffectSpawn(SpawnEffect, SpawnLocation, PooledComponent, true);
+		
+	return PooledComponent;
+}
+
+void UPREffectSystemComponent::DeactivateFXSystem(UFXSystemComponent* FXSystemComponent)
+{
+	if(!IsValid(FXSystemComponent))
+	{
+		return;
+	}
+
+	// PREffect의 FXSystemComponent일 경우 PREffect를 비활성화하여 EffectPool에 반환합니다.
+	APREffect* OwnerEffect = Cast<APREffect>(FXSystemComponent->GetOwner());
+	if(IsValid(OwnerEffect))
+	{
+		DeactivateObject(OwnerEffect);
+		
+		return;
+	}
+
+	// FXComponentPoolManager의 FXComponent일 경우 즉시 비활성화하여 반환합니다.
+	APRFXComponentPoolManager* OwnerPoolManager = Cast<APRFXComponentPoolManager>(FXSystemComponent->GetOwner());
+	if(IsValid(OwnerPoolManager))
+	{
+		OwnerPoolManager->ReleaseFXComponent(FXSystemComponent);
+
+		return;
+	}
+
+	// 엔진의 NiagaraComponent Pool에서 가져온 NiagaraComponent는 실행이 끝나면 OnPooledNiagaraComponentFinished에서 반환됩니다.
+	FXSystemComponent->Deactivate();
+}
+
+EPREffectPoolingBackend UPREffectSystemComponent::GetEffectPoolingBackend(const UFXSystemAsset* EffectAsset) const
+{
+	return Cast<UParticleSystem>(EffectAsset) ? ParticlePoolingBackend : NiagaraPoolingBackend;
+}
+
+UParticleSystemComponent* UPREffectSystemComponent::SpawnParticleSystemAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<UParticleSystemComponent>(SpawnFXSystemAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+UParticleSystemComponent* UPREffectSystemComponent::SpawnParticleSystemAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<UParticleSystemComponent>(SpawnFXSystemAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+void UPREffectSystemComponent::DeactivateParticleSystem(UParticleSystemComponent* ParticleSystemComponent)
+{
+	DeactivateFXSystem(ParticleSystemComponent);
+}
+
+void UPREffectSystemComponent::SetParticlePoolingBackend(EPREffectPoolingBackend NewParticlePoolingBackend)
+{
+	// 엔진의 NiagaraComponent Pool은 ParticleSystem을 지원하지 않으므로 Actor로 처리합니다.
+	ParticlePoolingBackend = NewParticlePoolingBackend == EPREffectPoolingBackend::EffectPoolingBackend_NiagaraComponentPool ? EPREffectPoolingBackend::EffectPoolingBackend_Actor : NewParticlePoolingBackend;
+}
+
+APRFXComponentPoolManager* UPREffectSystemComponent::GetFXComponentPoolManager()
+{
+	if(!FXComponentPoolManager.IsValid())
+	{
+		FXComponentPoolManager = APRFXComponentPoolManager::GetFXComponentPoolManager(this);
+		if(FXComponentPoolManager.IsValid())
+		{
+			FXComponentPoolManager->OnFXComponentDeactivateDelegate.AddUniqueDynamic(this, &UPREffectSystemComponent::OnPooledFXComponentDeactivate);
+		}
+	}
+
+	return FXComponentPoolManager.Get();
+}
+
+float UPREffectSystemComponent::GetEffectLifespanFromDataTable(UFXSystemAsset* EffectAsset) const
+{
+	const FPREffectPoolSettings* EffectSettings = EffectPoolSettingsIndex.Find(EffectAsset);
+	if(EffectSettings)
+	{
+		return EffectSettings->EffectLifespan;
+	}
+
+	// 데이터 테이블에 설정 값이 없는 이펙트는 동적으로 생성한 이펙트와 같은 수명을 사용합니다.
+	return DynamicLifespan;
+}
+#pragma endregion
+
+#pragma region EffectScalability
+void UPREffectSystemComponent::RefreshEffectScalability()
+{
+	const FPREffectScalabilitySettings NewEffectScalabilitySettings = GetCurrentEffectScalabilitySettings();
+	if(NewEffectScalabilitySettings == AppliedEffectScalabilitySettings)
+	{
+		return;
+	}
+
+	// EffectSystem을 다시 초기화하지 않고 생성된 Pool의 크기만 조정합니다.
+	AppliedEffectScalabilitySettings = NewEffectScalabilitySettings;
+	ResizeEffectPools();
+}
+
+FPREffectScalabilitySettings UPREffectSystemComponent::GetCurrentEffectScalabilitySettings() const
+{
+	FPREffectScalabilitySettings CurrentSettings;
+	if(!EffectScalabilitySettings.IsEmpty())
+	{
+		const int32 EffectsQuality = Scalability::GetQualityLevels().EffectsQuality;
+		CurrentSettings = EffectScalabilitySettings[FMath::Clamp(EffectsQuality, 0, EffectScalabilitySettings.Num() - 1)];
+	}
+
+	// pr.FX 콘솔 변수가 설정되었을 경우 품질 단계의 값 대신 사용합니다.
+	const float PoolSizeScaleOverride = CVarPRFXPoolSizeScale.GetValueOnGameThread();
+	if(PoolSizeScaleOverride >= 0.0f)
+	{
+		CurrentSettings.PoolSizeScale = PoolSizeScaleOverride;
+	}
+
+	const int32 MaxPoolSizeOverride = CVarPRFXMaxPoolSize.GetValueOnGameThread();
+	if(MaxPoolSizeOverride > 0)
+	{
+		CurrentSettings.MaxPoolSize = MaxPoolSizeOverride;
+	}
+
+	const float SpawnProbabilityOverride = CVarPRFXSpawnProbability.GetValueOnGameThread();
+	if(SpawnProbabilityOverride >= 0.0f)
+	{
+		CurrentSettings.SpawnProbability = FMath::Min(SpawnProbabilityOverride, 1.0f);
+	}
+
+	return CurrentSettings;
+}
+
+int32 UPREffectSystemComponent::GetScaledPoolSize(int32 PoolSize) const
+{
+	if(PoolSize <= 0)
+	{
+		return 0;
+	}
+
+	// 비율을 적용해도 최소 하나의 이펙트는 Pool에 보관합니다.
+	const int32 ScaledPoolSize = FMath::Max(FMath::RoundToInt(PoolSize * AppliedEffectScalabilitySettings.PoolSizeScale), 1);
 
-		Pool.PooledEffects.Empty();
+	return FMath::Min(ScaledPoolSize, AppliedEffectScalabilitySettings.MaxPoolSize);
+}
+
+bool UPREffectSystemComponent::PassesEffectSpawnProbability(UFXSystemAsset* SpawnEffect) const
+{
+	if(!SpawnEffect || AppliedEffectScalabilitySettings.SpawnProbability >= 1.0f)
+	{
+		return true;
+	}
+
+	EPREffectSpawnPriority SpawnPriority = EPREffectSpawnPriority::EffectSpawnPriority_Normal;
+	int32 MaxSpawnsPerFrame = 0;
+	GetEffectSpawnBudgetSettings(SpawnEffect, SpawnPriority, MaxSpawnsPerFrame);
+	if(SpawnPriority == EPREffectSpawnPriority::EffectSpawnPriority_High)
+	{
+		return true;
 	}
 
-	NiagaraPool.Pool.Empty();
+	return FMath::FRand() < AppliedEffectScalabilitySettings.SpawnProbability;
 }
 
-void UPREffectSystemComponent::CreateNiagaraPool(const FPRNiagaraEffectPoolSettings& NiagaraPoolSettings)
+void UPREffectSystemComponent::ResizeEffectPools()
 {
-	if(GetWorld() && NiagaraPoolSettings.NiagaraSystem)
+	for(auto& PoolEntry : EffectPool.Pool)
 	{
-		FPRNiagaraEffectPool NewNiagaraEffectPool;
+		UFXSystemAsset* EffectAsset = PoolEntry.Key;
+		if(!EffectAsset)
+		{
+			continue;
+		}
 
-		// PoolSize만큼 NiagaraEffect를 월드에 Spawn한 후 NewNiagaraEffectPool에 보관합니다.
-		for(int32 Index = 0; Index < NiagaraPoolSettings.PoolSize; Index++)
+		// 데이터 테이블에 설정되지 않은 이펙트는 DynamicPoolSize로 생성된 Pool입니다.
+		const FPREffectPoolSettings* EffectSettings = EffectPoolSettingsIndex.Find(EffectAsset);
+		const int32 TargetPoolSize = GetScaledPoolSize(EffectSettings ? EffectSettings->PoolSize : DynamicPoolSize);
+
+		// 동적으로 생성한 이펙트는 DynamicLifespan 후에 제거되므로 크기에 포함하지 않습니다.
+		TArray<APREffect*> InactiveEffects;
+		int32 PersistentEffectCount = 0;
+		for(APREffect* PooledEffect : PoolEntry.Value.PooledEffects)
 		{
-			APRNiagaraEffect* SpawnNiagaraEffect = SpawnNiagaraEffectInWorld(NiagaraPoolSettings.NiagaraSystem, Index, NiagaraPoolSettings.EffectLifespan);
-			if(IsValid(SpawnNiagaraEffect))
+			if(!IsValid(PooledEffect) || IsDynamicEffect(PooledEffect))
+			{
+				continue;
+			}
+
+			PersistentEffectCount++;
+			if(!IsActivateEffect(PooledEffect))
 			{
-				NewNiagaraEffectPool.PooledEffects.Emplace(SpawnNiagaraEffect);
+				InactiveEffects.Emplace(PooledEffect);
 			}
 		}
 
-		// 초기화된 NewNiagaraEffectPool를 NiagaraPool에 추가하고 ActivateNiagaraIndexList를 생성합니다.
-		NiagaraPool.Pool.Emplace(NiagaraPoolSettings.NiagaraSystem, NewNiagaraEffectPool);
-	}
-}
+		// Pool을 줄일 때는 비활성화된 이펙트만 제거합니다. 활성화된 이펙트는 다음 크기 조정까지 남겨둡니다.
+		const int32 RemoveCount = FMath::Min(PersistentEffectCount - TargetPoolSize, InactiveEffects.Num());
+		for(int32 Index = 0; Index < RemoveCount; Index++)
+		{
+			OnDynamicEffectDestroy(InactiveEffects[Index]);
+		}
 
-void UPREffectSystemComponent::CreateActivateNiagaraIndexList(UNiagaraSystem* NiagaraSystem)
-{
-	if(NiagaraSystem)
-	{
-		ActivateNiagaraIndexList.List.Emplace(NiagaraSystem);
+		for(int32 AddCount = TargetPoolSize - PersistentEffectCount; AddCount > 0; AddCount--)
+		{
+			if(!IsValid(AddPooledEffect(EffectAsset)))
+			{
+				break;
+			}
+		}
 	}
-}
 
-void UPREffectSystemComponent::CreateUsedNiagaraIndexList(UNiagaraSystem* NiagaraSystem)
-{
-	if(NiagaraSystem)
+	// ComponentOnly로 생성한 FXComponent는 늘어난 크기만큼 미리 생성합니다.
+	APRFXComponentPoolManager* PoolManager = FXComponentPoolManager.Get();
+	if(PoolManager)
 	{
-		FPRNiagaraEffectPool* PoolEntry = NiagaraPool.Pool.Find(NiagaraSystem);
-		if(PoolEntry)
+		for(const auto& EffectSettings : EffectPoolSettingsIndex)
 		{
-			FPRUsedIndexList UsedIndexList;
-			for(const auto& PooledEffect : PoolEntry->PooledEffects)
+			if(GetEffectPoolingBackend(EffectSettings.Key) == EPREffectPoolingBackend::EffectPoolingBackend_ComponentOnly)
 			{
-				if(IsValid(PooledEffect))
-				{
-					UsedIndexList.Indexes.Add(GetPoolIndex(PooledEffect));
-				}
+				PoolManager->PrewarmFXComponents(EffectSettings.Key, GetScaledPoolSize(EffectSettings.Value.PoolSize));
 			}
-			
-			UsedNiagaraIndexList.List.Emplace(NiagaraSystem, UsedIndexList);	
 		}
 	}
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectInWorld(UNiagaraSystem* NiagaraSystem, int32 PoolIndex, float Lifespan)
+APREffect* UPREffectSystemComponent::AddPooledEffect(UFXSystemAsset* EffectAsset)
 {
-	if(!GetWorld() || !NiagaraSystem || !GetPROwner())
+	FPREffectPool* PoolEntry = EffectPool.Pool.Find(EffectAsset);
+	if(!PoolEntry)
 	{
 		return nullptr;
 	}
 
-	// NiagaraEffect를 생성합니다.
-	APRNiagaraEffect* NiagaraEffect = GetWorld()->SpawnActor<APRNiagaraEffect>(APRNiagaraEffect::StaticClass());
-	if(!IsValid(NiagaraEffect))
+	if(!IsCreateUsedEffectIndexList(EffectAsset))
+	{
+		CreateUsedEffectIndexList(EffectAsset);
+	}
+
+	FPRUsedIndexList* UsedIndexList = UsedEffectIndexList.List.Find(EffectAsset);
+	if(!UsedIndexList)
 	{
-		// NiagaraEffect 생성에 실패하면 함수를 종료하고 nullptr을 반환합니다.
 		return nullptr;
 	}
 
-	// NiagaraEffect를 초기화합니다.
-	NiagaraEffect->InitializeNiagaraEffect(NiagaraSystem, GetPROwner(), PoolIndex, Lifespan);
+	const int32 NewIndex = FindAvailableIndex(UsedIndexList->Indexes);
+	APREffect* PooledEffect = SpawnEffectInWorld(EffectAsset, NewIndex, GetEffectPoolSettingsFromDataTable(EffectAsset).EffectLifespan);
+	if(IsValid(PooledEffect))
+	{
+		UsedIndexList->Indexes.Add(NewIndex);
+		PoolEntry->PooledEffects.Emplace(PooledEffect);
+	}
 
-	// NiagaraEffect의 OnEffectDeactivateDelegate 이벤트에 대한 콜백 함수를 바인딩합니다.
-	NiagaraEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnNiagaraEffectDeactivate);
+	return PooledEffect;
+}
+#pragma endregion
 
-	return NiagaraEffect;
+#pragma region NiagaraWarmUp
+void UPREffectSystemComponent::ResetNiagaraWarmUpStats()
+{
+	NiagaraWarmUpStats = FPRNiagaraWarmUpStats();
+	NiagaraFirstUseTimes.Empty();
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::SpawnDynamicNiagaraEffectInWorld(UNiagaraSystem* NiagaraSystem)
+void UPREffectSystemComponent::ReportNiagaraFirstUseHitches() const
 {
-	if(!NiagaraSystem)
+	PR_LOG(Log, "Niagara warm up: %d systems, %.3f ms, First use hitches: %d / %d", NiagaraWarmUpStats.WarmedSystemCount, NiagaraWarmUpStats.WarmUpTime,
+			NiagaraWarmUpStats.FirstUseHitchCount, NiagaraWarmUpStats.FirstUseCount);
+
+	for(const auto& NiagaraFirstUseTime : NiagaraFirstUseTimes)
 	{
-		return nullptr;
+		if(NiagaraFirstUseTime.Key && NiagaraFirstUseTime.Value > FirstUseHitchThreshold)
+		{
+			PR_LOG(Warning, "%s: %.3f ms (Warmed: %s)", *NiagaraFirstUseTime.Key->GetPathName(), NiagaraFirstUseTime.Value,
+					WarmedNiagaraSystems.Contains(NiagaraFirstUseTime.Key) ? TEXT("true") : TEXT("false"));
+		}
 	}
-	
-	APRNiagaraEffect* DynamicNiagaraEffect = nullptr;
-	
-	// Critical Section 시작
-	FCriticalSection CriticalSection;
-	CriticalSection.Lock();
+}
 
-	// 해당 NiagaraSystem의 UsedNiagaraIndexList가 생성되었는지 확인하고, 없으면 생성합니다.
-	if(!IsCreateUsedNiagaraIndexList(NiagaraSystem))
+void UPREffectSystemComponent::WarmUpNiagaraEffect(APRNiagaraEffect* NiagaraEffect)
+{
+	if(!IsValid(NiagaraEffect) || !IsValid(NiagaraEffect->GetNiagaraEffect()))
 	{
-		CreateUsedNiagaraIndexList(NiagaraSystem);
+		return;
 	}
 
-	// UsedNiagaraIndexList에서 해당 NiagaraSystem의 UsedIndexList를 얻습니다.
-	FPRUsedIndexList* UsedIndexList = UsedNiagaraIndexList.List.Find(NiagaraSystem);
-	if(UsedIndexList == nullptr)
+	UNiagaraComponent* NiagaraComponent = NiagaraEffect->GetNiagaraEffect();
+	UNiagaraSystem* NiagaraSystem = NiagaraComponent->GetAsset();
+	if(!NiagaraSystem || WarmedNiagaraSystems.Contains(NiagaraSystem))
 	{
-		// 지정된 NiagaraSystem이 없습니다.
-		return nullptr;
+		return;
 	}
 
-	// 사용 가능한 Index를 구합니다.
-	const int32 NewIndex = FindAvailableIndex(UsedIndexList->Indexes);
-	// 사용 가능한 Index를 UsedIndexList에 추가합니다.
-	UsedIndexList->Indexes.Add(NewIndex);
+	// 이펙트는 비활성화 상태로 숨겨져 있으므로 화면에 보이지 않고, 실행이 끝나도 Pool에 반환되지 않습니다.
+	const double WarmUpStartTime = FPlatformTime::Seconds();
+	NiagaraComponent->Activate(true);
+	NiagaraComponent->AdvanceSimulation(WarmUpTickCount, WarmUpTickDelta);
+	NiagaraComponent->DeactivateImmediate();
 
-	// Critical Section 끝
-	CriticalSection.Unlock();
+	WarmedNiagaraSystems.Emplace(NiagaraSystem);
+	NiagaraWarmUpStats.WarmedSystemCount++;
+	NiagaraWarmUpStats.WarmUpTime += (FPlatformTime::Seconds() - WarmUpStartTime) * 1000.0;
+}
 
-	// 새로운 NiagaraEffect를 생성하고 초기화합니다.
-	const FPRNiagaraEffectPoolSettings NiagaraEffectSettings = GetNiagaraEffectPoolSettingsFromDataTable(NiagaraSystem);
-	if(NiagaraEffectSettings != FPRNiagaraEffectPoolSettings())
+void UPREffectSystemComponent::RecordNiagaraFirstUse(UFXSystemAsset* EffectAsset, double ActivateStartTime)
+{
+	UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(EffectAsset);
+	if(!NiagaraSystem || NiagaraFirstUseTimes.Contains(NiagaraSystem))
 	{
-		// 데이터 테이블에 NiagaraEffect의 설정 값을 가지고 있을 경우 설정 값의 Lifespan을 적용합니다.
-		DynamicNiagaraEffect = SpawnNiagaraEffectInWorld(NiagaraSystem, NewIndex, NiagaraEffectSettings.EffectLifespan);
+		return;
 	}
-	else
+
+	const float FirstUseTime = (FPlatformTime::Seconds() - ActivateStartTime) * 1000.0;
+	NiagaraFirstUseTimes.Emplace(NiagaraSystem, FirstUseTime);
+	NiagaraWarmUpStats.FirstUseCount++;
+
+	// 미리 실행하지 않았거나, 미리 실행해도 처음 활성화할 때 비용이 큰 NiagaraSystem을 알립니다.
+	if(FirstUseTime > FirstUseHitchThreshold)
 	{
-		// 데이터 테이블에 NiagaraEffect의 설정 값을 가지고 있지 않을 경우 DynamicLifespan을 적용합니다.
-		DynamicNiagaraEffect = SpawnNiagaraEffectInWorld(NiagaraSystem, NewIndex, DynamicLifespan);
+		NiagaraWarmUpStats.FirstUseHitchCount++;
+		PR_LOG(Warning, "First use hitch: %s took %.3f ms (Warmed: %s)", *NiagaraSystem->GetPathName(), FirstUseTime,
+				WarmedNiagaraSystems.Contains(NiagaraSystem) ? TEXT("true") : TEXT("false"));
 	}
-		
-	// OnDynamicNiagaraEffectDeactivate 함수를 바인딩합니다.
-	DynamicNiagaraEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnDynamicNiagaraEffectDeactivate);
+}
+#pragma endregion
 
-	// NiagaraPool에서 해당 NiagaraSystem의 Pool을 얻습니다.
-	FPRNiagaraEffectPool* PoolEntry = NiagaraPool.Pool.Find(NiagaraSystem);
-	if(!PoolEntry)
+#pragma region CompositeEffect
+void UPREffectSystemComponent::PreloadEffectPreset(UPREffectPresetDataAsset* EffectPreset)
+{
+	if(!IsValid(EffectPreset) || CompositeEffectPool.Contains(EffectPreset))
 	{
-		// Pool이 없을 경우 생성한 NiagaraEffect를 제거하고 nullptr을 반환합니다.
-		DynamicNiagaraEffect->ConditionalBeginDestroy();
-		
-		return nullptr;
+		return;
 	}
 
-	// 새로 생성한 NiagaraEffect를 PoolEntry에 추가합니다.
-	PoolEntry->PooledEffects.Emplace(DynamicNiagaraEffect);
-
-	return DynamicNiagaraEffect;
+	FPRCompositeEffectPool& PresetPool = CompositeEffectPool.Add(EffectPreset);
+	const int32 PoolSize = GetScaledPoolSize(EffectPreset->PoolSize);
+	PresetPool.PooledEffects.Reserve(PoolSize);
+	for(int32 Index = 0; Index < PoolSize; Index++)
+	{
+		APRCompositeEffect* CompositeEffect = SpawnCompositeEffectInWorld(EffectPreset, Index);
+		if(IsValid(CompositeEffect))
+		{
+			PresetPool.PooledEffects.Emplace(CompositeEffect);
+		}
+	}
 }
 
-APRNiagaraEffect* UPREffectSystemComponent::InitializeNiagaraEffect(UNiagaraSystem* SpawnEffect)
+APRCompositeEffect* UPREffectSystemComponent::SpawnEffectPresetAtLocation(UPREffectPresetDataAsset* EffectPreset, FVector Location, FRotator Rotation, FVector Scale, bool bReset)
 {
-	APRNiagaraEffect* ActivateableNiagaraEffect = GetActivateableNiagaraEffect(SpawnEffect);
-	
-	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 객체가 아니면 nullptr를 반환합니다.
-	if(!IsValid(ActivateableNiagaraEffect) || !IsPoolableObject(ActivateableNiagaraEffect))
+	if(!IsValid(EffectPreset))
 	{
 		return nullptr;
 	}
 
-	// 동적으로 생성한 NiagaraEffect일 경우 DynamicObjectDestroyTimer가 작동 중이라면 DynamicObjectDestroyTimer를 정지합니다.
-	FTimerHandle* DynamicObjectDestroyTimer = DynamicDestroyNiagaraList.FindTimerHandleForNiagaraEffect(*ActivateableNiagaraEffect);
-	if(DynamicObjectDestroyTimer)
+	// 프리셋도 다른 이펙트와 같이 Spawn 확률, Significance, Spawn 예산을 적용합니다.
+	// 프리셋은 하나의 CompositeEffect로 Spawn하므로 Significance에 의한 대체 이펙트는 사용하지 않습니다.
 	{
-		GetWorld()->GetTimerManager().ClearTimer(*DynamicObjectDestroyTimer);
+		TGuardValue<bool> DispatchingEffectPresetGuard(bDispatchingEffectPreset, true);
+		UFXSystemAsset* GateEffect = GetEffectPresetGateEffect(EffectPreset);
+		if(!CanDispatchEffectSpawn(GateEffect, Location, Rotation, Scale, nullptr, true, bReset))
+		{
+			return nullptr;
+		}
 	}
 	
-	// 해당 NiagaraSystem를 처음 활성화하는 경우 ActivateNiagaraEffectIndexList를 생성합니다.
-	if(!IsCreateActivateNiagaraIndexList(SpawnEffect))
+	APRCompositeEffect* CompositeEffect = GetActivateableCompositeEffect(EffectPreset);
+	if(!IsValid(CompositeEffect))
 	{
-		CreateActivateNiagaraIndexList(SpawnEffect);
+		return nullptr;
 	}
 
-	// 활성화된 NiagaraEffect의 Index를 ActivateNiagaraIndexList에 저장합니다.
-	const int32 PoolIndex = GetPoolIndex(ActivateableNiagaraEffect);
-	ActivateNiagaraIndexList.GetIndexesForNiagaraSystem(*SpawnEffect)->Add(PoolIndex);
-	
-	return ActivateableNiagaraEffect;
-}
+	// 프리셋의 모든 FXSystemComponent는 CompositeEffect에 부착되어 있으므로 Transform을 한 번만 적용합니다.
+	CompositeEffect->SpawnEffectAtLocation(Location, Rotation, Scale, true, bReset);
 
-void UPREffectSystemComponent::ClearDynamicDestroyNiagaraList(FPRDynamicDestroyNiagaraEffectList& TargetDynamicDestroyNiagaraEffectList)
-{
-	ClearDynamicDestroyObjects(TargetDynamicDestroyNiagaraEffectList.List);
+	// 프리셋은 다른 요청이 병합할 수 없으므로 Spawn 예산에만 기록합니다.
+	RecordEffectSpawn(GetEffectPresetGateEffect(EffectPreset), Location, nullptr, true);
+
+	return CompositeEffect;
 }
 
-FPRNiagaraEffectPoolSettings UPREffectSystemComponent::GetNiagaraEffectPoolSettingsFromDataTable(UNiagaraSystem* NiagaraSystem) const
+void UPREffectSystemComponent::ClearAllCompositeEffectPool()
 {
-	if(NiagaraPoolSettingsDataTable != nullptr)
+	for(auto& PresetPool : CompositeEffectPool)
 	{
-		TArray<FName> RowNames = NiagaraPoolSettingsDataTable->GetRowNames();
-		for(const FName& RowName: RowNames)
+		for(APRCompositeEffect* CompositeEffect : PresetPool.Value.PooledEffects)
 		{
-			FPRNiagaraEffectPoolSettings* NiagaraEffectPoolSettings = NiagaraPoolSettingsDataTable->FindRow<FPRNiagaraEffectPoolSettings>(RowName, FString(""));
-			if(NiagaraEffectPoolSettings
-				&& NiagaraEffectPoolSettings->NiagaraSystem == NiagaraSystem)
+			if(IsValid(CompositeEffect))
 			{
-				return *NiagaraEffectPoolSettings;
+				CompositeEffect->Destroy();
 			}
 		}
 	}
 
-	return FPRNiagaraEffectPoolSettings();
+	CompositeEffectPool.Empty();
 }
 
-void UPREffectSystemComponent::OnNiagaraEffectDeactivate(APREffect* TargetEffect)
+APRCompositeEffect* UPREffectSystemComponent::GetActivateableCompositeEffect(UPREffectPresetDataAsset* EffectPreset)
 {
-	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
-	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 NiagaraEffect가 아니거나 NiagaraComponent가 없으면 반환합니다.
-	if(!IsValid(TargetNiagaraEffect)
-		|| !IsPoolableObject(TargetNiagaraEffect)
-		|| !TargetNiagaraEffect->GetNiagaraEffect())
+	if(!IsValid(EffectPreset))
 	{
-		return;
+		return nullptr;
 	}
 
-	// TargetNiagaraEffect가 활성화된 상태라면 비활성화합니다.
-	if(IsActivateNiagaraEffect(TargetNiagaraEffect))
+	// 미리 생성하지 않은 프리셋은 처음 Spawn할 때 Pool을 생성합니다.
+	if(!CompositeEffectPool.Contains(EffectPreset))
 	{
-		FPRActivateIndexList* ActivateIndexList = ActivateNiagaraIndexList.List.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
-		if(ActivateIndexList)
-		{
-			// 비활성화된 TargetNiagaraEffect의 Index를 제거합니다.
-			ActivateIndexList->Indexes.Remove(GetPoolIndex(TargetNiagaraEffect));
-		}
+		PreloadEffectPreset(EffectPreset);
 	}
-}
 
-void UPREffectSystemComponent::OnDynamicNiagaraEffectDeactivate(APREffect* TargetEffect)
-{
-	APRNiagaraEffect* TargetNiagaraEffect = Cast<APRNiagaraEffect>(TargetEffect);
-	// 유효하지 않는 NiagaraEffect이거나 풀링 가능한 NiagaraEffect가 아니거나 NiagaraComponent가 없으면 반환합니다.
-	if(!IsValid(TargetNiagaraEffect)
-		|| !IsPoolableObject(TargetNiagaraEffect)
-		|| !TargetNiagaraEffect->GetNiagaraEffect())
+	FPRCompositeEffectPool* PresetPool = CompositeEffectPool.Find(EffectPreset);
+	if(!PresetPool)
 	{
-		return;
+		return nullptr;
 	}
 
-	if(DynamicLifespan > 0.0f)
+	for(APRCompositeEffect* PooledEffect : PresetPool->PooledEffects)
 	{
-		// 동적 수명이 끝난 후 NiagaraEffect를 제거하도록 타이머를 설정합니다.
-		FTimerHandle DynamicLifespanTimerHandle;
-		FTimerDelegate DynamicLifespanDelegate = FTimerDelegate::CreateUObject(this, &UPREffectSystemComponent::OnDynamicNiagaraEffectDestroy, TargetNiagaraEffect);
-		GetWorld()->GetTimerManager().SetTimer(DynamicLifespanTimerHandle, DynamicLifespanDelegate, DynamicLifespan, false);
-
-		// TimerHandle을 추가합니다.
-		FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyNiagaraList.List.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
-		if(DynamicDestroyObject)
-		{
-			DynamicDestroyObject->TimerHandles.Emplace(TargetNiagaraEffect, DynamicLifespanTimerHandle);
-		}
-		else
+		if(IsValid(PooledEffect) && !IsActivateObject(PooledEffect))
 		{
-			FPRDynamicDestroyObject NewDynamicDestroyObject;
-			NewDynamicDestroyObject.TimerHandles.Emplace(TargetNiagaraEffect, DynamicLifespanTimerHandle);
-			DynamicDestroyNiagaraList.List.Emplace(TargetNiagaraEffect->GetNiagaraEffectAsset(), NewDynamicDestroyObject);
+			return PooledEffect;
 		}
 	}
-	else
+
+	// 모든 CompositeEffect가 활성화되었을 경우 이펙트 품질 단계의 최대 크기까지 새로 생성하여 Pool에 추가합니다.
+	if(PresetPool->PooledEffects.Num() >= AppliedEffectScalabilitySettings.MaxPoolSize)
+	{
+		return nullptr;
+	}
+
+	APRCompositeEffect* CompositeEffect = SpawnCompositeEffectInWorld(EffectPreset, PresetPool->PooledEffects.Num());
+	if(IsValid(CompositeEffect))
 	{
-		// 동적 수명이 없을 경우 타이머를 실행하지 않고 바로 NiagaraEffect를 제거합니다.
-		OnDynamicNiagaraEffectDestroy(TargetNiagaraEffect);
+		PresetPool->PooledEffects.Emplace(CompositeEffect);
 	}
+
+	return CompositeEffect;
 }
 
-void UPREffectSystemComponent::OnDynamicNiagaraEffectDestroy(APRNiagaraEffect* TargetNiagaraEffect)
+UFXSystemAsset* UPREffectSystemComponent::GetEffectPresetGateEffect(const UPREffectPresetDataAsset* EffectPreset) const
 {
-	// DynamicObjectDestroyTimer를 제거합니다.
-	FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyNiagaraList.List.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
-	if(DynamicDestroyObject)
+	if(!IsValid(EffectPreset))
+	{
+		return nullptr;
+	}
+	
+	for(const FPREffectPresetFXEntry& FXEntry : EffectPreset->FXEntries)
 	{
-		FTimerHandle* TimerHandle = DynamicDestroyObject->TimerHandles.Find(TargetNiagaraEffect);
-		GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-		DynamicDestroyObject->TimerHandles.Remove(TargetNiagaraEffect);
+		if(FXEntry.FXSystem)
+		{
+			return FXEntry.FXSystem;
+		}
 	}
 
-	// NiagaraSystem의 UsedObjectIndex를 얻습니다.
-	FPRUsedIndexList* UsedIndexList = UsedNiagaraIndexList.List.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
-	if(UsedIndexList)
+	return nullptr;
+}
+
+APRCompositeEffect* UPREffectSystemComponent::SpawnCompositeEffectInWorld(UPREffectPresetDataAsset* EffectPreset, int32 PoolIndex)
+{
+	if(!GetWorld() || !IsValid(EffectPreset) || !GetPROwner())
 	{
-		// 사용 중인 Index를 제거합니다.
-		UsedIndexList->Indexes.Remove(GetPoolIndex(TargetNiagaraEffect));
+		return nullptr;
 	}
 
-	// NiagaraSystem의 Pool이 생성되었는지 확인합니다.
-	if(IsCreateNiagaraPool(TargetNiagaraEffect->GetNiagaraEffectAsset()))
+	APRCompositeEffect* CompositeEffect = GetWorld()->SpawnActor<APRCompositeEffect>(APRCompositeEffect::StaticClass());
+	if(IsValid(CompositeEffect))
 	{
-		// NiagaraPool에서 NiagaraEffect를 제거합니다.
-		FPRNiagaraEffectPool* PoolEntry = NiagaraPool.Pool.Find(TargetNiagaraEffect->GetNiagaraEffectAsset());
-		if(PoolEntry)
-		{
-			PoolEntry->PooledEffects.Remove(TargetNiagaraEffect);
-		}
+		CompositeEffect->InitializeCompositeEffect(EffectPreset, GetPROwner(), PoolIndex);
 	}
-		
-	TargetNiagaraEffect->ConditionalBeginDestroy();
+
+	return CompositeEffect;
 }
-#pragma endregion 
+#pragma endregion
 
-#pragma region ParticleSystem
-void UPREffectSystemComponent::InitializeParticlePool()
+#pragma region EffectPool
+void UPREffectSystemComponent::InitializeEffectPool()
 {
-	ClearAllParticlePool();
+	ClearAllEffectPool();
+
+	// 데이터 테이블의 설정 값을 이펙트별로 저장하고, 데이터 테이블이 변경되면 다시 저장하도록 바인딩합니다.
+	RefreshEffectPoolSettingsIndex();
+	if(NiagaraPoolSettingsDataTable && !NiagaraPoolSettingsChangedHandle.IsValid())
+	{
+		NiagaraPoolSettingsChangedHandle = NiagaraPoolSettingsDataTable->OnDataTableChanged().AddUObject(this, &UPREffectSystemComponent::RefreshEffectPoolSettingsIndex);
+	}
 	
-	// ParticleSystemPoolSettings 데이터 테이블을 기반으로 ParticleSystemObjectPool을 생성합니다.
-	if(ParticlePoolSettingsDataTable)
+	if(ParticlePoolSettingsDataTable && !ParticlePoolSettingsChangedHandle.IsValid())
+	{
+		ParticlePoolSettingsChangedHandle = ParticlePoolSettingsDataTable->OnDataTableChanged().AddUObject(this, &UPREffectSystemComponent::RefreshEffectPoolSettingsIndex);
+	}
+	
+	// 현재 이펙트 품질 단계의 설정 값으로 PoolSize를 조정합니다.
+	AppliedEffectScalabilitySettings = GetCurrentEffectScalabilitySettings();
+	
+	// 데이터 테이블의 설정 값을 기반으로 EffectPool을 생성합니다.
+	// ComponentOnly일 경우 이펙트 대신 FXComponentPoolManager의 FXComponent를 미리 생성합니다.
+	for(const auto& EffectSettings : EffectPoolSettingsIndex)
 	{
-		TArray<FName> RowNames = ParticlePoolSettingsDataTable->GetRowNames();
-		for(const FName& RowName : RowNames)
+		APRFXComponentPoolManager* PoolManager = GetEffectPoolingBackend(EffectSettings.Key) == EPREffectPoolingBackend::EffectPoolingBackend_ComponentOnly ? GetFXComponentPoolManager() : nullptr;
+		if(PoolManager)
 		{
-			FPRParticleEffectPoolSettings* ParticleSettings = ParticlePoolSettingsDataTable->FindRow<FPRParticleEffectPoolSettings>(RowName, FString(""));
-			if(ParticleSettings)
-			{
-				CreateParticlePool(*ParticleSettings);
-			}
+			PoolManager->PrewarmFXComponents(EffectSettings.Key, GetScaledPoolSize(EffectSettings.Value.PoolSize));
+		}
+		else
+		{
+			CreateEffectPool(EffectSettings.Value);
 		}
 	}
 }
 
-void UPREffectSystemComponent::ClearAllParticlePool()
+void UPREffectSystemComponent::ClearAllEffectPool()
 {
-	ActivateParticleIndexList.List.Empty();
-	UsedParticleIndexList.List.Empty();
-	ClearDynamicDestroyParticleList(DynamicDestroyParticleList);
-	ClearParticlePool(ParticlePool);
+	ActivateEffectIndexList.List.Empty();
+	UsedEffectIndexList.List.Empty();
+	ClearDynamicDestroyEffectList(DynamicDestroyEffectList);
+	ClearEffectPool(EffectPool);
+	ClearAllCompositeEffectPool();
+	WarmedNiagaraSystems.Empty();
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APREffect* UPREffectSystemComponent::SpawnEffectAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
 {
-	APRParticleEffect* ActivateableParticleEffect = InitializeParticleEffect(SpawnEffect);
-	if(IsValid(ActivateableParticleEffect))
+	if(!CanDispatchEffectSpawn(SpawnEffect, Location, Rotation, Scale, nullptr, bEffectAutoActivate, bReset))
+	{
+		return nullptr;
+	}
+	
+	APREffect* ActivateableEffect = InitializeEffect(SpawnEffect);
+	if(!IsValid(ActivateableEffect))
 	{
 		return nullptr;
 	}
 	
-	// ParticleEffect를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
-	ActivateableParticleEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
+	// 이펙트를 활성화하고 Spawn할 위치와 회전값, 크기, 자동실행 여부를 적용합니다.
+	ApplyDispatchingNiagaraParameters(ActivateableEffect->GetFXSystemComponent());
+	const double ActivateStartTime = FPlatformTime::Seconds();
+	ActivateableEffect->SpawnEffectAtLocation(Location, Rotation, Scale, bEffectAutoActivate, bReset);
+	RecordNiagaraFirstUse(SpawnEffect, ActivateStartTime);
+	RecordEffectSpawn(SpawnEffect, Location, ActivateableEffect->GetFXSystemComponent(), false);
 	
-	return ActivateableParticleEffect;
+	return ActivateableEffect;
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAttached(UParticleSystem* SpawnEffect,	USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+APREffect* UPREffectSystemComponent::SpawnEffectAttached(UFXSystemAsset* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
 {
-	APRParticleEffect* ActivateableParticleEffect = InitializeParticleEffect(SpawnEffect);
-	if(IsValid(ActivateableParticleEffect))
+	if(!IsValid(Parent))
+	{
+		return nullptr;
+	}
+
+	// Significance와 Spawn 예산은 Location이 아닌 소켓의 월드 위치를 기준으로 평가하고 기록합니다.
+	const FVector SpawnLocation = Parent->GetSocketLocation(AttachSocketName) + Location;
+	if(!CanDispatchEffectSpawn(SpawnEffect, SpawnLocation, Rotation, Scale, Parent, bEffectAutoActivate, bReset))
+	{
+		return nullptr;
+	}
+	
+	APREffect* ActivateableEffect = InitializeEffect(SpawnEffect);
+	if(!IsValid(ActivateableEffect))
 	{
 		return nullptr;
 	}
 
-	// ParticleEffect를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
-	ActivateableParticleEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
+	// 이펙트를 활성화하고 Spawn하여 부착할 Component와 위치, 회전값, 크기, 자동실행 여부를 적용합니다.
+	ApplyDispatchingNiagaraParameters(ActivateableEffect->GetFXSystemComponent());
+	const double ActivateStartTime = FPlatformTime::Seconds();
+	ActivateableEffect->SpawnEffectAttached(Parent, AttachSocketName, Location, Rotation, Scale, EAttachLocation::KeepWorldPosition, bEffectAutoActivate, bReset);
+	RecordNiagaraFirstUse(SpawnEffect, ActivateStartTime);
+
+	// 부착된 Component가 제거되거나 숨겨지면 Pool에 반환되도록 등록합니다.
+	RegisterAttachedEffect(ActivateableEffect, Parent);
+	RecordEffectSpawn(SpawnEffect, SpawnLocation, ActivateableEffect->GetFXSystemComponent(), true);
 	
-	return ActivateableParticleEffect;
+	return ActivateableEffect;
+}
+
+APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<APRNiagaraEffect>(SpawnEffectAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+APRNiagaraEffect* UPREffectSystemComponent::SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<APRNiagaraEffect>(SpawnEffectAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<APRParticleEffect>(SpawnEffectAtLocation(SpawnEffect, Location, Rotation, Scale, bEffectAutoActivate, bReset));
+}
+
+APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale, bool bEffectAutoActivate, bool bReset)
+{
+	return Cast<APRParticleEffect>(SpawnEffectAttached(SpawnEffect, Parent, AttachSocketName, Location, Rotation, Scale, bEffectAutoActivate, bReset));
 }
 
-APRParticleEffect* UPREffectSystemComponent::GetActivateableParticleEffect(UParticleSystem* ParticleSystem)
+APREffect* UPREffectSystemComponent::GetActivateableEffect(UFXSystemAsset* EffectAsset)
 {
-	// ParticleSystem이 유효하지 않을 경우 nullptr을 반환합니다.
-	if(!ParticleSystem)
+	// EffectAsset이 유효하지 않을 경우 nullptr을 반환합니다.
+	if(!EffectAsset)
 	{
 		return nullptr;
 	}
 
-	// 해당 ParticleSystem에 해당하는 Pool이 생성되었는지 확인하고, 없으면 생성합니다.
-	if(!IsCreateParticlePool(ParticleSystem))
+	// 해당 이펙트에 해당하는 Pool이 생성되었는지 확인하고, 없으면 생성합니다.
+	if(!IsCreateEffectPool(EffectAsset))
 	{
-		FPRParticleEffectPoolSettings ParticlePoolSettings = FPRParticleEffectPoolSettings(ParticleSystem, DynamicPoolSize, DynamicLifespan);
-		CreateParticlePool(ParticlePoolSettings);
+		FPREffectPoolSettings EffectPoolSettings = FPREffectPoolSettings(EffectAsset, DynamicPoolSize, DynamicLifespan);
+		CreateEffectPool(EffectPoolSettings);
 	}
 
-	// ParticlePool에서 해당 ParticleSystem의 Pool을 얻습니다.
-	FPRParticleEffectPool* PoolEntry = ParticlePool.Pool.Find(ParticleSystem);
+	// EffectPool에서 해당 이펙트의 Pool을 얻습니다.
+	FPREffectPool* PoolEntry = EffectPool.Pool.Find(EffectAsset);
 	if(!PoolEntry)
 	{
-		// 지정된 ParticleSystem가 없으면 nullptr을 반환합니다.
+		// 지정된 이펙트가 없으면 nullptr을 반환합니다.
 		return nullptr;
 	}
 
-	// 활성화할 ParticleEffect입니다.	
-	APRParticleEffect* ActivateableParticleEffect = nullptr;
+	// 언로드된 레벨에 미리 배치되었던 이펙트처럼 제거된 이펙트는 Pool에서 제외합니다.
+	PoolEntry->PooledEffects.RemoveAll([](const TObjectPtr<APREffect>& PooledEffect)
+	{
+		return !IsValid(PooledEffect);
+	});
+
+	// 활성화할 이펙트입니다.	
+	APREffect* ActivateableEffect = nullptr;
 
-	// PoolEntry에서 활성화되지 않은 ParticleEffect를 찾습니다.
-	for(const auto& ParticleEffect : PoolEntry->PooledEffects)
+	// PoolEntry에서 활성화되지 않은 이펙트를 찾습니다.
+	for(const auto& PooledEffect : PoolEntry->PooledEffects)
 	{
-		if(!IsActivateParticleEffect(ParticleEffect))
+		if(!IsActivateEffect(PooledEffect))
 		{
-			ActivateableParticleEffect = ParticleEffect;
+			ActivateableEffect = PooledEffect;
 
 			break;
 		}
 	}
 
-	// PoolEntry의 모든 ParticleEffect가 활성화되었을 경우 새로운 ParticleEffect를 생성합니다.
-	if(!ActivateableParticleEffect)
+	// PoolEntry의 모든 이펙트가 활성화되었을 경우 새로운 이펙트를 생성합니다.
+	// 이펙트 품질 단계의 최대 크기에 도달한 Pool은 더 이상 생성하지 않습니다.
+	const bool bDynamicSpawned = !ActivateableEffect;
+	if(bDynamicSpawned)
 	{
-		ActivateableParticleEffect = SpawnDynamicParticleEffectInWorld(ParticleSystem);
+		if(PoolEntry->PooledEffects.Num() >= AppliedEffectScalabilitySettings.MaxPoolSize)
+		{
+			return nullptr;
+		}
+		
+		ActivateableEffect = SpawnDynamicEffectInWorld(EffectAsset);
 	}
+
+	// 예측 확장을 위해 이펙트의 획득을 기록합니다.
+	RecordPoolAcquire(EffectAsset, ActivateableEffect, bDynamicSpawned);
 	
-	// 동적으로 생성된 ParticleEffect일 경우 DynamicEffectDestroyTimer를 정지합니다.
-	if(IsDynamicParticleEffect(ActivateableParticleEffect))
+	// 동적으로 생성된 이펙트일 경우 DynamicEffectDestroyTimer를 정지합니다.
+	if(IsDynamicEffect(ActivateableEffect))
 	{
-		FPRDynamicDestroyObject* DynamicParticleList = DynamicDestroyParticleList.List.Find(ActivateableParticleEffect->GetParticleEffectAsset());
-		if(DynamicParticleList)
+		FPRDynamicDestroyObject* DynamicEffectList = DynamicDestroyEffectList.List.Find(EffectAsset);
+		if(DynamicEffectList)
 		{
-			FTimerHandle* DynamicDestroyTimer = DynamicParticleList->TimerHandles.Find(ActivateableParticleEffect);
+			FTimerHandle* DynamicDestroyTimer = DynamicEffectList->TimerHandles.Find(ActivateableEffect);
 			if(DynamicDestroyTimer)
 			{
 				GetWorld()->GetTimerManager().ClearTimer(*DynamicDestroyTimer);
@@ -632,71 +1907,82 @@ APRParticleEffect* UPREffectSystemComponent::GetActivateableParticleEffect(UPart
 		}
 	}
 	
-	return ActivateableParticleEffect;
+	return ActivateableEffect;
 }
 
-bool UPREffectSystemComponent::IsActivateParticleEffect(APRParticleEffect* ParticleEffect) const
+bool UPREffectSystemComponent::IsActivateEffect(APREffect* Effect) const
 {
-	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 객체가 아니면 false를 반환합니다.
-	if(!IsValid(ParticleEffect) || !IsPoolableObject(ParticleEffect))
+	// 유효하지 않는 이펙트이거나 풀링 가능한 객체가 아니면 false를 반환합니다.
+	if(!IsValid(Effect) || !IsPoolableObject(Effect))
 	{
 		return false;
 	}
 
-	// ParticleSystem에 해당하는 활성화된 Index 목록을 찾습니다.
-	const FPRActivateIndexList* IndexList = ActivateParticleIndexList.List.Find(ParticleEffect->GetParticleEffectAsset());
+	// 이펙트에 해당하는 활성화된 Index 목록을 찾습니다.
+	const FPRActivateIndexList* IndexList = ActivateEffectIndexList.List.Find(Effect->GetEffectAsset());
 	if(IndexList)
 	{
 		// 객체의 PoolIndex를 가져오고 객체가 활성화된 상태인지 확인합니다.
-		const int32 PooledIndex = GetPoolIndex(ParticleEffect);
-		const bool bIsParticleEffectActivated = IsActivateObject(ParticleEffect);
+		const int32 PooledIndex = GetPoolIndex(Effect);
+		const bool bIsEffectActivated = IsActivateObject(Effect);
 
 		// Index 목록에 해당 Index가 포함되어 있고, 객체가 활성화된 상태이면 true를 반환합니다.
-		return IndexList->Indexes.Contains(PooledIndex) && bIsParticleEffectActivated;
+		return IndexList->Indexes.Contains(PooledIndex) && bIsEffectActivated;
 	}
 
 	// 위 조건을 모두 만족하지 않으면 false를 반환합니다.
 	return false;
 }
 
-bool UPREffectSystemComponent::IsCreateParticlePool(UParticleSystem* ParticleSystem) const
+bool UPREffectSystemComponent::IsCreateEffectPool(UFXSystemAsset* EffectAsset) const
 {
-	return ParticlePool.Pool.Contains(ParticleSystem);
+	return EffectPool.Pool.Contains(EffectAsset);
 }
 
-bool UPREffectSystemComponent::IsCreateActivateParticleIndexList(UParticleSystem* ParticleSystem) const
+bool UPREffectSystemComponent::IsCreateActivateEffectIndexList(UFXSystemAsset* EffectAsset) const
 {
-	return ActivateParticleIndexList.List.Contains(ParticleSystem);
+	return ActivateEffectIndexList.List.Contains(EffectAsset);
 }
 
-bool UPREffectSystemComponent::IsCreateUsedParticleIndexList(UParticleSystem* ParticleSystem) const
+bool UPREffectSystemComponent::IsCreateUsedEffectIndexList(UFXSystemAsset* EffectAsset) const
 {
-	return UsedParticleIndexList.List.Contains(ParticleSystem);
+	return UsedEffectIndexList.List.Contains(EffectAsset);
 }
 
-bool UPREffectSystemComponent::IsDynamicParticleEffect(APRParticleEffect* ParticleEffect) const
+bool UPREffectSystemComponent::IsDynamicEffect(APREffect* Effect) const
 {
 	// 주어진 객체가 유효한 풀링 가능한 객체인지 확인합니다.
-	if(!IsPoolableObject(ParticleEffect))
+	if(!IsPoolableObject(Effect))
 	{
 		return false;
 	}
 
-	const FPRDynamicDestroyObject* DynamicParticleList = DynamicDestroyParticleList.List.Find(ParticleEffect->GetParticleEffectAsset());
-	if(DynamicParticleList)
+	const FPRDynamicDestroyObject* DynamicEffectList = DynamicDestroyEffectList.List.Find(Effect->GetEffectAsset());
+	if(DynamicEffectList)
 	{
-		return DynamicParticleList->TimerHandles.Contains(ParticleEffect);
+		return DynamicEffectList->TimerHandles.Contains(Effect);
 	}
 	
 	return false;
 }
 
-void UPREffectSystemComponent::ClearParticlePool(FPRParticleEffectObjectPool& TargetParticlePool)
+FPREffectPoolSettings UPREffectSystemComponent::GetEffectPoolSettingsFromDataTable(UFXSystemAsset* EffectAsset) const
 {
-	// ParticlePool을 제거합니다.
-	for(auto& PoolEntry : ParticlePool.Pool)
+	const FPREffectPoolSettings* EffectPoolSettings = EffectPoolSettingsIndex.Find(EffectAsset);
+	if(EffectPoolSettings)
 	{
-		FPRParticleEffectPool& Pool = PoolEntry.Value;
+		return *EffectPoolSettings;
+	}
+
+	return FPREffectPoolSettings();
+}
+
+void UPREffectSystemComponent::ClearEffectPool(FPREffectObjectPool& TargetEffectPool)
+{
+	// EffectPool을 제거합니다.
+	for(auto& PoolEntry : TargetEffectPool.Pool)
+	{
+		FPREffectPool& Pool = PoolEntry.Value;
 		for(auto& PooledEffect : Pool.PooledEffects)
 		{
 			if(IsValid(PooledEffect))
@@ -710,43 +1996,50 @@ void UPREffectSystemComponent::ClearParticlePool(FPRParticleEffectObjectPool& Ta
 		Pool.PooledEffects.Empty();
 	}
 
-	ParticlePool.Pool.Empty();
+	TargetEffectPool.Pool.Empty();
 }
 
-void UPREffectSystemComponent::CreateParticlePool(const FPRParticleEffectPoolSettings& ParticlePoolSettings)
+void UPREffectSystemComponent::CreateEffectPool(const FPREffectPoolSettings& EffectPoolSettings)
 {
-	if(GetWorld() && ParticlePoolSettings.ParticleSystem)
+	if(GetWorld() && EffectPoolSettings.EffectAsset)
 	{
-		FPRParticleEffectPool NewParticleEffectPool;
+		FPREffectPool NewEffectPool;
 
-		// PoolSize만큼 ParticleEffect를 월드에 Spawn한 후 NewParticleEffectPool에 보관합니다.
-		for(int32 Index = 0; Index < ParticlePoolSettings.PoolSize; Index++)
+		// 이펙트 품질 단계로 조정한 PoolSize만큼 이펙트를 월드에 Spawn한 후 NewEffectPool에 보관합니다.
+		const int32 ScaledPoolSize = GetScaledPoolSize(EffectPoolSettings.PoolSize);
+		for(int32 Index = 0; Index < ScaledPoolSize; Index++)
 		{
-			APRParticleEffect* SpawnParticleEffect = SpawnParticleEffectInWorld(ParticlePoolSettings.ParticleSystem, Index, ParticlePoolSettings.EffectLifespan);
-			if(IsValid(SpawnParticleEffect))
+			APREffect* SpawnEffect = SpawnEffectInWorld(EffectPoolSettings.EffectAsset, Index, EffectPoolSettings.EffectLifespan);
+			if(IsValid(SpawnEffect))
 			{
-				NewParticleEffectPool.PooledEffects.Emplace(SpawnParticleEffect);
+				NewEffectPool.PooledEffects.Emplace(SpawnEffect);
 			}
 		}
 
-		// 초기화된 NewParticleEffectPool를 ParticlePool에 추가하고 ActivateParticleIndexList를 생성합니다.
-		ParticlePool.Pool.Emplace(ParticlePoolSettings.ParticleSystem, NewParticleEffectPool);
+		// NiagaraSystem은 Pool의 첫 번째 이펙트로 한 번 미리 실행하여 처음 사용할 때의 초기화 비용을 로딩 중에 지불합니다.
+		if(bWarmUpNiagaraEffectPool && !NewEffectPool.PooledEffects.IsEmpty())
+		{
+			WarmUpNiagaraEffect(Cast<APRNiagaraEffect>(NewEffectPool.PooledEffects[0]));
+		}
+
+		// 초기화된 NewEffectPool을 EffectPool에 추가합니다.
+		EffectPool.Pool.Emplace(EffectPoolSettings.EffectAsset, NewEffectPool);
 	}
 }
 
-void UPREffectSystemComponent::CreateActivateParticleIndexList(UParticleSystem* ParticleSystem)
+void UPREffectSystemComponent::CreateActivateEffectIndexList(UFXSystemAsset* EffectAsset)
 {
-	if(ParticleSystem)
+	if(EffectAsset)
 	{
-		ActivateParticleIndexList.List.Emplace(ParticleSystem);
+		ActivateEffectIndexList.List.Emplace(EffectAsset);
 	}
 }
 
-void UPREffectSystemComponent::CreateUsedParticleIndexList(UParticleSystem* ParticleSystem)
+void UPREffectSystemComponent::CreateUsedEffectIndexList(UFXSystemAsset* EffectAsset)
 {
-	if(ParticleSystem)
+	if(EffectAsset)
 	{
-		FPRParticleEffectPool* PoolEntry = ParticlePool.Pool.Find(ParticleSystem);
+		FPREffectPool* PoolEntry = EffectPool.Pool.Find(EffectAsset);
 		if(PoolEntry)
 		{
 			FPRUsedIndexList UsedIndexList;
@@ -758,59 +2051,98 @@ void UPREffectSystemComponent::CreateUsedParticleIndexList(UParticleSystem* Part
 				}
 			}
 			
-			UsedParticleIndexList.List.Emplace(ParticleSystem, UsedIndexList);	
+			UsedEffectIndexList.List.Emplace(EffectAsset, UsedIndexList);	
 		}
 	}
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnParticleEffectInWorld(UParticleSystem* ParticleSystem, int32 PoolIndex, float Lifespan)
+APREffect* UPREffectSystemComponent::SpawnEffectInWorld(UFXSystemAsset* EffectAsset, int32 PoolIndex, float Lifespan)
 {
-	if(!GetWorld() || !ParticleSystem || !GetPROwner())
+	if(!GetWorld() || !EffectAsset || !GetPROwner())
 	{
 		return nullptr;
 	}
 
-	// ParticleEffect를 생성합니다.
-	APRParticleEffect* ParticleEffect = GetWorld()->SpawnActor<APRParticleEffect>(APRParticleEffect::StaticClass());
-	if(!IsValid(ParticleEffect))
+	// 레벨에 미리 배치된 이펙트가 있을 경우 SpawnActor 대신 미리 배치된 이펙트를 사용합니다.
+	APREffect* BakedEffect = Cast<APREffect>(ClaimBakedPoolActor(EffectAsset));
+	if(IsValid(BakedEffect))
+	{
+		AdoptBakedEffect(BakedEffect, PoolIndex);
+
+		return BakedEffect;
+	}
+
+	// NiagaraSystem은 PRNiagaraEffect로, ParticleSystem은 PRParticleEffect로 생성합니다.
+	UClass* EffectClass = Cast<UNiagaraSystem>(EffectAsset) ? APRNiagaraEffect::StaticClass() : APRParticleEffect::StaticClass();
+	APREffect* Effect = GetWorld()->SpawnActor<APREffect>(EffectClass);
+	if(!IsValid(Effect))
 	{
-		// ParticleEffect 생성에 실패하면 함수를 종료하고 nullptr을 반환합니다.
+		// 이펙트 생성에 실패하면 함수를 종료하고 nullptr을 반환합니다.
 		return nullptr;
 	}
 
-	// ParticleEffect를 초기화합니다.
-	ParticleEffect->InitializeParticleEffect(ParticleSystem, GetPROwner(), PoolIndex, Lifespan);
+	InitializePooledEffect(Effect, EffectAsset, PoolIndex, Lifespan);
+
+	return Effect;
+}
+
+void UPREffectSystemComponent::InitializePooledEffect(APREffect* Effect, UFXSystemAsset* EffectAsset, int32 PoolIndex, float Lifespan)
+{
+	if(!IsValid(Effect))
+	{
+		return;
+	}
+
+	// 이펙트의 종류에 맞게 이펙트를 초기화합니다.
+	if(APRNiagaraEffect* NiagaraEffect = Cast<APRNiagaraEffect>(Effect))
+	{
+		NiagaraEffect->InitializeNiagaraEffect(Cast<UNiagaraSystem>(EffectAsset), GetPROwner(), PoolIndex, Lifespan);
+	}
+	else if(APRParticleEffect* ParticleEffect = Cast<APRParticleEffect>(Effect))
+	{
+		ParticleEffect->InitializeParticleEffect(Cast<UParticleSystem>(EffectAsset), GetPROwner(), PoolIndex, Lifespan);
+	}
+
+	// 이펙트의 OnEffectDeactivateDelegate 이벤트에 대한 콜백 함수를 바인딩합니다.
+	Effect->OnEffectDeactivateDelegate.AddUniqueDynamic(this, &UPREffectSystemComponent::OnEffectDeactivate);
+}
 
-	// ParticleEffect의 OnEffectDeactivateDelegate 이벤트에 대한 콜백 함수를 바인딩합니다.
-	ParticleEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnParticleEffectDeactivate);
+void UPREffectSystemComponent::AdoptBakedEffect(APREffect* BakedEffect, int32 PoolIndex)
+{
+	if(!IsValid(BakedEffect))
+	{
+		return;
+	}
 
-	return ParticleEffect;
+	// 미리 배치된 이펙트는 Bake할 때 에셋과 수명으로 초기화되었으므로 소유자와 Index만 설정하고 델리게이트를 바인딩합니다.
+	BakedEffect->SetEffectPoolOwner(GetPROwner(), PoolIndex);
+	BakedEffect->OnEffectDeactivateDelegate.AddUniqueDynamic(this, &UPREffectSystemComponent::OnEffectDeactivate);
 }
 
-APRParticleEffect* UPREffectSystemComponent::SpawnDynamicParticleEffectInWorld(UParticleSystem* ParticleSystem)
+APREffect* UPREffectSystemComponent::SpawnDynamicEffectInWorld(UFXSystemAsset* EffectAsset)
 {
-	if(!ParticleSystem)
+	if(!EffectAsset)
 	{
 		return nullptr;
 	}
 	
-	APRParticleEffect* DynamicParticleEffect = nullptr;
+	APREffect* DynamicEffect = nullptr;
 	
 	// Critical Section 시작
 	FCriticalSection CriticalSection;
 	CriticalSection.Lock();
 
-	// 해당 ParticleSystem의 UsedParticleIndexList가 생성되었는지 확인하고, 없으면 생성합니다.
-	if(!IsCreateUsedParticleIndexList(ParticleSystem))
+	// 해당 이펙트의 UsedEffectIndexList가 생성되었는지 확인하고, 없으면 생성합니다.
+	if(!IsCreateUsedEffectIndexList(EffectAsset))
 	{
-		CreateUsedParticleIndexList(ParticleSystem);
+		CreateUsedEffectIndexList(EffectAsset);
 	}
 
-	// UsedParticleIndexList에서 해당 ParticleSystem의 UsedIndexList를 얻습니다.
-	FPRUsedIndexList* UsedIndexList = UsedParticleIndexList.List.Find(ParticleSystem);
+	// UsedEffectIndexList에서 해당 이펙트의 UsedIndexList를 얻습니다.
+	FPRUsedIndexList* UsedIndexList = UsedEffectIndexList.List.Find(EffectAsset);
 	if(UsedIndexList == nullptr)
 	{
-		// 지정된 ParticleSystem이 없습니다.
+		// 지정된 이펙트가 없습니다.
 		return nullptr;
 	}
 
@@ -822,183 +2154,212 @@ APRParticleEffect* UPREffectSystemComponent::SpawnDynamicParticleEffectInWorld(U
 	// Critical Section 끝
 	CriticalSection.Unlock();
 
-	// 새로운 ParticleEffect를 생성하고 초기화합니다.
-	const FPRParticleEffectPoolSettings ParticleEffectSettings = GetParticleEffectPoolSettingsFromDataTable(ParticleSystem);
-	if(ParticleEffectSettings != FPRParticleEffectPoolSettings())
-	{
-		// 데이터 테이블에 ParticleEffect의 설정 값을 가지고 있을 경우 설정 값의 Lifespan을 적용합니다.
-		DynamicParticleEffect = SpawnParticleEffectInWorld(ParticleSystem, NewIndex, ParticleEffectSettings.EffectLifespan);
-	}
-	else
+	// 새로운 이펙트를 생성하고 초기화합니다.
+	// 데이터 테이블에 이펙트의 설정 값을 가지고 있을 경우 설정 값의 Lifespan을, 가지고 있지 않을 경우 DynamicLifespan을 적용합니다.
+	const FPREffectPoolSettings* EffectSettings = EffectPoolSettingsIndex.Find(EffectAsset);
+	DynamicEffect = SpawnEffectInWorld(EffectAsset, NewIndex, EffectSettings ? EffectSettings->EffectLifespan : DynamicLifespan);
+	if(!IsValid(DynamicEffect))
 	{
-		// 데이터 테이블에 ParticleEffect의 설정 값을 가지고 있지 않을 경우 DynamicLifespan을 적용합니다.
-		DynamicParticleEffect = SpawnParticleEffectInWorld(ParticleSystem, NewIndex, DynamicLifespan);
+		return nullptr;
 	}
 		
-	// OnDynamicParticleEffectDeactivate 함수를 바인딩합니다.
-	DynamicParticleEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnDynamicParticleEffectDeactivate);
+	// OnDynamicEffectDeactivate 함수를 바인딩합니다.
+	DynamicEffect->OnEffectDeactivateDelegate.AddDynamic(this, &UPREffectSystemComponent::OnDynamicEffectDeactivate);
 
-	// ParticlePool에서 해당 ParticleSystem의 Pool을 얻습니다.
-	FPRParticleEffectPool* PoolEntry = ParticlePool.Pool.Find(ParticleSystem);
+	// EffectPool에서 해당 이펙트의 Pool을 얻습니다.
+	FPREffectPool* PoolEntry = EffectPool.Pool.Find(EffectAsset);
 	if(!PoolEntry)
 	{
-		// Pool이 없을 경우 생성한 ParticleEffect를 제거하고 nullptr을 반환합니다.
-		DynamicParticleEffect->ConditionalBeginDestroy();
+		// Pool이 없을 경우 생성한 이펙트를 제거하고 nullptr을 반환합니다.
+		DynamicEffect->ConditionalBeginDestroy();
 		
 		return nullptr;
 	}
 
-	// 새로 생성한 ParticleEffect를 PoolEntry에 추가합니다.
-	PoolEntry->PooledEffects.Emplace(DynamicParticleEffect);
+	// 새로 생성한 이펙트를 PoolEntry에 추가합니다.
+	PoolEntry->PooledEffects.Emplace(DynamicEffect);
+
+	return DynamicEffect;
+}
+
+bool UPREffectSystemComponent::CanDispatchEffectSpawn(UFXSystemAsset*& SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, const USceneComponent* AttachParent, bool bEffectAutoActivate, bool bReset)
+{
+	// 비교를 위해 Spawn하는 이펙트는 모든 조건을 통과합니다.
+	if(bSkipEffectSpawnGates)
+	{
+		return true;
+	}
+	
+	const bool bAttached = AttachParent != nullptr;
+
+	// 위치에 Spawn하는 이펙트는 요청할 때 한 번만 이펙트 품질 단계의 Spawn 확률을 적용합니다.
+	// 지연하거나 미룬 요청은 이미 확률을 통과한 요청이므로 다시 Spawn할 때는 적용하지 않습니다.
+	if(!bAttached && !bSkipEffectSpawnProbability && !PassesEffectSpawnProbability(SpawnEffect))
+	{
+		return false;
+	}
+
+	// Significance를 평가하여 Spawn하지 않거나, 지연하거나, 가벼운 이펙트로 대체합니다.
+	if(!ApplyEffectSignificance(SpawnEffect, Location, Rotation, Scale, AttachParent, bEffectAutoActivate, bReset))
+	{
+		return false;
+	}
 
-	return DynamicParticleEffect;
+	// 프레임당 Spawn 예산을 초과하면 미루거나 버리고, 가까운 곳에 같은 이펙트가 있으면 기존 이펙트에 병합합니다.
+	return ApplyEffectSpawnBudget(SpawnEffect, Location, Rotation, Scale, bAttached, bEffectAutoActivate, bReset);
 }
 
-APRParticleEffect* UPREffectSystemComponent::InitializeParticleEffect(UParticleSystem* SpawnEffect)
+APREffect* UPREffectSystemComponent::InitializeEffect(UFXSystemAsset* SpawnEffect)
 {
-	APRParticleEffect* ActivateableParticleEffect = GetActivateableParticleEffect(SpawnEffect);
+	APREffect* ActivateableEffect = GetActivateableEffect(SpawnEffect);
 	
-	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 객체가 아니면 nullptr를 반환합니다.
-	if(!IsValid(ActivateableParticleEffect) || !IsPoolableObject(ActivateableParticleEffect))
+	// 유효하지 않는 이펙트이거나 풀링 가능한 객체가 아니면 nullptr를 반환합니다.
+	if(!IsValid(ActivateableEffect) || !IsPoolableObject(ActivateableEffect))
 	{
 		return nullptr;
 	}
 
-	// 동적으로 생성한 ParticleEffect일 경우 DynamicObjectDestroyTimer가 작동 중이라면 DynamicObjectDestroyTimer를 정지합니다.
-	FTimerHandle* DynamicObjectDestroyTimer = DynamicDestroyParticleList.FindTimerHandleForParticleEffect(*ActivateableParticleEffect);
+	// 동적으로 생성한 이펙트일 경우 DynamicObjectDestroyTimer가 작동 중이라면 DynamicObjectDestroyTimer를 정지합니다.
+	FTimerHandle* DynamicObjectDestroyTimer = DynamicDestroyEffectList.FindTimerHandleForEffect(*ActivateableEffect);
 	if(DynamicObjectDestroyTimer)
 	{
 		GetWorld()->GetTimerManager().ClearTimer(*DynamicObjectDestroyTimer);
 	}
 	
-	// 해당 ParticleSystem를 처음 활성화하는 경우 ActivateParticleEffectIndexList를 생성합니다.
-	if(!IsCreateActivateParticleIndexList(SpawnEffect))
+	// 해당 이펙트를 처음 활성화하는 경우 ActivateEffectIndexList를 생성합니다.
+	if(!IsCreateActivateEffectIndexList(SpawnEffect))
 	{
-		CreateActivateParticleIndexList(SpawnEffect);
+		CreateActivateEffectIndexList(SpawnEffect);
 	}
 
-	// 활성화된 ParticleEffect의 Index를 ActivateParticleIndexList에 저장합니다.
-	const int32 PoolIndex = GetPoolIndex(ActivateableParticleEffect);
-	ActivateParticleIndexList.GetIndexesForParticleSystem(*SpawnEffect)->Add(PoolIndex);
+	// 활성화된 이펙트의 Index를 ActivateEffectIndexList에 저장합니다.
+	const int32 PoolIndex = GetPoolIndex(ActivateableEffect);
+	ActivateEffectIndexList.GetIndexesForEffectAsset(*SpawnEffect)->Add(PoolIndex);
 	
-	return ActivateableParticleEffect;
+	return ActivateableEffect;
 }
 
-void UPREffectSystemComponent::ClearDynamicDestroyParticleList(FPRDynamicDestroyParticleEffectList& TargetDynamicDestroyParticleEffectList)
+void UPREffectSystemComponent::ClearDynamicDestroyEffectList(FPRDynamicDestroyEffectList& TargetDynamicDestroyEffectList)
 {
-	ClearDynamicDestroyObjects(TargetDynamicDestroyParticleEffectList.List);
+	ClearDynamicDestroyObjects(TargetDynamicDestroyEffectList.List);
 }
 
-FPRParticleEffectPoolSettings UPREffectSystemComponent::GetParticleEffectPoolSettingsFromDataTable(UParticleSystem* ParticleSystem) const
+void UPREffectSystemComponent::RefreshEffectPoolSettingsIndex()
 {
-	if(ParticlePoolSettingsDataTable != nullptr)
+	EffectPoolSettingsIndex.Empty();
+
+	// 같은 이펙트가 여러 행에 있을 경우 처음 행의 설정 값을 사용합니다.
+	if(NiagaraPoolSettingsDataTable)
 	{
-		TArray<FName> RowNames = ParticlePoolSettingsDataTable->GetRowNames();
-		for(const FName& RowName: RowNames)
+		NiagaraPoolSettingsDataTable->ForeachRow<FPRNiagaraEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRNiagaraEffectPoolSettings& NiagaraSettings)
 		{
-			FPRParticleEffectPoolSettings* ParticleEffectPoolSettings = ParticlePoolSettingsDataTable->FindRow<FPRParticleEffectPoolSettings>(RowName, FString(""));
-			if(ParticleEffectPoolSettings
-				&& ParticleEffectPoolSettings->ParticleSystem == ParticleSystem)
+			if(NiagaraSettings.NiagaraSystem && !EffectPoolSettingsIndex.Contains(NiagaraSettings.NiagaraSystem))
 			{
-				return *ParticleEffectPoolSettings;
+				EffectPoolSettingsIndex.Emplace(NiagaraSettings.NiagaraSystem, FPREffectPoolSettings(NiagaraSettings));
 			}
-		}
+		});
 	}
 
-	return FPRParticleEffectPoolSettings();
+	if(ParticlePoolSettingsDataTable)
+	{
+		ParticlePoolSettingsDataTable->ForeachRow<FPRParticleEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRParticleEffectPoolSettings& ParticleSettings)
+		{
+			if(ParticleSettings.ParticleSystem && !EffectPoolSettingsIndex.Contains(ParticleSettings.ParticleSystem))
+			{
+				EffectPoolSettingsIndex.Emplace(ParticleSettings.ParticleSystem, FPREffectPoolSettings(ParticleSettings));
+			}
+		});
+	}
 }
 
-void UPREffectSystemComponent::OnParticleEffectDeactivate(APREffect* TargetEffect)
+void UPREffectSystemComponent::OnEffectDeactivate(APREffect* TargetEffect)
 {
-	APRParticleEffect* TargetParticleEffect = Cast<APRParticleEffect>(TargetEffect);
-	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 ParticleEffect가 아니거나 ParticleComponent가 없으면 반환합니다.
-	if(!IsValid(TargetParticleEffect)
-		|| !IsPoolableObject(TargetParticleEffect)
-		|| !TargetParticleEffect->GetParticleEffect())
+	// 부착된 이펙트의 목록에서 제거합니다.
+	UnregisterAttachedEffect(TargetEffect);
+
+	// 유효하지 않는 이펙트이거나 풀링 가능한 이펙트가 아니거나 FXSystemComponent가 없으면 반환합니다.
+	if(!IsValid(TargetEffect)
+		|| !IsPoolableObject(TargetEffect)
+		|| !TargetEffect->GetFXSystemComponent())
 	{
 		return;
 	}
 
-	// TargetParticleEffect가 활성화된 상태라면 비활성화합니다.
-	if(IsActivateParticleEffect(TargetParticleEffect))
+	// TargetEffect가 활성화된 상태라면 비활성화합니다.
+	if(IsActivateEffect(TargetEffect))
 	{
-		FPRActivateIndexList* ActivateIndexList = ActivateParticleIndexList.List.Find(TargetParticleEffect->GetParticleEffectAsset());
+		FPRActivateIndexList* ActivateIndexList = ActivateEffectIndexList.List.Find(TargetEffect->GetEffectAsset());
 		if(ActivateIndexList)
 		{
-			// 비활성화된 TargetParticleEffect의 Index를 제거합니다.
-			ActivateIndexList->Indexes.Remove(GetPoolIndex(TargetParticleEffect));
+			// 비활성화된 TargetEffect의 Index를 제거합니다.
+			ActivateIndexList->Indexes.Remove(GetPoolIndex(TargetEffect));
 		}
 	}
 }
 
-void UPREffectSystemComponent::OnDynamicParticleEffectDeactivate(APREffect* TargetEffect)
+void UPREffectSystemComponent::OnDynamicEffectDeactivate(APREffect* TargetEffect)
 {
-	APRParticleEffect* TargetParticleEffect = Cast<APRParticleEffect>(TargetEffect);
-	// 유효하지 않는 ParticleEffect이거나 풀링 가능한 ParticleEffect가 아니거나 ParticleComponent가 없으면 반환합니다.
-	if(!IsValid(TargetParticleEffect)
-		|| !IsPoolableObject(TargetParticleEffect)
-		|| !TargetParticleEffect->GetParticleEffect())
+	// 유효하지 않는 이펙트이거나 풀링 가능한 이펙트가 아니거나 FXSystemComponent가 없으면 반환합니다.
+	if(!IsValid(TargetEffect)
+		|| !IsPoolableObject(TargetEffect)
+		|| !TargetEffect->GetFXSystemComponent())
 	{
 		return;
 	}
 
 	if(DynamicLifespan > 0.0f)
 	{
-		// 동적 수명이 끝난 후 ParticleEffect를 제거하도록 타이머를 설정합니다.
+		// 동적 수명이 끝난 후 이펙트를 제거하도록 타이머를 설정합니다.
 		FTimerHandle DynamicLifespanTimerHandle;
-		FTimerDelegate DynamicLifespanDelegate = FTimerDelegate::CreateUObject(this, &UPREffectSystemComponent::OnDynamicParticleEffectDestroy, TargetParticleEffect);
+		FTimerDelegate DynamicLifespanDelegate = FTimerDelegate::CreateUObject(this, &UPREffectSystemComponent::OnDynamicEffectDestroy, TargetEffect);
 		GetWorld()->GetTimerManager().SetTimer(DynamicLifespanTimerHandle, DynamicLifespanDelegate, DynamicLifespan, false);
 
 		// TimerHandle을 추가합니다.
-		FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyParticleList.List.Find(TargetParticleEffect->GetParticleEffectAsset());
-		if(DynamicDestroyObject)
-		{
-			DynamicDestroyObject->TimerHandles.Emplace(TargetParticleEffect, DynamicLifespanTimerHandle);
-		}
-		else
-		{
-			FPRDynamicDestroyObject NewDynamicDestroyObject;
-			NewDynamicDestroyObject.TimerHandles.Emplace(TargetParticleEffect, DynamicLifespanTimerHandle);
-			DynamicDestroyParticleList.List.Emplace(TargetParticleEffect->GetParticleEffectAsset(), NewDynamicDestroyObject);
-		}
+		FPRDynamicDestroyObject& DynamicDestroyObject = DynamicDestroyEffectList.List.FindOrAdd(TargetEffect->GetEffectAsset());
+		DynamicDestroyObject.TimerHandles.Emplace(TargetEffect, DynamicLifespanTimerHandle);
 	}
 	else
 	{
-		// 동적 수명이 없을 경우 타이머를 실행하지 않고 바로 ParticleEffect를 제거합니다.
-		OnDynamicParticleEffectDestroy(TargetParticleEffect);
+		// 동적 수명이 없을 경우 타이머를 실행하지 않고 바로 이펙트를 제거합니다.
+		OnDynamicEffectDestroy(TargetEffect);
 	}
 }
 
-void UPREffectSystemComponent::OnDynamicParticleEffectDestroy(APRParticleEffect* TargetParticleEffect)
+void UPREffectSystemComponent::OnDynamicEffectDestroy(APREffect* TargetEffect)
 {
+	// 부착된 이펙트의 목록과 예측 확장으로 생성한 이펙트의 목록에서 제거합니다.
+	UnregisterAttachedEffect(TargetEffect);
+	RemovePredictivelyGrownObject(TargetEffect);
+
+	UFXSystemAsset* EffectAsset = TargetEffect->GetEffectAsset();
+
 	// DynamicObjectDestroyTimer를 제거합니다.
-	FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyParticleList.List.Find(TargetParticleEffect->GetParticleEffectAsset());
+	FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyEffectList.List.Find(EffectAsset);
 	if(DynamicDestroyObject)
 	{
-		FTimerHandle* TimerHandle = DynamicDestroyObject->TimerHandles.Find(TargetParticleEffect);
-		GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-		DynamicDestroyObject->TimerHandles.Remove(TargetParticleEffect);
+		FTimerHandle* TimerHandle = DynamicDestroyObject->TimerHandles.Find(TargetEffect);
+		if(TimerHandle)
+		{
+			GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
+		}
+		DynamicDestroyObject->TimerHandles.Remove(TargetEffect);
 	}
 
-	// ParticleSystem의 UsedObjectIndex를 얻습니다.
-	FPRUsedIndexList* UsedIndexList = UsedParticleIndexList.List.Find(TargetParticleEffect->GetParticleEffectAsset());
+	// 이펙트의 UsedObjectIndex를 얻습니다.
+	FPRUsedIndexList* UsedIndexList = UsedEffectIndexList.List.Find(EffectAsset);
 	if(UsedIndexList)
 	{
 		// 사용 중인 Index를 제거합니다.
-		UsedIndexList->Indexes.Remove(GetPoolIndex(TargetParticleEffect));
+		UsedIndexList->Indexes.Remove(GetPoolIndex(TargetEffect));
 	}
 
-	// ParticleSystem의 Pool이 생성되었는지 확인합니다.
-	if(IsCreateParticlePool(TargetParticleEffect->GetParticleEffectAsset()))
+	// EffectPool에서 이펙트를 제거합니다.
+	FPREffectPool* PoolEntry = EffectPool.Pool.Find(EffectAsset);
+	if(PoolEntry)
 	{
-		// ParticlePool에서 ParticleEffect를 제거합니다.
-		FPRParticleEffectPool* PoolEntry = ParticlePool.Pool.Find(TargetParticleEffect->GetParticleEffectAsset());
-		if(PoolEntry)
-		{
-			PoolEntry->PooledEffects.Remove(TargetParticleEffect);
-		}
+		PoolEntry->PooledEffects.Remove(TargetEffect);
 	}
 		
-	TargetParticleEffect->ConditionalBeginDestroy();
+	TargetEffect->ConditionalBeginDestroy();
 }
 #pragma endregion 
@@ -41,6 +41,100 @@ void UPRObjectPoolSystemComponent::ClearAllObjectPool()
 	UsedObjectIndexList.List.Empty();
 	ClearDynamicDestroyObjectList(DynamicDestroyObjectList);
 	ClearObjectPool(ObjectPool);
+
+	Super::ClearAllObjectPool();
+}
+
+int32 UPRObjectPoolSystemComponent::GetPoolCapacity(UObject* PoolKey) const
+{
+	const FPRPool* PoolEntry = ObjectPool.Pool.Find(Cast<UClass>(PoolKey));
+	if(PoolEntry)
+	{
+		return PoolEntry->PooledObjects.Num();
+	}
+
+	return 0;
+}
+
+int32 UPRObjectPoolSystemComponent::GetActivatePoolObjectCount(UObject* PoolKey) const
+{
+	const FPRActivateIndexList* ActivateIndexList = ActivateObjectIndexList.List.Find(Cast<UClass>(PoolKey));
+	if(ActivateIndexList)
+	{
+		return ActivateIndexList->Indexes.Num();
+	}
+
+	return 0;
+}
+
+void UPRObjectPoolSystemComponent::AdoptBakedPoolActors()
+{
+	for(auto& PoolEntry : ObjectPool.Pool)
+	{
+		// 언로드된 레벨에 미리 배치되었던 오브젝트는 제거되었으므로 Pool에서 제외합니다.
+		PoolEntry.Value.PooledObjects.RemoveAll([](const TObjectPtr<APRPooledObject>& PooledObject)
+		{
+			return !IsValid(PooledObject);
+		});
+
+		// 미리 배치된 오브젝트는 예측 확장으로 늘릴 수 있는 Pool의 최대 크기까지만 추가합니다.
+		if(PoolEntry.Value.PooledObjects.Num() >= MaxPredictivePoolSize)
+		{
+			continue;
+		}
+		
+		// Pool에서 사용 중인 Index를 구합니다.
+		TSet<int32> UsedIndexes;
+		for(const auto& PooledObject : PoolEntry.Value.PooledObjects)
+		{
+			UsedIndexes.Add(GetPoolIndex(PooledObject));
+		}
+
+		FPRUsedIndexList* UsedIndexList = UsedObjectIndexList.List.Find(PoolEntry.Key);
+		if(UsedIndexList)
+		{
+			UsedIndexes.Append(UsedIndexList->Indexes);
+		}
+
+		// 미리 배치된 오브젝트는 Bake할 때 초기화되었으므로 소유자와 사용 가능한 Index만 설정한 후 Pool에 추가합니다.
+		while(PoolEntry.Value.PooledObjects.Num() < MaxPredictivePoolSize)
+		{
+			APRPooledObject* BakedObject = Cast<APRPooledObject>(ClaimBakedPoolActor(PoolEntry.Key));
+			if(!BakedObject)
+			{
+				break;
+			}
+			
+			const int32 NewIndex = FindAvailableIndex(UsedIndexes);
+			UsedIndexes.Add(NewIndex);
+			if(UsedIndexList)
+			{
+				UsedIndexList->Indexes.Add(NewIndex);
+			}
+
+			BakedObject->SetObjectPoolOwner(GetOwner(), NewIndex);
+			BakedObject->OnPooledObjectDeactivateDelegate.AddUniqueDynamic(this, &UPRObjectPoolSystemComponent::OnPooledObjectDeactivate);
+			PoolEntry.Value.PooledObjects.Emplace(BakedObject);
+		}
+	}
+}
+
+UObject* UPRObjectPoolSystemComponent::GrowPool(UObject* PoolKey)
+{
+	TSubclassOf<APRPooledObject> PooledObjectClass = Cast<UClass>(PoolKey);
+	if(!PooledObjectClass || !IsCreateObjectPool(PooledObjectClass))
+	{
+		return nullptr;
+	}
+
+	// 미리 생성한 오브젝트는 동적으로 생성한 오브젝트처럼 사용되지 않으면 DynamicLifespan 후에 제거됩니다.
+	APRPooledObject* GrownObject = SpawnDynamicObjectInWorld(PooledObjectClass);
+	if(IsValid(GrownObject))
+	{
+		OnDynamicObjectDeactivate(GrownObject);
+	}
+
+	return GrownObject;
 }
 #pragma endregion
 
@@ -113,6 +207,12 @@ APRPooledObject* UPRObjectPoolSystemComponent::GetActivateablePooledObject(TSubc
 		return nullptr;
 	}
 	
+	// 언로드된 레벨에 미리 배치되었던 오브젝트처럼 제거된 오브젝트는 Pool에서 제외합니다.
+	PoolEntry->PooledObjects.RemoveAll([](const TObjectPtr<APRPooledObject>& PooledObject)
+	{
+		return !IsValid(PooledObject);
+	});
+	
 	// 활성화할 오브젝트입니다.
 	APRPooledObject* ActivateablePooledObject = nullptr;
 
@@ -128,11 +228,15 @@ APRPooledObject* UPRObjectPoolSystemComponent::GetActivateablePooledObject(TSubc
 	}
 
 	// PoolEntry의 모든 오브젝트가 활성화되었을 경우 새로운 오브젝트를 생성합니다.
-	if(!ActivateablePooledObject)
+	const bool bDynamicSpawned = !ActivateablePooledObject;
+	if(bDynamicSpawned)
 	{
 		ActivateablePooledObject = SpawnDynamicObjectInWorld(PooledObjectClass);
 	}
 
+	// 예측 확장을 위해 오브젝트의 획득을 기록합니다.
+	RecordPoolAcquire(PooledObjectClass, ActivateablePooledObject, bDynamicSpawned);
+
 	// 동적으로 생성된 오브젝트일 경우 DynamicDestroyTimer를 정지합니다.
 	if(IsDynamicPooledObject(ActivateablePooledObject))
 	{
@@ -304,6 +408,17 @@ APRPooledObject* UPRObjectPoolSystemComponent::SpawnDynamicObjectInWorld(TSubcla
 
 APRPooledObject* UPRObjectPoolSystemComponent::SpawnAndInitializeObject(TSubclassOf<APRPooledObject> ObjectClass, int32 Index)
 {
+	// 레벨에 미리 배치된 오브젝트가 있을 경우 SpawnActor 대신 사용합니다.
+	// 미리 배치된 오브젝트는 Bake할 때 초기화되었으므로 소유자와 Index만 설정하고 OnPooledObjectDeactivate 함수를 바인딩합니다.
+	APRPooledObject* BakedObject = Cast<APRPooledObject>(ClaimBakedPoolActor(ObjectClass));
+	if(IsValid(BakedObject))
+	{
+		BakedObject->SetObjectPoolOwner(GetOwner(), Index);
+		BakedObject->OnPooledObjectDeactivateDelegate.AddUniqueDynamic(this, &UPRObjectPoolSystemComponent::OnPooledObjectDeactivate);
+
+		return BakedObject;
+	}
+	
 	APRPooledObject* SpawnObject = SpawnObjectInWorld(ObjectClass);
 	if(IsValid(SpawnObject))
 	{
@@ -425,6 +540,9 @@ void UPRObjectPoolSystemComponent::OnDynamicObjectDeactivate(APRPooledObject* Po
 
 void UPRObjectPoolSystemComponent::OnDynamicObjectDestroy(APRPooledObject* PooledObject)
 {
+	// 예측 확장으로 생성한 오브젝트의 목록에서 제거합니다.
+	RemovePredictivelyGrownObject(PooledObject);
+	
 	// DynamicObjectDestroyTimer를 제거합니다.
 	FPRDynamicDestroyObject* DynamicDestroyObject = DynamicDestroyObjectList.List.Find(PooledObject->GetClass());
 	if(DynamicDestroyObject)
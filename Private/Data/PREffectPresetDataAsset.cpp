@@ -0,0 +1,19 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Data/PREffectPresetDataAsset.h"
+
+UPREffectPresetDataAsset::UPREffectPresetDataAsset()
+{
+	FXEntries.Empty();
+	SoundEntries.Empty();
+	DecalEntries.Empty();
+	CameraShakeEntries.Empty();
+	Lifespan = 3.0f;
+	PoolSize = 2;
+}
+
+bool UPREffectPresetDataAsset::IsEmpty() const
+{
+	return FXEntries.IsEmpty() && SoundEntries.IsEmpty() && DecalEntries.IsEmpty() && CameraShakeEntries.IsEmpty();
+}
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Effects/PRCompositeEffect.h"
+#include "Data/PREffectPresetDataAsset.h"
+#include "Subsystems/PRAudioSubsystem.h"
+#include "Subsystems/PRDecalSubsystem.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Camera/CameraShakeBase.h"
+#include "Kismet/GameplayStatics.h"
+
+APRCompositeEffect::APRCompositeEffect()
+{
+	EffectRoot = CreateDefaultSubobject<USceneComponent>(TEXT("EffectRoot"));
+	SetRootComponent(EffectRoot);
+
+	EffectPreset = nullptr;
+	FXSystemComponents.Empty();
+	ActiveFXSystemCount = 0;
+}
+
+void APRCompositeEffect::InitializeCompositeEffect(UPREffectPresetDataAsset* NewEffectPreset, AActor* NewEffectOwner, int32 NewPoolIndex)
+{
+	InitializeEffect(NewEffectOwner, NewPoolIndex, IsValid(NewEffectPreset) ? NewEffectPreset->Lifespan : 0.0f);
+
+	// 프리셋이 바뀌었을 경우에만 FXSystemComponent들을 다시 생성합니다.
+	if(EffectPreset != NewEffectPreset)
+	{
+		EffectPreset = NewEffectPreset;
+		CreateFXSystemComponents();
+	}
+
+	for(UFXSystemComponent* FXSystemComponent : FXSystemComponents)
+	{
+		if(IsValid(FXSystemComponent))
+		{
+			FXSystemComponent->Deactivate();
+		}
+	}
+
+	ActiveFXSystemCount = 0;
+}
+
+void APRCompositeEffect::ActivateEffect(bool bReset)
+{
+	TGuardValue<bool> ActivatingEffectGuard(bActivatingEffect, true);
+	Super::ActivateEffect();
+
+	if(!IsValid(EffectPreset))
+	{
+		return;
+	}
+
+	// 모든 FXSystemComponent는 액터의 Transform을 기준으로 부착되어 있으므로 한 번의 Transform 적용으로 함께 이동합니다.
+	ActiveFXSystemCount = 0;
+	for(int32 Index = 0; Index < FXSystemComponents.Num(); Index++)
+	{
+		UFXSystemComponent* FXSystemComponent = FXSystemComponents[Index];
+		if(!IsValid(FXSystemComponent))
+		{
+			continue;
+		}
+
+		UNiagaraComponent* NiagaraComponent = Cast<UNiagaraComponent>(FXSystemComponent);
+		if(NiagaraComponent && EffectPreset->FXEntries.IsValidIndex(Index))
+		{
+			EffectPreset->FXEntries[Index].NiagaraParameters.ApplyToComponent(NiagaraComponent);
+		}
+
+		FXSystemComponent->Activate(bReset);
+		ActiveFXSystemCount++;
+	}
+
+	PlayPresetSounds();
+	PlacePresetDecals();
+	PlayPresetCameraShakes();
+
+	// 실행이 끝나는 이펙트도 수명도 없을 경우 사운드, 데칼, 카메라 셰이크만 실행하고 바로 Pool에 반환합니다.
+	if(ActiveFXSystemCount == 0 && EffectLifespan <= 0.0f)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(this, &APRCompositeEffect::OnDeactivate);
+	}
+}
+
+void APRCompositeEffect::DeactivateEffect()
+{
+	Super::DeactivateEffect();
+
+	for(UFXSystemComponent* FXSystemComponent : FXSystemComponents)
+	{
+		if(IsValid(FXSystemComponent))
+		{
+			FXSystemComponent->Deactivate();
+		}
+	}
+
+	ActiveFXSystemCount = 0;
+}
+
+UFXSystemComponent* APRCompositeEffect::GetFXSystemComponent() const
+{
+	for(UFXSystemComponent* FXSystemComponent : FXSystemComponents)
+	{
+		if(IsValid(FXSystemComponent))
+		{
+			return FXSystemComponent;
+		}
+	}
+
+	return nullptr;
+}
+
+void APRCompositeEffect::CreateFXSystemComponents()
+{
+	for(UFXSystemComponent* FXSystemComponent : FXSystemComponents)
+	{
+		if(IsValid(FXSystemComponent))
+		{
+			FXSystemComponent->DestroyComponent();
+		}
+	}
+
+	FXSystemComponents.Empty();
+	if(!IsValid(EffectPreset))
+	{
+		return;
+	}
+
+	// FXEntries와 같은 Index를 사용하도록 생성하지 못한 항목도 nullptr로 추가합니다.
+	FXSystemComponents.Reserve(EffectPreset->FXEntries.Num());
+	for(const FPREffectPresetFXEntry& FXEntry : EffectPreset->FXEntries)
+	{
+		UFXSystemComponent* FXSystemComponent = nullptr;
+		if(UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(FXEntry.FXSystem))
+		{
+			UNiagaraComponent* NiagaraComponent = NewObject<UNiagaraComponent>(this);
+			NiagaraComponent->SetAutoActivate(false);
+			NiagaraComponent->SetAsset(NiagaraSystem);
+			NiagaraComponent->OnSystemFinished.AddUniqueDynamic(this, &APRCompositeEffect::OnNiagaraSystemFinished);
+			FXSystemComponent = NiagaraComponent;
+		}
+		else if(UParticleSystem* ParticleSystem = Cast<UParticleSystem>(FXEntry.FXSystem))
+		{
+			UParticleSystemComponent* ParticleSystemComponent = NewObject<UParticleSystemComponent>(this);
+			ParticleSystemComponent->SetAutoActivate(false);
+			ParticleSystemComponent->SetTemplate(ParticleSystem);
+			ParticleSystemComponent->OnSystemFinished.AddUniqueDynamic(this, &APRCompositeEffect::OnParticleSystemFinished);
+			FXSystemComponent = ParticleSystemComponent;
+		}
+
+		if(FXSystemComponent)
+		{
+			FXSystemComponent->SetupAttachment(EffectRoot);
+			FXSystemComponent->SetRelativeTransform(FTransform(FXEntry.RotationOffset, FXEntry.LocationOffset, FXEntry.Scale));
+			FXSystemComponent->RegisterComponent();
+		}
+
+		FXSystemComponents.Emplace(FXSystemComponent);
+	}
+}
+
+void APRCompositeEffect::PlayPresetSounds() const
+{
+	if(EffectPreset->SoundEntries.IsEmpty())
+	{
+		return;
+	}
+
+	UPRAudioSubsystem* AudioSubsystem = GetWorld()->GetSubsystem<UPRAudioSubsystem>();
+	const FTransform& EffectTransform = GetActorTransform();
+	for(const FPREffectPresetSoundEntry& SoundEntry : EffectPreset->SoundEntries)
+	{
+		if(!SoundEntry.Sound)
+		{
+			continue;
+		}
+
+		const FVector SoundLocation = EffectTransform.TransformPosition(SoundEntry.LocationOffset);
+		if(AudioSubsystem)
+		{
+			AudioSubsystem->PlaySoundAtLocation(SoundEntry.Sound, SoundLocation, TArray<FAudioParameter>(), SoundEntry.VolumeMultiplier, SoundEntry.PitchMultiplier);
+		}
+		else
+		{
+			UGameplayStatics::PlaySoundAtLocation(this, SoundEntry.Sound, SoundLocation, SoundEntry.VolumeMultiplier, SoundEntry.PitchMultiplier);
+		}
+	}
+}
+
+void APRCompositeEffect::PlacePresetDecals() const
+{
+	if(EffectPreset->DecalEntries.IsEmpty())
+	{
+		return;
+	}
+
+	UPRDecalSubsystem* DecalSubsystem = GetWorld()->GetSubsystem<UPRDecalSubsystem>();
+	if(!DecalSubsystem)
+	{
+		return;
+	}
+
+	const FTransform& EffectTransform = GetActorTransform();
+	for(const FPREffectPresetDecalEntry& DecalEntry : EffectPreset->DecalEntries)
+	{
+		const FVector DecalLocation = EffectTransform.TransformPosition(DecalEntry.LocationOffset);
+		const FRotator DecalRotation = EffectTransform.TransformRotation(DecalEntry.RotationOffset.Quaternion()).Rotator();
+		DecalSubsystem->AddDecal(DecalEntry.DecalMaterial, DecalLocation, DecalRotation, DecalEntry.DecalSize);
+	}
+}
+
+void APRCompositeEffect::PlayPresetCameraShakes() const
+{
+	const FTransform& EffectTransform = GetActorTransform();
+	for(const FPREffectPresetCameraShakeEntry& CameraShakeEntry : EffectPreset->CameraShakeEntries)
+	{
+		if(CameraShakeEntry.CameraShake)
+		{
+			UGameplayStatics::PlayWorldCameraShake(this, CameraShakeEntry.CameraShake, EffectTransform.TransformPosition(CameraShakeEntry.LocationOffset),
+													CameraShakeEntry.InnerRadius, CameraShakeEntry.OuterRadius, CameraShakeEntry.Falloff);
+		}
+	}
+}
+
+void APRCompositeEffect::OnNiagaraSystemFinished(UNiagaraComponent* FinishedComponent)
+{
+	OnFXSystemComponentFinished();
+}
+
+void APRCompositeEffect::OnParticleSystemFinished(UParticleSystemComponent* FinishedComponent)
+{
+	OnFXSystemComponentFinished();
+}
+
+void APRCompositeEffect::OnFXSystemComponentFinished()
+{
+	// Reset으로 이전 실행이 끝난 경우는 무시합니다.
+	if(!bActivate || bActivatingEffect)
+	{
+		return;
+	}
+
+	ActiveFXSystemCount = FMath::Max(ActiveFXSystemCount - 1, 0);
+	if(ActiveFXSystemCount == 0)
+	{
+		OnFXSystemFinished();
+	}
+}
@@ -12,6 +12,8 @@ APREffect::APREffect()
 	EffectLifespan = 0.0f;
 	EffectOwner = nullptr;
 	PoolIndex = INDEX_NONE;
+	ActivationCount = 0;
+	bActivatingEffect = false;
 }
 
 void APREffect::BeginPlay()
@@ -41,6 +43,11 @@ int32 APREffect::GetPoolIndex_Implementation() const
 	return PoolIndex;
 }
 
+int32 APREffect::GetActivationCount_Implementation() const
+{
+	return ActivationCount;
+}
+
 float APREffect::GetLifespan_Implementation() const
 {
 	return GetEffectLifespan();
@@ -85,9 +92,10 @@ void APREffect::SpawnEffectAttached(USceneComponent* Parent, FName AttachSocketN
 void APREffect::ActivateEffect(bool bReset)
 {
 	bActivate = true;
+	ActivationCount++;
 	SetActorHiddenInGame(!bActivate);
 
-	UKismetSystemLibrary::DrawDebugSphere(GetWorld(), GetActorLocation(), 50.0f, 12, FLinearColor::White, 3.0f);
+	PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Effects, false, DrawDebugSphere(GetWorld(), GetActorLocation(), 50.0f, 12, FColor::White, false, 3.0f));
 
 	// 이펙트의 수명을 설정합니다. 이펙트의 수명이 끝나면 이펙트를 비활성화합니다.
 	SetEffectLifespan(EffectLifespan);
@@ -112,6 +120,23 @@ UFXSystemComponent* APREffect::GetFXSystemComponent() const
 	return nullptr;
 }
 
+UFXSystemAsset* APREffect::GetEffectAsset() const
+{
+	const UFXSystemComponent* FXSystemComponent = GetFXSystemComponent();
+	if(IsValid(FXSystemComponent))
+	{
+		return FXSystemComponent->GetFXSystemAsset();
+	}
+
+	return nullptr;
+}
+
+void APREffect::SetEffectPoolOwner(AActor* NewEffectOwner, int32 NewPoolIndex)
+{
+	EffectOwner = NewEffectOwner;
+	PoolIndex = NewPoolIndex;
+}
+
 void APREffect::InitializeEffect(AActor* NewEffectOwner, int32 NewPoolIndex, float NewLifespan)
 {
 	// 이펙트를 비활성화 상태로 설정합니다.
@@ -152,6 +177,17 @@ void APREffect::OnDeactivate()
 	IPRPoolableInterface::Execute_Deactivate(this);
 }
 
+void APREffect::OnFXSystemFinished()
+{
+	// 이미 Pool에 반환되었거나 Reset으로 이전 실행이 끝난 경우는 무시합니다.
+	if(!bActivate || bActivatingEffect)
+	{
+		return;
+	}
+
+	IPRPoolableInterface::Execute_Deactivate(this);
+}
+
 float APREffect::GetEffectLifespan() const
 {
 	return EffectLifespan;
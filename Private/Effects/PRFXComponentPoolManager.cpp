@@ -0,0 +1,296 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Effects/PRFXComponentPoolManager.h"
+#include "Effects/PRNiagaraParameterBlock.h"
+#include "EngineUtils.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+
+APRFXComponentPoolManager::APRFXComponentPoolManager()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	FXComponentPool.Empty();
+	ActiveFXComponents.Empty();
+}
+
+void APRFXComponentPoolManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ClearAllFXComponentPool();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+APRFXComponentPoolManager* APRFXComponentPoolManager::GetFXComponentPoolManager(const UObject* WorldContextObject)
+{
+	UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+	if(!World || !World->IsGameWorld())
+	{
+		return nullptr;
+	}
+
+	for(TActorIterator<APRFXComponentPoolManager> It(World); It; ++It)
+	{
+		if(IsValid(*It) && !It->IsActorBeingDestroyed())
+		{
+			return *It;
+		}
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	return World->SpawnActor<APRFXComponentPoolManager>(APRFXComponentPoolManager::StaticClass(), FTransform::Identity, SpawnParameters);
+}
+
+UFXSystemComponent* APRFXComponentPoolManager::SpawnFXComponentAtLocation(UFXSystemAsset* EffectAsset, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAutoActivate, bool bReset, float Lifespan, int32 MaxPoolSize, const FPRNiagaraParameterBlock* Parameters)
+{
+	UFXSystemComponent* FXComponent = AcquireFXComponent(EffectAsset, MaxPoolSize);
+	if(!FXComponent)
+	{
+		return nullptr;
+	}
+
+	// 부착하지 않은 FXComponent는 Manager의 Transform을 따르지 않도록 월드 기준의 Transform을 사용합니다.
+	FXComponent->SetUsingAbsoluteLocation(true);
+	FXComponent->SetUsingAbsoluteRotation(true);
+	FXComponent->SetUsingAbsoluteScale(true);
+	FXComponent->SetWorldLocationAndRotation(Location, Rotation);
+	FXComponent->SetWorldScale3D(Scale);
+	ActivateFXComponent(FXComponent, EffectAsset, bAutoActivate, bReset, Lifespan, Parameters);
+
+	return FXComponent;
+}
+
+UFXSystemComponent* APRFXComponentPoolManager::SpawnFXComponentAttached(UFXSystemAsset* EffectAsset, USceneComponent* Parent, FName AttachSocketName, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAutoActivate, bool bReset, float Lifespan, int32 MaxPoolSize, const FPRNiagaraParameterBlock* Parameters)
+{
+	if(!IsValid(Parent))
+	{
+		return nullptr;
+	}
+
+	UFXSystemComponent* FXComponent = AcquireFXComponent(EffectAsset, MaxPoolSize);
+	if(!FXComponent)
+	{
+		return nullptr;
+	}
+
+	// PREffect::SpawnEffectAttached와 같이 소켓의 위치에 Location을 더하고 소켓의 회전 값에 Rotation을 합성한 위치에 부착합니다.
+	FXComponent->SetUsingAbsoluteLocation(false);
+	FXComponent->SetUsingAbsoluteRotation(false);
+	FXComponent->SetUsingAbsoluteScale(false);
+	FXComponent->AttachToComponent(Parent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, AttachSocketName);
+	FXComponent->SetWorldLocationAndRotation(Parent->GetSocketLocation(AttachSocketName) + Location, (Parent->GetSocketQuaternion(AttachSocketName) * Rotation.Quaternion()).Rotator());
+	FXComponent->SetWorldScale3D(Scale);
+	ActivateFXComponent(FXComponent, EffectAsset, bAutoActivate, bReset, Lifespan, Parameters);
+
+	return FXComponent;
+}
+
+void APRFXComponentPoolManager::ReleaseFXComponent(UFXSystemComponent* FXComponent)
+{
+	FPRActiveFXComponent* ActiveFXComponent = ActiveFXComponents.Find(FXComponent);
+	if(!ActiveFXComponent)
+	{
+		return;
+	}
+
+	// 즉시 비활성화하면 실행이 끝나는 델리게이트가 다시 호출되므로 사용 중인 목록에서 먼저 제거합니다.
+	const FPRActiveFXComponent ReleasedFXComponent = *ActiveFXComponent;
+	ActiveFXComponents.Remove(FXComponent);
+	GetWorldTimerManager().ClearTimer(ReleasedFXComponent.LifespanTimerHandle);
+
+	if(!IsValid(FXComponent))
+	{
+		// 제거된 FXComponent는 Pool에 반환하지 않으므로 생성한 수에서 뺍니다.
+		if(FPRFXComponentPool* Pool = FXComponentPool.Find(ReleasedFXComponent.EffectAsset))
+		{
+			Pool->ComponentCount = FMath::Max(Pool->ComponentCount - 1, 0);
+		}
+		
+		return;
+	}
+
+	if(UNiagaraComponent* NiagaraComponent = Cast<UNiagaraComponent>(FXComponent))
+	{
+		NiagaraComponent->DeactivateImmediate();
+	}
+	else if(UParticleSystemComponent* ParticleSystemComponent = Cast<UParticleSystemComponent>(FXComponent))
+	{
+		ParticleSystemComponent->DeactivateImmediate();
+	}
+
+	// 부착된 Component에서 분리하여 Manager로 되돌립니다.
+	if(FXComponent->GetAttachParent() != RootComponent)
+	{
+		FXComponent->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	FXComponentPool.FindOrAdd(ReleasedFXComponent.EffectAsset).FreeComponents.Emplace(FXComponent);
+
+	OnFXComponentDeactivateDelegate.Broadcast(FXComponent);
+}
+
+void APRFXComponentPoolManager::PrewarmFXComponents(UFXSystemAsset* EffectAsset, int32 PoolSize)
+{
+	if(!EffectAsset)
+	{
+		return;
+	}
+
+	FPRFXComponentPool& Pool = FXComponentPool.FindOrAdd(EffectAsset);
+	while(Pool.FreeComponents.Num() < PoolSize)
+	{
+		UFXSystemComponent* FXComponent = CreateFXComponent(EffectAsset);
+		if(!FXComponent)
+		{
+			break;
+		}
+
+		Pool.FreeComponents.Emplace(FXComponent);
+		Pool.ComponentCount++;
+	}
+}
+
+bool APRFXComponentPoolManager::IsActiveFXComponent(UFXSystemComponent* FXComponent) const
+{
+	return ActiveFXComponents.Contains(FXComponent);
+}
+
+void APRFXComponentPoolManager::ClearAllFXComponentPool()
+{
+	TArray<TObjectPtr<UFXSystemComponent>> ActiveComponents;
+	ActiveFXComponents.GenerateKeyArray(ActiveComponents);
+	for(UFXSystemComponent* ActiveComponent : ActiveComponents)
+	{
+		ReleaseFXComponent(ActiveComponent);
+	}
+
+	for(auto& Pool : FXComponentPool)
+	{
+		for(UFXSystemComponent* FreeComponent : Pool.Value.FreeComponents)
+		{
+			if(IsValid(FreeComponent))
+			{
+				FreeComponent->DestroyComponent();
+			}
+		}
+	}
+
+	FXComponentPool.Empty();
+	ActiveFXComponents.Empty();
+}
+
+UFXSystemComponent* APRFXComponentPoolManager::AcquireFXComponent(UFXSystemAsset* EffectAsset, int32 MaxPoolSize)
+{
+	if(!EffectAsset)
+	{
+		return nullptr;
+	}
+
+	FPRFXComponentPool& Pool = FXComponentPool.FindOrAdd(EffectAsset);
+	while(!Pool.FreeComponents.IsEmpty())
+	{
+		UFXSystemComponent* FreeComponent = Pool.FreeComponents.Pop(false);
+		if(IsValid(FreeComponent))
+		{
+			return FreeComponent;
+		}
+
+		Pool.ComponentCount = FMath::Max(Pool.ComponentCount - 1, 0);
+	}
+
+	// 이펙트 품질 단계의 최대 수만큼 생성하였으면 더 생성하지 않습니다.
+	if(MaxPoolSize > 0 && Pool.ComponentCount >= MaxPoolSize)
+	{
+		return nullptr;
+	}
+
+	UFXSystemComponent* FXComponent = CreateFXComponent(EffectAsset);
+	if(FXComponent)
+	{
+		Pool.ComponentCount++;
+	}
+
+	return FXComponent;
+}
+
+UFXSystemComponent* APRFXComponentPoolManager::CreateFXComponent(UFXSystemAsset* EffectAsset)
+{
+	UFXSystemComponent* FXComponent = nullptr;
+	if(UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(EffectAsset))
+	{
+		UNiagaraComponent* NiagaraComponent = NewObject<UNiagaraComponent>(this);
+		NiagaraComponent->SetAutoActivate(false);
+		NiagaraComponent->SetAutoDestroy(false);
+		NiagaraComponent->SetAsset(NiagaraSystem);
+		NiagaraComponent->OnSystemFinished.AddUniqueDynamic(this, &APRFXComponentPoolManager::OnNiagaraComponentFinished);
+		FXComponent = NiagaraComponent;
+	}
+	else if(UParticleSystem* ParticleSystem = Cast<UParticleSystem>(EffectAsset))
+	{
+		UParticleSystemComponent* ParticleSystemComponent = NewObject<UParticleSystemComponent>(this);
+		ParticleSystemComponent->SetAutoActivate(false);
+		ParticleSystemComponent->bAutoDestroy = false;
+		ParticleSystemComponent->SetTemplate(ParticleSystem);
+		ParticleSystemComponent->OnSystemFinished.AddUniqueDynamic(this, &APRFXComponentPoolManager::OnParticleSystemComponentFinished);
+		FXComponent = ParticleSystemComponent;
+	}
+
+	if(FXComponent)
+	{
+		FXComponent->SetupAttachment(RootComponent);
+		FXComponent->RegisterComponent();
+	}
+
+	return FXComponent;
+}
+
+void APRFXComponentPoolManager::ActivateFXComponent(UFXSystemComponent* FXComponent, UFXSystemAsset* EffectAsset, bool bAutoActivate, bool bReset, float Lifespan, const FPRNiagaraParameterBlock* Parameters)
+{
+	FPRActiveFXComponent& ActiveFXComponent = ActiveFXComponents.FindOrAdd(FXComponent);
+	ActiveFXComponent.EffectAsset = EffectAsset;
+
+	// 실행하기 전에 사용자 파라미터를 적용합니다.
+	if(Parameters)
+	{
+		Parameters->ApplyToComponent(Cast<UNiagaraComponent>(FXComponent));
+	}
+
+	if(bAutoActivate)
+	{
+		FXComponent->Activate(bReset);
+
+		// PREffect와 같이 수명이 끝나면 비활성화합니다.
+		if(Lifespan > 0.0f)
+		{
+			FTimerDelegate LifespanDelegate = FTimerDelegate::CreateUObject(this, &APRFXComponentPoolManager::OnFXComponentLifespanEnd, FXComponent);
+			GetWorldTimerManager().SetTimer(ActiveFXComponent.LifespanTimerHandle, LifespanDelegate, Lifespan, false);
+		}
+	}
+}
+
+void APRFXComponentPoolManager::OnFXComponentLifespanEnd(UFXSystemComponent* FXComponent)
+{
+	if(IsActiveFXComponent(FXComponent) && IsValid(FXComponent))
+	{
+		// 실행이 끝나면 OnNiagaraComponentFinished 또는 OnParticleSystemComponentFinished에서 Pool에 반환됩니다.
+		FXComponent->Deactivate();
+	}
+}
+
+void APRFXComponentPoolManager::OnNiagaraComponentFinished(UNiagaraComponent* FinishedComponent)
+{
+	ReleaseFXComponent(FinishedComponent);
+}
+
+void APRFXComponentPoolManager::OnParticleSystemComponentFinished(UParticleSystemComponent* FinishedComponent)
+{
+	ReleaseFXComponent(FinishedComponent);
+}
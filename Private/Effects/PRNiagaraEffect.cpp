@@ -11,6 +11,17 @@ APRNiagaraEffect::APRNiagaraEffect()
 	SetRootComponent(NiagaraEffect);
 }
 
+void APRNiagaraEffect::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// 실행이 끝나면 수명이 끝나기 전에 Pool에 반환하도록 바인딩합니다.
+	if(IsValid(NiagaraEffect))
+	{
+		NiagaraEffect->OnSystemFinished.AddUniqueDynamic(this, &APRNiagaraEffect::OnNiagaraSystemFinished);
+	}
+}
+
 void APRNiagaraEffect::InitializeNiagaraEffect(UNiagaraSystem* NiagaraSystem, AActor* NewEffectOwner, int32 NewPoolIndex, float NewLifespan)
 {
 	InitializeEffect(NewEffectOwner, NewPoolIndex, NewLifespan);
@@ -24,6 +35,7 @@ void APRNiagaraEffect::InitializeNiagaraEffect(UNiagaraSystem* NiagaraSystem, AA
 
 void APRNiagaraEffect::ActivateEffect(bool bReset)
 {
+	TGuardValue<bool> ActivatingEffectGuard(bActivatingEffect, true);
 	Super::ActivateEffect();
 
 	if(IsValid(NiagaraEffect))
@@ -42,6 +54,11 @@ void APRNiagaraEffect::DeactivateEffect()
 	}
 }
 
+void APRNiagaraEffect::OnNiagaraSystemFinished(UNiagaraComponent* FinishedComponent)
+{
+	OnFXSystemFinished();
+}
+
 UFXSystemComponent* APRNiagaraEffect::GetFXSystemComponent() const
 {
 	return NiagaraEffect;	
@@ -0,0 +1,172 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Effects/PRNiagaraParameterBlock.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceStaticMesh.h"
+#include "NiagaraUserRedirectionParameterStore.h"
+
+/** 파라미터 타입에 해당하는 Niagara의 타입 정의를 반환하는 함수입니다. */
+static FNiagaraTypeDefinition GetNiagaraTypeDefinition(EPRNiagaraParameterType ParameterType)
+{
+	switch(ParameterType)
+	{
+	case EPRNiagaraParameterType::NiagaraParameterType_Vector:
+		return FNiagaraTypeDefinition::GetVec3Def();
+	case EPRNiagaraParameterType::NiagaraParameterType_LinearColor:
+		return FNiagaraTypeDefinition::GetColorDef();
+	case EPRNiagaraParameterType::NiagaraParameterType_StaticMesh:
+		return FNiagaraTypeDefinition::GetUStaticMeshDef();
+	case EPRNiagaraParameterType::NiagaraParameterType_StaticMeshComponent:
+		return FNiagaraTypeDefinition(UNiagaraDataInterfaceStaticMesh::StaticClass());
+	default:
+		return FNiagaraTypeDefinition::GetFloatDef();
+	}
+}
+
+/** 값이 바뀌었을 경우에만 주어진 Offset의 파라미터 데이터를 쓰는 함수입니다. */
+static void SetParameterDataIfChanged(FNiagaraUserRedirectionParameterStore& OverrideParameters, int32 Offset, const void* Data, int32 Size)
+{
+	const uint8* CurrentData = OverrideParameters.GetParameterData(Offset);
+	if(CurrentData && FMemory::Memcmp(CurrentData, Data, Size) == 0)
+	{
+		return;
+	}
+
+	OverrideParameters.SetParameterData(static_cast<const uint8*>(Data), Offset, Size);
+}
+
+void FPRNiagaraParameterBlock::SetFloatParameter(FName ParameterName, float Value)
+{
+	FindOrAddParameter(ParameterName, EPRNiagaraParameterType::NiagaraParameterType_Float).FloatValue = Value;
+}
+
+void FPRNiagaraParameterBlock::SetVectorParameter(FName ParameterName, const FVector& Value)
+{
+	FindOrAddParameter(ParameterName, EPRNiagaraParameterType::NiagaraParameterType_Vector).VectorValue = Value;
+}
+
+void FPRNiagaraParameterBlock::SetLinearColorParameter(FName ParameterName, const FLinearColor& Value)
+{
+	FindOrAddParameter(ParameterName, EPRNiagaraParameterType::NiagaraParameterType_LinearColor).LinearColorValue = Value;
+}
+
+void FPRNiagaraParameterBlock::SetStaticMeshParameter(FName ParameterName, UStaticMesh* Value)
+{
+	FindOrAddParameter(ParameterName, EPRNiagaraParameterType::NiagaraParameterType_StaticMesh).ObjectValue = Value;
+}
+
+void FPRNiagaraParameterBlock::SetStaticMeshComponentParameter(FName ParameterName, UStaticMeshComponent* Value)
+{
+	FindOrAddParameter(ParameterName, EPRNiagaraParameterType::NiagaraParameterType_StaticMeshComponent).ObjectValue = Value;
+}
+
+void FPRNiagaraParameterBlock::ApplyToComponent(UNiagaraComponent* NiagaraComponent) const
+{
+	if(!IsValid(NiagaraComponent) || !NiagaraComponent->GetAsset() || IsEmpty())
+	{
+		return;
+	}
+
+	FNiagaraUserRedirectionParameterStore& OverrideParameters = NiagaraComponent->GetOverrideParameters();
+	const FPRNiagaraParameterBindings& Bindings = ResolveBindings(NiagaraComponent->GetAsset(), OverrideParameters);
+	for(int32 Index = 0; Index < Parameters.Num(); Index++)
+	{
+		const int32 Offset = Bindings.Offsets[Index];
+		if(Offset == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FPRNiagaraParameter& Parameter = Parameters[Index];
+		switch(Parameter.ParameterType)
+		{
+		case EPRNiagaraParameterType::NiagaraParameterType_Float:
+			SetParameterDataIfChanged(OverrideParameters, Offset, &Parameter.FloatValue, sizeof(float));
+			break;
+		case EPRNiagaraParameterType::NiagaraParameterType_Vector:
+			{
+				// Niagara의 Vector 파라미터는 float 정밀도를 사용합니다.
+				const FVector3f VectorValue(Parameter.VectorValue);
+				SetParameterDataIfChanged(OverrideParameters, Offset, &VectorValue, sizeof(FVector3f));
+			}
+			break;
+		case EPRNiagaraParameterType::NiagaraParameterType_LinearColor:
+			SetParameterDataIfChanged(OverrideParameters, Offset, &Parameter.LinearColorValue, sizeof(FLinearColor));
+			break;
+		case EPRNiagaraParameterType::NiagaraParameterType_StaticMesh:
+			if(OverrideParameters.GetUObject(Offset) != Parameter.ObjectValue)
+			{
+				OverrideParameters.SetUObject(Parameter.ObjectValue, Offset);
+			}
+			break;
+		case EPRNiagaraParameterType::NiagaraParameterType_StaticMeshComponent:
+			{
+				UNiagaraDataInterfaceStaticMesh* StaticMeshInterface = Cast<UNiagaraDataInterfaceStaticMesh>(OverrideParameters.GetDataInterface(Offset));
+				if(StaticMeshInterface)
+				{
+					StaticMeshInterface->SetSourceComponentFromBlueprints(Cast<UStaticMeshComponent>(Parameter.ObjectValue));
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool FPRNiagaraParameterBlock::IsEmpty() const
+{
+	return Parameters.IsEmpty();
+}
+
+FPRNiagaraParameter& FPRNiagaraParameterBlock::FindOrAddParameter(FName ParameterName, EPRNiagaraParameterType ParameterType)
+{
+	for(FPRNiagaraParameter& Parameter : Parameters)
+	{
+		if(Parameter.ParameterName == ParameterName)
+		{
+			// 타입이 바뀌면 Offset도 바뀌므로 저장된 Offset을 제거합니다.
+			if(Parameter.ParameterType != ParameterType)
+			{
+				Parameter.ParameterType = ParameterType;
+				CachedBindings.Empty();
+			}
+
+			return Parameter;
+		}
+	}
+
+	// 새로운 파라미터를 추가하면 저장된 Offset을 제거합니다.
+	CachedBindings.Empty();
+
+	return Parameters.Emplace_GetRef(ParameterName, ParameterType);
+}
+
+const FPRNiagaraParameterBindings& FPRNiagaraParameterBlock::ResolveBindings(const UNiagaraSystem* NiagaraSystem, const FNiagaraUserRedirectionParameterStore& OverrideParameters) const
+{
+	FPRNiagaraParameterBindings& Bindings = CachedBindings.FindOrAdd(NiagaraSystem);
+
+	const int32 LayoutVariableCount = OverrideParameters.ReadParameterVariables().Num();
+	const int32 LayoutDataSize = OverrideParameters.GetParameterDataArray().Num();
+	if(Bindings.Offsets.Num() == Parameters.Num()
+		&& Bindings.LayoutVariableCount == LayoutVariableCount
+		&& Bindings.LayoutDataSize == LayoutDataSize)
+	{
+		return Bindings;
+	}
+
+	// 파라미터의 이름에 User. 접두사를 붙여 OverrideParameters에서 Offset을 찾습니다.
+	Bindings.Offsets.Reset(Parameters.Num());
+	for(const FPRNiagaraParameter& Parameter : Parameters)
+	{
+		FNiagaraVariable UserVariable(GetNiagaraTypeDefinition(Parameter.ParameterType), Parameter.ParameterName);
+		FNiagaraUserRedirectionParameterStore::MakeUserVariable(UserVariable);
+		Bindings.Offsets.Add(OverrideParameters.IndexOf(UserVariable));
+	}
+	Bindings.LayoutVariableCount = LayoutVariableCount;
+	Bindings.LayoutDataSize = LayoutDataSize;
+
+	return Bindings;
+}
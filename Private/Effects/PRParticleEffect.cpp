@@ -11,6 +11,17 @@ APRParticleEffect::APRParticleEffect()
 	SetRootComponent(ParticleEffect);
 }
 
+void APRParticleEffect::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// 실행이 끝나면 수명이 끝나기 전에 Pool에 반환하도록 바인딩합니다.
+	if(IsValid(ParticleEffect))
+	{
+		ParticleEffect->OnSystemFinished.AddUniqueDynamic(this, &APRParticleEffect::OnParticleSystemFinished);
+	}
+}
+
 void APRParticleEffect::InitializeParticleEffect(UParticleSystem* ParticleSystem, AActor* NewEffectOwner, int32 NewPoolIndex, float NewLifespan)
 {
 	InitializeEffect(NewEffectOwner, NewPoolIndex, NewLifespan);
@@ -24,6 +35,7 @@ void APRParticleEffect::InitializeParticleEffect(UParticleSystem* ParticleSystem
 
 void APRParticleEffect::ActivateEffect(bool bReset)
 {
+	TGuardValue<bool> ActivatingEffectGuard(bActivatingEffect, true);
 	Super::ActivateEffect();
 
 	if(IsValid(ParticleEffect))
@@ -42,6 +54,11 @@ void APRParticleEffect::DeactivateEffect()
 	}
 }
 
+void APRParticleEffect::OnParticleSystemFinished(UParticleSystemComponent* FinishedComponent)
+{
+	OnFXSystemFinished();
+}
+
 UFXSystemComponent* APRParticleEffect::GetFXSystemComponent() const
 {
 	return ParticleEffect;
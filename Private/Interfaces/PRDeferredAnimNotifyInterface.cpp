@@ -0,0 +1,10 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
+
+const FPRAnimNotifySignificanceSettings& IPRDeferredAnimNotifyInterface::GetAnimNotifySignificanceSettings() const
+{
+	static const FPRAnimNotifySignificanceSettings AlwaysExecuteSettings(true, 0.0f, 0.0f, 1);
+	return AlwaysExecuteSettings;
+}
@@ -11,6 +11,7 @@ APRPooledObject::APRPooledObject()
 	ObjectLifespan = 0.0f;
 	ObjectOwner = nullptr;
 	PoolIndex = INDEX_NONE;
+	ActivationCount = 0;
 }
 
 void APRPooledObject::BeginPlay()
@@ -27,6 +28,7 @@ bool APRPooledObject::IsActivate_Implementation() const
 void APRPooledObject::Activate_Implementation()
 {
 	bActivate = true;
+	ActivationCount++;
 	SetActorHiddenInGame(!bActivate);
 	SetActorTickEnabled(bActivate);
 
@@ -52,6 +54,11 @@ int32 APRPooledObject::GetPoolIndex_Implementation() const
 	return PoolIndex;
 }
 
+int32 APRPooledObject::GetActivationCount_Implementation() const
+{
+	return ActivationCount;
+}
+
 float APRPooledObject::GetLifespan_Implementation() const
 {
 	return ObjectLifespan;
@@ -89,6 +96,12 @@ void APRPooledObject::InitializeObject_Implementation(AActor* NewObjectOwner, in
 	OnPooledObjectDeactivateDelegate.Clear();
 }
 
+void APRPooledObject::SetObjectPoolOwner(AActor* NewObjectOwner, int32 NewPoolIndex)
+{
+	ObjectOwner = NewObjectOwner;
+	PoolIndex = NewPoolIndex;
+}
+
 void APRPooledObject::ActivateAndSetLocation(const FVector& NewLocation)
 {
 	IPRPoolableInterface::Execute_Activate(this);
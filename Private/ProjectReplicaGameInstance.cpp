@@ -11,6 +11,9 @@ UProjectReplicaGameInstance::UProjectReplicaGameInstance()
 	// ElementColor
 	ElementColorDataTable = nullptr;
 	ElementColors.Empty();
+
+	// AudioPool
+	AudioPoolSettingsDataTable = nullptr;
 }
 
 void UProjectReplicaGameInstance::Init()
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Spawners/PRPoolBaker.h"
+#include "Engine/DataTable.h"
+#include "Subsystems/PRBakedPoolSubsystem.h"
+#include "Components/PRObjectPoolSystemComponent.h"
+#include "Components/PREffectSystemComponent.h"
+#include "Objects/PRPooledObject.h"
+
+APRPoolBaker::APRPoolBaker()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+	ObjectPoolSettingsDataTable = nullptr;
+	NiagaraPoolSettingsDataTable = nullptr;
+	ParticlePoolSettingsDataTable = nullptr;
+	BakedActors.Empty();
+
+	// 게임에서 숨깁니다.
+	AActor::SetActorHiddenInGame(true);
+}
+
+void APRPoolBaker::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// 스트리밍된 서브레벨의 액터를 ObjectPoolSystem이 가져갈 수 있도록 등록합니다.
+	if(GetWorld() && GetWorld()->IsGameWorld())
+	{
+		UPRBakedPoolSubsystem* BakedPoolSubsystem = GetWorld()->GetSubsystem<UPRBakedPoolSubsystem>();
+		if(BakedPoolSubsystem)
+		{
+			BakedPoolSubsystem->RegisterPoolBaker(this);
+		}
+	}
+}
+
+void APRPoolBaker::BakePooledActors()
+{
+#if WITH_EDITOR
+	ClearBakedActors();
+
+	// PooledObject를 생성하고 비활성화 상태로 초기화합니다.
+	if(ObjectPoolSettingsDataTable)
+	{
+		ObjectPoolSettingsDataTable->ForeachRow<FPRObjectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRObjectPoolSettings& Settings)
+		{
+			for(int32 Index = 0; Index < Settings.PoolSize; Index++)
+			{
+				APRPooledObject* BakedObject = Cast<APRPooledObject>(SpawnBakedActor(Settings.PooledObjectClass));
+				if(IsValid(BakedObject))
+				{
+					BakedObject->InitializeObject(nullptr, Index);
+				}
+			}
+		});
+	}
+
+	// NiagaraEffect를 생성하고 비활성화 상태로 초기화합니다.
+	if(NiagaraPoolSettingsDataTable)
+	{
+		NiagaraPoolSettingsDataTable->ForeachRow<FPRNiagaraEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRNiagaraEffectPoolSettings& Settings)
+		{
+			for(int32 Index = 0; Index < Settings.PoolSize && Settings.NiagaraSystem; Index++)
+			{
+				APRNiagaraEffect* BakedEffect = Cast<APRNiagaraEffect>(SpawnBakedActor(APRNiagaraEffect::StaticClass()));
+				if(IsValid(BakedEffect))
+				{
+					BakedEffect->InitializeNiagaraEffect(Settings.NiagaraSystem, nullptr, Index, Settings.EffectLifespan);
+					BakedEffect->GetFXSystemComponent()->SetAutoActivate(false);
+				}
+			}
+		});
+	}
+
+	// ParticleEffect를 생성하고 비활성화 상태로 초기화합니다.
+	if(ParticlePoolSettingsDataTable)
+	{
+		ParticlePoolSettingsDataTable->ForeachRow<FPRParticleEffectPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRParticleEffectPoolSettings& Settings)
+		{
+			for(int32 Index = 0; Index < Settings.PoolSize && Settings.ParticleSystem; Index++)
+			{
+				APRParticleEffect* BakedEffect = Cast<APRParticleEffect>(SpawnBakedActor(APRParticleEffect::StaticClass()));
+				if(IsValid(BakedEffect))
+				{
+					BakedEffect->InitializeParticleEffect(Settings.ParticleSystem, nullptr, Index, Settings.EffectLifespan);
+					BakedEffect->GetFXSystemComponent()->SetAutoActivate(false);
+				}
+			}
+		});
+	}
+
+	MarkPackageDirty();
+	PR_LOG(Log, "Baked %d pooled actors into %s.", BakedActors.Num(), *GetLevel()->GetOuter()->GetName());
+#endif
+}
+
+void APRPoolBaker::ClearBakedActors()
+{
+#if WITH_EDITOR
+	for(AActor* BakedActor : BakedActors)
+	{
+		if(IsValid(BakedActor))
+		{
+			BakedActor->Destroy();
+		}
+	}
+
+	BakedActors.Empty();
+	MarkPackageDirty();
+#endif
+}
+
+AActor* APRPoolBaker::SpawnBakedActor(UClass* ActorClass)
+{
+	if(!GetWorld() || !ActorClass)
+	{
+		return nullptr;
+	}
+
+	// 이 액터와 같은 레벨에 생성하여 레벨과 함께 저장되도록 합니다.
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.OverrideLevel = GetLevel();
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* BakedActor = GetWorld()->SpawnActor<AActor>(ActorClass, GetActorTransform(), SpawnParameters);
+	if(IsValid(BakedActor))
+	{
+		BakedActors.Emplace(BakedActor);
+	}
+
+	return BakedActor;
+}
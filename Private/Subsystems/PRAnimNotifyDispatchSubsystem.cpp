@@ -0,0 +1,293 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRAnimNotifyDispatchSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Algo/StableSort.h"
+
+/** AnimNotify를 큐에 저장하여 애니메이션의 업데이트가 끝난 후 실행하는지 나타내는 변수입니다. */
+static int32 GPRAnimNotifyDeferredDispatch = 1;
+
+/** AnimNotify의 지연 실행을 설정하는 콘솔 변수입니다. */
+static FAutoConsoleVariableRef CVarPRAnimNotifyDeferredDispatch(
+	TEXT("pr.AnimNotify.DeferredDispatch"),
+	GPRAnimNotifyDeferredDispatch,
+	TEXT("Queues PR anim notifies and dispatches them sorted by type after all actors have ticked. 0: run inline, 1: deferred"),
+	ECVF_Default);
+
+UPRAnimNotifyDispatchSubsystem::UPRAnimNotifyDispatchSubsystem()
+{
+	QueuedCommands.Empty();
+	DispatchingCommands.Empty();
+	DispatchStats = FPRAnimNotifyDispatchStats();
+
+	// Significance
+	ReducedRateCounters.Empty();
+	MaxReducedRateCounters = 1024;
+	SignificanceViewLocation = FVector::ZeroVector;
+	SignificanceViewFrame = 0;
+	bHasSignificanceViewLocation = false;
+	SignificanceNearDistance = 1500.0f;
+	SignificanceFarDistance = 6000.0f;
+	NotRenderedSignificanceScale = 0.5f;
+	RecentlyRenderedTime = 0.2f;
+}
+
+void UPRAnimNotifyDispatchSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UPRAnimNotifyDispatchSubsystem::OnWorldPostActorTick);
+}
+
+void UPRAnimNotifyDispatchSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+
+	{
+		FScopeLock Lock(&QueuedCommandsLock);
+		QueuedCommands.Empty();
+	}
+	DispatchingCommands.Empty();
+	ReducedRateCounters.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UPRAnimNotifyDispatchSubsystem::DeferAnimNotify(UObject* NotifyObject, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase, USkeletalMeshComponent* MeshComp,
+													UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference, float TotalDuration)
+{
+	if(!NotifyObject || !MeshComp)
+	{
+		return false;
+	}
+
+	// 에디터의 애니메이션 프리뷰처럼 게임 월드가 아닐 경우 명령을 실행하지 않으므로 바로 실행합니다.
+	UWorld* World = MeshComp->GetWorld();
+	if(!World || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	UPRAnimNotifyDispatchSubsystem* DispatchSubsystem = World->GetSubsystem<UPRAnimNotifyDispatchSubsystem>();
+	if(!DispatchSubsystem)
+	{
+		return false;
+	}
+
+	// 바로 실행하는 경우에도 Significance를 먼저 확인합니다. 지연 실행이 비활성화되었을 경우 노티파이는 게임 스레드에서 실행합니다.
+	if(GPRAnimNotifyDeferredDispatch == 0)
+	{
+		const IPRDeferredAnimNotifyInterface* DeferredAnimNotify = Cast<IPRDeferredAnimNotifyInterface>(NotifyObject);
+		return DeferredAnimNotify && !DispatchSubsystem->PassesSignificanceFilter(DeferredAnimNotify, CommandType, Phase, MeshComp, EventReference);
+	}
+
+	FPRAnimNotifyCommand Command;
+	Command.CommandType = CommandType;
+	Command.Phase = Phase;
+	Command.NotifyObject = NotifyObject;
+	Command.MeshComp = MeshComp;
+	Command.Animation = Animation;
+	Command.EventReference = EventReference;
+	Command.TotalDuration = TotalDuration;
+	DispatchSubsystem->EnqueueCommand(MoveTemp(Command));
+
+	return true;
+}
+
+bool UPRAnimNotifyDispatchSubsystem::PassesAnimNotifySignificance(UObject* NotifyObject, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase, USkeletalMeshComponent* MeshComp,
+																	const FAnimNotifyEventReference& EventReference)
+{
+	const IPRDeferredAnimNotifyInterface* DeferredAnimNotify = Cast<IPRDeferredAnimNotifyInterface>(NotifyObject);
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	if(!DeferredAnimNotify || !World || !World->IsGameWorld())
+	{
+		return true;
+	}
+
+	UPRAnimNotifyDispatchSubsystem* DispatchSubsystem = World->GetSubsystem<UPRAnimNotifyDispatchSubsystem>();
+
+	return !DispatchSubsystem || DispatchSubsystem->PassesSignificanceFilter(DeferredAnimNotify, CommandType, Phase, MeshComp, EventReference);
+}
+
+void UPRAnimNotifyDispatchSubsystem::ResetAnimNotifyDispatchStats()
+{
+	DispatchStats = FPRAnimNotifyDispatchStats();
+}
+
+void UPRAnimNotifyDispatchSubsystem::EnqueueCommand(FPRAnimNotifyCommand&& Command)
+{
+	FScopeLock Lock(&QueuedCommandsLock);
+	QueuedCommands.Emplace(MoveTemp(Command));
+}
+
+void UPRAnimNotifyDispatchSubsystem::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if(World == GetWorld())
+	{
+		DispatchQueuedCommands();
+	}
+}
+
+void UPRAnimNotifyDispatchSubsystem::DispatchQueuedCommands()
+{
+	// 배열을 교환하여 할당 없이 큐를 비우고, 실행 중에 저장되는 명령과 섞이지 않도록 합니다.
+	{
+		FScopeLock Lock(&QueuedCommandsLock);
+		if(QueuedCommands.IsEmpty())
+		{
+			return;
+		}
+
+		Swap(QueuedCommands, DispatchingCommands);
+	}
+
+	// 같은 타입의 명령은 저장한 순서를 유지하도록 안정 정렬합니다.
+	Algo::StableSortBy(DispatchingCommands, [](const FPRAnimNotifyCommand& Command)
+	{
+		return static_cast<uint8>(Command.CommandType);
+	});
+
+	DispatchStats.QueuedCount += DispatchingCommands.Num();
+	DispatchStats.MaxCommandsPerFrame = FMath::Max(DispatchStats.MaxCommandsPerFrame, DispatchingCommands.Num());
+
+	for(const FPRAnimNotifyCommand& Command : DispatchingCommands)
+	{
+		IPRDeferredAnimNotifyInterface* DeferredAnimNotify = Cast<IPRDeferredAnimNotifyInterface>(Command.NotifyObject.Get());
+		if(!DeferredAnimNotify || !Command.MeshComp.IsValid())
+		{
+			DispatchStats.DiscardedCount++;
+			continue;
+		}
+
+		if(!PassesSignificanceFilter(DeferredAnimNotify, Command.CommandType, Command.Phase, Command.MeshComp.Get(), Command.EventReference))
+		{
+			continue;
+		}
+
+		DeferredAnimNotify->ExecuteDeferredAnimNotify(Command);
+		DispatchStats.ExecutedCount++;
+	}
+
+	DispatchingCommands.Reset();
+}
+
+bool UPRAnimNotifyDispatchSubsystem::PassesSignificanceFilter(const IPRDeferredAnimNotifyInterface* DeferredAnimNotify, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase,
+																const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+{
+	const FPRAnimNotifySignificanceSettings& SignificanceSettings = DeferredAnimNotify->GetAnimNotifySignificanceSettings();
+	if(SignificanceSettings.bAlwaysExecute || Phase == EPRAnimNotifyPhase::AnimNotifyPhase_NotifyEnd)
+	{
+		return true;
+	}
+
+	// 기준이 설정되지 않은 노티파이는 Significance를 계산하지 않습니다.
+	const bool bUseReducedRate = SignificanceSettings.ReducedRateInterval > 1 && SignificanceSettings.ReducedRateSignificance > 0.0f;
+	if(SignificanceSettings.MinSignificance <= 0.0f && !bUseReducedRate)
+	{
+		return true;
+	}
+
+	const float Significance = EvaluateCharacterSignificance(MeshComp);
+	if(Significance < SignificanceSettings.MinSignificance)
+	{
+		RecordSkippedCommand(CommandType, false);
+		return false;
+	}
+
+	if(bUseReducedRate && Significance < SignificanceSettings.ReducedRateSignificance)
+	{
+		// 저장소를 늘리기 전에 제거된 SkeletalMeshComponent의 실행 횟수를 정리합니다.
+		const FPRNotifyInstanceKey CounterKey(MeshComp, EventReference.GetNotify());
+		if(ReducedRateCounters.Num() >= MaxReducedRateCounters && !ReducedRateCounters.Contains(CounterKey))
+		{
+			for(auto It = ReducedRateCounters.CreateIterator(); It; ++It)
+			{
+				if(!It.Key().MeshComp.IsValid())
+				{
+					It.RemoveCurrent();
+				}
+			}
+
+			if(ReducedRateCounters.Num() >= MaxReducedRateCounters)
+			{
+				ReducedRateCounters.Reset();
+			}
+		}
+
+		// 첫 번째 실행은 바로 실행하고 이후 ReducedRateInterval번마다 한 번 실행합니다.
+		int32& ExecuteCount = ReducedRateCounters.FindOrAdd(CounterKey);
+		const bool bExecute = ExecuteCount % SignificanceSettings.ReducedRateInterval == 0;
+		ExecuteCount = (ExecuteCount + 1) % SignificanceSettings.ReducedRateInterval;
+		if(!bExecute)
+		{
+			RecordSkippedCommand(CommandType, true);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+float UPRAnimNotifyDispatchSubsystem::EvaluateCharacterSignificance(const USkeletalMeshComponent* MeshComp)
+{
+	if(!MeshComp || !MeshComp->IsVisible())
+	{
+		return 0.0f;
+	}
+
+	// 카메라가 없을 경우 모든 노티파이를 실행합니다.
+	if(!UpdateSignificanceViewLocation())
+	{
+		return 1.0f;
+	}
+
+	const float Distance = FVector::Dist(SignificanceViewLocation, MeshComp->GetComponentLocation());
+	float Significance = 1.0f - FMath::Clamp(FMath::GetRangePct(SignificanceNearDistance, SignificanceFarDistance, Distance), 0.0f, 1.0f);
+
+	// 한 번도 렌더링되지 않은 SkeletalMeshComponent는 아직 렌더링 여부를 알 수 없으므로 렌더링된 것으로 취급합니다.
+	if(MeshComp->GetLastRenderTime() > 0.0f && !MeshComp->WasRecentlyRendered(RecentlyRenderedTime))
+	{
+		Significance *= NotRenderedSignificanceScale;
+	}
+
+	return Significance;
+}
+
+bool UPRAnimNotifyDispatchSubsystem::UpdateSignificanceViewLocation()
+{
+	if(SignificanceViewFrame == GFrameCounter)
+	{
+		return bHasSignificanceViewLocation;
+	}
+
+	SignificanceViewFrame = GFrameCounter;
+	bHasSignificanceViewLocation = false;
+
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if(PlayerController && PlayerController->PlayerCameraManager)
+	{
+		SignificanceViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+		bHasSignificanceViewLocation = true;
+	}
+
+	return bHasSignificanceViewLocation;
+}
+
+void UPRAnimNotifyDispatchSubsystem::RecordSkippedCommand(EPRAnimNotifyCommandType CommandType, bool bReducedRate)
+{
+	if(bReducedRate)
+	{
+		DispatchStats.ReducedRateSkippedCount++;
+	}
+	else
+	{
+		DispatchStats.SignificanceSkippedCount++;
+	}
+
+	DispatchStats.SkippedCountsByType.FindOrAdd(CommandType)++;
+}
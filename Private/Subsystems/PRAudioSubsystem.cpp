@@ -0,0 +1,263 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRAudioSubsystem.h"
+#include "ProjectReplicaGameInstance.h"
+#include "Components/AudioComponent.h"
+#include "Sound/SoundBase.h"
+
+UPRAudioSubsystem::UPRAudioSubsystem()
+{
+	DefaultAudioPoolSettings = FPRAudioPoolSettings(nullptr, 0, 8, 3, 300.0f, 0.0f);
+	AudioPoolSettingsIndex.Empty();
+	AudioPool.Empty();
+	ActiveAudios.Empty();
+	AudioPoolStats = FPRAudioPoolStats();
+}
+
+void UPRAudioSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	InitializeAudioPool();
+}
+
+void UPRAudioSubsystem::Deinitialize()
+{
+	ClearAllAudioPool();
+
+	Super::Deinitialize();
+}
+
+UAudioComponent* UPRAudioSubsystem::PlaySoundAtLocation(USoundBase* Sound, const FVector& Location, const TArray<FAudioParameter>& Parameters, float VolumeMultiplier, float PitchMultiplier)
+{
+	if(!Sound || !GetWorld())
+	{
+		return nullptr;
+	}
+
+	// AudioComponent를 가져오기 전에 거리와 동시 재생 수로 재생하지 않을 사운드를 거부합니다.
+	const FPRAudioPoolSettings AudioPoolSettings = GetAudioPoolSettings(Sound);
+	if(!IsAudible(Sound, Location, AudioPoolSettings))
+	{
+		AudioPoolStats.DistanceRejectedCount++;
+		return nullptr;
+	}
+
+	const FPRAudioPool* SoundPool = AudioPool.Find(Sound);
+	if(SoundPool && AudioPoolSettings.MaxConcurrentCount > 0 && SoundPool->ActiveCount >= AudioPoolSettings.MaxConcurrentCount)
+	{
+		AudioPoolStats.ConcurrencyRejectedCount++;
+		return nullptr;
+	}
+
+	if(AudioPoolSettings.MaxConcurrentInArea > 0 && AudioPoolSettings.AreaRadius > 0.0f
+		&& GetActiveCountInArea(Sound, Location, AudioPoolSettings.AreaRadius) >= AudioPoolSettings.MaxConcurrentInArea)
+	{
+		AudioPoolStats.AreaRejectedCount++;
+		return nullptr;
+	}
+
+	UAudioComponent* AudioComponent = AcquireAudioComponent(Sound);
+	if(!AudioComponent)
+	{
+		return nullptr;
+	}
+
+	// 재생하기 전에 위치와 파라미터를 적용합니다.
+	AudioComponent->SetWorldLocation(Location);
+	AudioComponent->SetVolumeMultiplier(VolumeMultiplier);
+	AudioComponent->SetPitchMultiplier(PitchMultiplier);
+	if(!Parameters.IsEmpty())
+	{
+		TArray<FAudioParameter> AudioParameters = Parameters;
+		AudioComponent->SetParameters(MoveTemp(AudioParameters));
+	}
+
+	ActiveAudios.Emplace(AudioComponent, FPRActiveAudio(Sound, Location));
+	AudioPool.FindOrAdd(Sound).ActiveCount++;
+	AudioPoolStats.PlayedCount++;
+
+	AudioComponent->Play();
+
+	return AudioComponent;
+}
+
+void UPRAudioSubsystem::ResetAudioPoolStats()
+{
+	AudioPoolStats = FPRAudioPoolStats();
+}
+
+void UPRAudioSubsystem::InitializeAudioPool()
+{
+	ClearAllAudioPool();
+
+	const UProjectReplicaGameInstance* PRGameInstance = Cast<UProjectReplicaGameInstance>(GetWorld()->GetGameInstance());
+	const UDataTable* AudioPoolSettingsDataTable = PRGameInstance ? PRGameInstance->GetAudioPoolSettingsDataTable() : nullptr;
+	if(!AudioPoolSettingsDataTable)
+	{
+		return;
+	}
+
+	// 같은 사운드가 여러 행에 있을 경우 처음 행의 설정 값을 사용합니다.
+	AudioPoolSettingsDataTable->ForeachRow<FPRAudioPoolSettings>(PR_LOG_CALLINFO, [this](const FName& RowName, const FPRAudioPoolSettings& AudioPoolSettings)
+	{
+		if(AudioPoolSettings.Sound && !AudioPoolSettingsIndex.Contains(AudioPoolSettings.Sound))
+		{
+			AudioPoolSettingsIndex.Emplace(AudioPoolSettings.Sound, AudioPoolSettings);
+		}
+	});
+
+	// PoolSize만큼 AudioComponent를 미리 생성합니다.
+	for(const auto& AudioPoolSettings : AudioPoolSettingsIndex)
+	{
+		FPRAudioPool& SoundPool = AudioPool.FindOrAdd(AudioPoolSettings.Key);
+		for(int32 Index = 0; Index < AudioPoolSettings.Value.PoolSize; Index++)
+		{
+			UAudioComponent* AudioComponent = CreateAudioComponent(AudioPoolSettings.Key);
+			if(AudioComponent)
+			{
+				SoundPool.FreeComponents.Emplace(AudioComponent);
+			}
+		}
+	}
+}
+
+void UPRAudioSubsystem::ClearAllAudioPool()
+{
+	TArray<TObjectPtr<UAudioComponent>> ActiveComponents;
+	ActiveAudios.GenerateKeyArray(ActiveComponents);
+	ActiveAudios.Empty();
+	for(UAudioComponent* ActiveComponent : ActiveComponents)
+	{
+		if(IsValid(ActiveComponent))
+		{
+			ActiveComponent->DestroyComponent();
+		}
+	}
+
+	for(auto& SoundPool : AudioPool)
+	{
+		for(UAudioComponent* FreeComponent : SoundPool.Value.FreeComponents)
+		{
+			if(IsValid(FreeComponent))
+			{
+				FreeComponent->DestroyComponent();
+			}
+		}
+	}
+
+	AudioPool.Empty();
+	AudioPoolSettingsIndex.Empty();
+}
+
+FPRAudioPoolSettings UPRAudioSubsystem::GetAudioPoolSettings(USoundBase* Sound) const
+{
+	const FPRAudioPoolSettings* AudioPoolSettings = AudioPoolSettingsIndex.Find(Sound);
+	if(AudioPoolSettings)
+	{
+		return *AudioPoolSettings;
+	}
+
+	return DefaultAudioPoolSettings;
+}
+
+bool UPRAudioSubsystem::IsAudible(USoundBase* Sound, const FVector& Location, const FPRAudioPoolSettings& AudioPoolSettings) const
+{
+	const float MaxAudibleDistance = AudioPoolSettings.MaxAudibleDistance > 0.0f ? AudioPoolSettings.MaxAudibleDistance : Sound->GetMaxDistance();
+	bool bHasListener = false;
+
+	// 로컬 플레이어의 리스너 중 하나라도 들을 수 있는 거리 안에 있으면 재생합니다.
+	for(FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if(!PlayerController || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ListenerLocation;
+		FVector ListenerFrontDir;
+		FVector ListenerRightDir;
+		PlayerController->GetAudioListenerPosition(ListenerLocation, ListenerFrontDir, ListenerRightDir);
+		bHasListener = true;
+
+		if(FVector::DistSquared(ListenerLocation, Location) <= FMath::Square(MaxAudibleDistance))
+		{
+			return true;
+		}
+	}
+
+	// 리스너가 없을 경우 거리를 판단할 수 없으므로 재생합니다.
+	return !bHasListener;
+}
+
+int32 UPRAudioSubsystem::GetActiveCountInArea(USoundBase* Sound, const FVector& Location, float AreaRadius) const
+{
+	const float AreaRadiusSquared = FMath::Square(AreaRadius);
+	int32 ActiveCountInArea = 0;
+	for(const auto& ActiveAudio : ActiveAudios)
+	{
+		if(ActiveAudio.Value.Sound == Sound && FVector::DistSquared(ActiveAudio.Value.Location, Location) <= AreaRadiusSquared)
+		{
+			ActiveCountInArea++;
+		}
+	}
+
+	return ActiveCountInArea;
+}
+
+UAudioComponent* UPRAudioSubsystem::AcquireAudioComponent(USoundBase* Sound)
+{
+	FPRAudioPool* SoundPool = AudioPool.Find(Sound);
+	if(SoundPool)
+	{
+		while(!SoundPool->FreeComponents.IsEmpty())
+		{
+			UAudioComponent* FreeComponent = SoundPool->FreeComponents.Pop(false);
+			if(IsValid(FreeComponent))
+			{
+				return FreeComponent;
+			}
+		}
+	}
+
+	return CreateAudioComponent(Sound);
+}
+
+UAudioComponent* UPRAudioSubsystem::CreateAudioComponent(USoundBase* Sound)
+{
+	if(!Sound || !GetWorld())
+	{
+		return nullptr;
+	}
+
+	// UGameplayStatics::SpawnSoundAtLocation과 같이 월드에 AudioComponent를 생성하지만, 재생이 끝나도 제거하지 않습니다.
+	UAudioComponent* AudioComponent = NewObject<UAudioComponent>(GetWorld());
+	AudioComponent->SetAutoActivate(false);
+	AudioComponent->bAutoDestroy = false;
+	AudioComponent->bAllowSpatialization = true;
+	AudioComponent->bIsUISound = false;
+	AudioComponent->SetSound(Sound);
+	AudioComponent->OnAudioFinishedNative.AddUObject(this, &UPRAudioSubsystem::OnAudioComponentFinished);
+	AudioComponent->RegisterComponentWithWorld(GetWorld());
+	AudioPoolStats.CreatedComponentCount++;
+
+	return AudioComponent;
+}
+
+void UPRAudioSubsystem::OnAudioComponentFinished(UAudioComponent* AudioComponent)
+{
+	FPRActiveAudio FinishedAudio;
+	if(!ActiveAudios.RemoveAndCopyValue(AudioComponent, FinishedAudio))
+	{
+		return;
+	}
+
+	FPRAudioPool& SoundPool = AudioPool.FindOrAdd(FinishedAudio.Sound);
+	SoundPool.ActiveCount = FMath::Max(SoundPool.ActiveCount - 1, 0);
+	if(IsValid(AudioComponent))
+	{
+		SoundPool.FreeComponents.Emplace(AudioComponent);
+	}
+}
@@ -0,0 +1,135 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRBakedPoolSubsystem.h"
+#include "EngineUtils.h"
+#include "Spawners/PRPoolBaker.h"
+#include "Objects/PRPooledObject.h"
+#include "Effects/PRNiagaraEffect.h"
+#include "Effects/PRParticleEffect.h"
+
+UPRBakedPoolSubsystem::UPRBakedPoolSubsystem()
+{
+	BakedPoolActors.Empty();
+	RegisteredPoolBakers.Empty();
+	bLoadedPoolBakersRegistered = false;
+}
+
+void UPRBakedPoolSubsystem::Deinitialize()
+{
+	BakedPoolActors.Empty();
+	RegisteredPoolBakers.Empty();
+	OnBakedPoolActorsRegisteredDelegate.Clear();
+
+	Super::Deinitialize();
+}
+
+void UPRBakedPoolSubsystem::RegisterPoolBaker(APRPoolBaker* PoolBaker)
+{
+	if(!IsValid(PoolBaker) || RegisteredPoolBakers.Contains(PoolBaker))
+	{
+		return;
+	}
+
+	RegisteredPoolBakers.Emplace(PoolBaker);
+
+	// 미리 배치된 액터를 Pool의 키별로 분류하여 보관합니다.
+	int32 RegisteredActorCount = 0;
+	for(AActor* BakedActor : PoolBaker->GetBakedActors())
+	{
+		UObject* PoolKey = GetPoolKeyForActor(BakedActor);
+		if(PoolKey)
+		{
+			BakedPoolActors.FindOrAdd(PoolKey).Actors.Emplace(BakedActor);
+			RegisteredActorCount++;
+		}
+	}
+
+	if(RegisteredActorCount > 0)
+	{
+		OnBakedPoolActorsRegisteredDelegate.Broadcast();
+	}
+}
+
+AActor* UPRBakedPoolSubsystem::ClaimBakedActor(UObject* PoolKey)
+{
+	if(!PoolKey)
+	{
+		return nullptr;
+	}
+
+	// ObjectPool이 월드의 액터가 초기화되기 전에 생성되는 경우를 위해 이미 로드된 PoolBaker를 먼저 등록합니다.
+	if(!bLoadedPoolBakersRegistered)
+	{
+		RegisterLoadedPoolBakers();
+	}
+
+	FPRBakedPoolActors* BakedActors = BakedPoolActors.Find(PoolKey);
+	if(!BakedActors)
+	{
+		return nullptr;
+	}
+
+	while(!BakedActors->Actors.IsEmpty())
+	{
+		AActor* BakedActor = BakedActors->Actors.Pop(false);
+		// 레벨과 함께 언로드된 액터는 건너뜁니다.
+		if(IsValid(BakedActor) && !BakedActor->IsActorBeingDestroyed())
+		{
+			return BakedActor;
+		}
+	}
+
+	return nullptr;
+}
+
+bool UPRBakedPoolSubsystem::HasBakedActor(UObject* PoolKey) const
+{
+	const FPRBakedPoolActors* BakedActors = BakedPoolActors.Find(PoolKey);
+	if(BakedActors)
+	{
+		return !BakedActors->Actors.IsEmpty();
+	}
+
+	return false;
+}
+
+UObject* UPRBakedPoolSubsystem::GetPoolKeyForActor(const AActor* PoolActor)
+{
+	if(!IsValid(PoolActor))
+	{
+		return nullptr;
+	}
+
+	if(const APRNiagaraEffect* NiagaraEffect = Cast<APRNiagaraEffect>(PoolActor))
+	{
+		return NiagaraEffect->GetNiagaraEffectAsset();
+	}
+
+	if(const APRParticleEffect* ParticleEffect = Cast<APRParticleEffect>(PoolActor))
+	{
+		return ParticleEffect->GetParticleEffectAsset();
+	}
+
+	if(PoolActor->IsA<APRPooledObject>())
+	{
+		return PoolActor->GetClass();
+	}
+
+	return nullptr;
+}
+
+void UPRBakedPoolSubsystem::RegisterLoadedPoolBakers()
+{
+	bLoadedPoolBakersRegistered = true;
+
+	if(!GetWorld())
+	{
+		return;
+	}
+
+	for(TActorIterator<APRPoolBaker> It(GetWorld()); It; ++It)
+	{
+		RegisterPoolBaker(*It);
+	}
+}
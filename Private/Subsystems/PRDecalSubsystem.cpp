@@ -0,0 +1,286 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRDecalSubsystem.h"
+#include "Components/DecalComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "Materials/MaterialInterface.h"
+
+UPRDecalSubsystem::UPRDecalSubsystem()
+{
+	DecalRingBuffers.Empty();
+	PendingDecalRequests.Empty();
+	DecalStats = FPRDecalStats();
+	ReservedDecalCount = 0;
+	DecalsPerMaterial = 32;
+	MaxLiveDecals = 128;
+	MaxDecalsPerTick = 32;
+	DecalLifespan = 10.0f;
+	FadeOutDuration = 1.0f;
+	FadeScreenSize = 0.01f;
+}
+
+void UPRDecalSubsystem::Deinitialize()
+{
+	for(auto& DecalRingBuffer : DecalRingBuffers)
+	{
+		for(UDecalComponent* Decal : DecalRingBuffer.Value.Decals)
+		{
+			if(IsValid(Decal))
+			{
+				Decal->DestroyComponent();
+			}
+		}
+	}
+
+	DecalRingBuffers.Empty();
+	PendingDecalRequests.Empty();
+	ReservedDecalCount = 0;
+	DecalStats.LiveDecalCount = 0;
+
+	Super::Deinitialize();
+}
+
+void UPRDecalSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	HideFadedOutDecals();
+
+	if(PendingDecalRequests.IsEmpty())
+	{
+		return;
+	}
+
+	// 이번 프레임에 모은 요청을 한 번에 배치합니다. 한 Tick의 최대 수를 초과한 요청은 버립니다.
+	const int32 PlaceCount = FMath::Min(PendingDecalRequests.Num(), MaxDecalsPerTick);
+	for(int32 Index = 0; Index < PlaceCount; Index++)
+	{
+		if(!PlaceDecal(PendingDecalRequests[Index]))
+		{
+			DecalStats.DroppedCount++;
+		}
+	}
+
+	DecalStats.DroppedCount += PendingDecalRequests.Num() - PlaceCount;
+	PendingDecalRequests.Reset();
+}
+
+TStatId UPRDecalSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRDecalSubsystem, STATGROUP_Tickables);
+}
+
+void UPRDecalSubsystem::AddDecal(UMaterialInterface* DecalMaterial, const FVector& Location, const FRotator& Rotation, const FVector& DecalSize)
+{
+	if(!DecalMaterial)
+	{
+		return;
+	}
+
+	PendingDecalRequests.Emplace(DecalMaterial, Location, Rotation, DecalSize);
+}
+
+void UPRDecalSubsystem::AddDecalOnSurface(UMaterialInterface* DecalMaterial, const FVector& Location, const FVector& Normal, const FVector& DecalSize, float Roll)
+{
+	// 데칼은 X축 방향으로 투영되므로 노멀의 반대 방향을 X축으로 사용합니다.
+	FRotator DecalRotation = FRotationMatrix::MakeFromX(-Normal).Rotator();
+	DecalRotation.Roll = Roll;
+
+	AddDecal(DecalMaterial, Location, DecalRotation, DecalSize);
+}
+
+void UPRDecalSubsystem::ResetDecalStats()
+{
+	const int32 LiveDecalCount = DecalStats.LiveDecalCount;
+	DecalStats = FPRDecalStats();
+	DecalStats.LiveDecalCount = LiveDecalCount;
+}
+
+bool UPRDecalSubsystem::PlaceDecal(const FPRDecalRequest& DecalRequest)
+{
+	FPRDecalRingBuffer* DecalRingBuffer = GetOrCreateDecalRingBuffer(DecalRequest.DecalMaterial);
+	if(!DecalRingBuffer || DecalRingBuffer->Capacity <= 0)
+	{
+		return false;
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	const int32 SlotIndex = DecalRingBuffer->NextIndex;
+	UDecalComponent* Decal = DecalRingBuffer->Decals.IsValidIndex(SlotIndex) ? DecalRingBuffer->Decals[SlotIndex].Get() : nullptr;
+	const bool bRecycled = IsValid(Decal);
+	if(!bRecycled)
+	{
+		// UGameplayStatics::SpawnDecalAtLocation과 같이 WorldSettings에 DecalComponent를 생성합니다.
+		Decal = NewObject<UDecalComponent>(GetWorld()->GetWorldSettings());
+		Decal->bAllowAnyoneToDestroyMe = true;
+		Decal->SetDecalMaterial(DecalRequest.DecalMaterial);
+		Decal->SetFadeScreenSize(FadeScreenSize);
+		Decal->RegisterComponentWithWorld(GetWorld());
+
+		Decal->SetVisibility(false);
+
+		if(DecalRingBuffer->Decals.IsValidIndex(SlotIndex))
+		{
+			DecalRingBuffer->Decals[SlotIndex] = Decal;
+		}
+		else
+		{
+			DecalRingBuffer->Decals.Emplace(Decal);
+			DecalRingBuffer->FadeOutStartTimes.Emplace(0.0f);
+		}
+	}
+
+	// 페이드 아웃이 끝나 숨긴 데칼을 다시 배치할 경우만 화면에 보이는 데칼의 수를 늘립니다.
+	if(!Decal->IsVisible())
+	{
+		DecalStats.LiveDecalCount++;
+	}
+
+	// 위치와 크기를 적용하고 페이드 아웃을 다시 시작합니다. SetFadeOut은 렌더 상태를 갱신하므로 페이드가 현재 시간부터 다시 계산됩니다.
+	// SetFadeOut은 페이드가 끝나면 DecalComponent를 파괴하는 수명을 설정하므로 수명을 제거하고 HideFadedOutDecals에서 직접 숨깁니다.
+	Decal->DecalSize = DecalRequest.DecalSize;
+	Decal->SetWorldLocationAndRotation(DecalRequest.Location, DecalRequest.Rotation);
+	Decal->SetVisibility(true);
+	Decal->SetFadeOut(DecalLifespan, FadeOutDuration, false);
+	Decal->SetLifeSpan(0.0f);
+	DecalRingBuffer->FadeOutStartTimes[SlotIndex] = CurrentTime + DecalLifespan;
+	DecalRingBuffer->LastPlacedTime = CurrentTime;
+
+	DecalStats.PlacedCount++;
+	if(bRecycled)
+	{
+		DecalStats.RecycledCount++;
+	}
+
+	DecalRingBuffer->NextIndex = (SlotIndex + 1) % DecalRingBuffer->Capacity;
+
+	// 링 버퍼가 가득 찼으면 다음에 재사용할 가장 오래된 데칼을 미리 페이드 아웃하여 재사용할 때 갑자기 사라지지 않도록 합니다.
+	const int32 NextIndex = DecalRingBuffer->NextIndex;
+	if(NextIndex != SlotIndex && DecalRingBuffer->Decals.IsValidIndex(NextIndex))
+	{
+		UDecalComponent* NextDecal = DecalRingBuffer->Decals[NextIndex];
+		if(IsValid(NextDecal) && DecalRingBuffer->FadeOutStartTimes[NextIndex] > CurrentTime)
+		{
+			NextDecal->SetFadeOut(0.0f, FadeOutDuration, false);
+			NextDecal->SetLifeSpan(0.0f);
+			DecalRingBuffer->FadeOutStartTimes[NextIndex] = CurrentTime;
+		}
+	}
+
+	return true;
+}
+
+FPRDecalRingBuffer* UPRDecalSubsystem::GetOrCreateDecalRingBuffer(UMaterialInterface* DecalMaterial)
+{
+	FPRDecalRingBuffer* DecalRingBuffer = DecalRingBuffers.Find(DecalMaterial);
+	if(DecalRingBuffer)
+	{
+		return DecalRingBuffer;
+	}
+
+	if(!DecalMaterial)
+	{
+		return nullptr;
+	}
+
+	// 남은 데칼 수가 없으면 가장 오래 사용하지 않은 머티리얼의 링 버퍼를 제거하고 DecalComponent를 재사용합니다.
+	TArray<TObjectPtr<UDecalComponent>> EvictedDecals;
+	if(MaxLiveDecals - ReservedDecalCount <= 0 && !EvictLeastRecentlyUsedDecalRingBuffer(EvictedDecals))
+	{
+		return nullptr;
+	}
+
+	// 모든 링 버퍼의 크기의 합이 MaxLiveDecals를 넘지 않도록 남은 수 안에서 크기를 정합니다.
+	const int32 Capacity = FMath::Min(DecalsPerMaterial, MaxLiveDecals - ReservedDecalCount);
+	if(Capacity <= 0)
+	{
+		return nullptr;
+	}
+
+	FPRDecalRingBuffer& NewDecalRingBuffer = DecalRingBuffers.Add(DecalMaterial);
+	NewDecalRingBuffer.Capacity = Capacity;
+	NewDecalRingBuffer.Decals.Reserve(Capacity);
+	NewDecalRingBuffer.FadeOutStartTimes.Reserve(Capacity);
+	ReservedDecalCount += Capacity;
+
+	// 넘겨받은 DecalComponent는 숨겨진 상태로 새 링 버퍼에 들어가며, 새 링 버퍼에 들어가지 못한 DecalComponent는 파괴합니다.
+	for(UDecalComponent* EvictedDecal : EvictedDecals)
+	{
+		if(!IsValid(EvictedDecal))
+		{
+			continue;
+		}
+
+		if(NewDecalRingBuffer.Decals.Num() >= Capacity)
+		{
+			EvictedDecal->DestroyComponent();
+			continue;
+		}
+
+		EvictedDecal->SetDecalMaterial(DecalMaterial);
+		NewDecalRingBuffer.Decals.Emplace(EvictedDecal);
+		NewDecalRingBuffer.FadeOutStartTimes.Emplace(0.0f);
+	}
+
+	return &NewDecalRingBuffer;
+}
+
+bool UPRDecalSubsystem::EvictLeastRecentlyUsedDecalRingBuffer(TArray<TObjectPtr<UDecalComponent>>& OutDecals)
+{
+	// 이번 프레임에 배치한 데칼이 바로 사라지지 않도록 이번 프레임에 사용한 링 버퍼는 제거하지 않습니다.
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	UMaterialInterface* EvictMaterial = nullptr;
+	float OldestPlacedTime = CurrentTime;
+	for(const auto& DecalRingBuffer : DecalRingBuffers)
+	{
+		if(DecalRingBuffer.Value.LastPlacedTime < OldestPlacedTime)
+		{
+			EvictMaterial = DecalRingBuffer.Key;
+			OldestPlacedTime = DecalRingBuffer.Value.LastPlacedTime;
+		}
+	}
+
+	FPRDecalRingBuffer EvictedDecalRingBuffer;
+	if(!EvictMaterial || !DecalRingBuffers.RemoveAndCopyValue(EvictMaterial, EvictedDecalRingBuffer))
+	{
+		PR_LOG(Warning, "All %d decal ring buffers were used this frame. The decal request is dropped.", DecalRingBuffers.Num());
+		return false;
+	}
+
+	PR_LOG(Log, "Evicted the decal ring buffer of %s to make room for a new decal material.", *GetNameSafe(EvictMaterial));
+
+	for(UDecalComponent* Decal : EvictedDecalRingBuffer.Decals)
+	{
+		if(IsValid(Decal) && Decal->IsVisible())
+		{
+			Decal->SetVisibility(false);
+			DecalStats.LiveDecalCount--;
+		}
+	}
+
+	ReservedDecalCount -= EvictedDecalRingBuffer.Capacity;
+	DecalStats.EvictedRingBufferCount++;
+	OutDecals = MoveTemp(EvictedDecalRingBuffer.Decals);
+
+	return true;
+}
+
+void UPRDecalSubsystem::HideFadedOutDecals()
+{
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	for(auto& DecalRingBuffer : DecalRingBuffers)
+	{
+		FPRDecalRingBuffer& RingBuffer = DecalRingBuffer.Value;
+		for(int32 Index = 0; Index < RingBuffer.Decals.Num(); Index++)
+		{
+			// 페이드 아웃이 끝난 데칼은 파괴하지 않고 숨겨서 다음 배치에 재사용합니다.
+			UDecalComponent* Decal = RingBuffer.Decals[Index];
+			if(IsValid(Decal) && Decal->IsVisible() && RingBuffer.FadeOutStartTimes[Index] + FadeOutDuration <= CurrentTime)
+			{
+				Decal->SetVisibility(false);
+				DecalStats.LiveDecalCount--;
+			}
+		}
+	}
+}
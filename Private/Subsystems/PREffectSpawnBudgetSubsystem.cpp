@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PREffectSpawnBudgetSubsystem.h"
+#include "Particles/ParticleSystemComponent.h"
+
+UPREffectSpawnBudgetSubsystem::UPREffectSpawnBudgetSubsystem()
+{
+	RecentEffectSpawns.Empty();
+	FrameEffectSpawnCounts.Empty();
+	FrameTotalEffectSpawnCount = 0;
+	EffectSpawnSerials.Empty();
+	NextEffectSpawnSerial = 1;
+	SpawnSerialCleanupInterval = 5.0f;
+	SpawnSerialCleanupElapsedTime = 0.0f;
+}
+
+void UPREffectSpawnBudgetSubsystem::Deinitialize()
+{
+	RecentEffectSpawns.Empty();
+	FrameEffectSpawnCounts.Empty();
+	FrameTotalEffectSpawnCount = 0;
+	EffectSpawnSerials.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPREffectSpawnBudgetSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 액터의 Tick과 타이머가 끝난 후 프레임당 Spawn 수를 한 번 초기화합니다.
+	FrameEffectSpawnCounts.Reset();
+	FrameTotalEffectSpawnCount = 0;
+
+	// 병합할 수 없게 된 대상을 제거합니다.
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	for(int32 Index = RecentEffectSpawns.Num() - 1; Index >= 0; Index--)
+	{
+		if(!IsRecentEffectSpawnValid(RecentEffectSpawns[Index], CurrentTime))
+		{
+			RecentEffectSpawns.RemoveAtSwap(Index);
+		}
+	}
+
+	// 제거된 Component의 Spawn 번호를 주기적으로 정리합니다.
+	SpawnSerialCleanupElapsedTime += DeltaTime;
+	if(SpawnSerialCleanupElapsedTime >= SpawnSerialCleanupInterval)
+	{
+		SpawnSerialCleanupElapsedTime = 0.0f;
+		for(auto It = EffectSpawnSerials.CreateIterator(); It; ++It)
+		{
+			if(!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+TStatId UPREffectSpawnBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPREffectSpawnBudgetSubsystem, STATGROUP_Tickables);
+}
+
+bool UPREffectSpawnBudgetSubsystem::HasEffectSpawnBudget(UFXSystemAsset* SpawnEffect, int32 GlobalMaxSpawnsPerFrame, int32 SystemMaxSpawnsPerFrame) const
+{
+	if(FrameTotalEffectSpawnCount >= GlobalMaxSpawnsPerFrame)
+	{
+		return false;
+	}
+
+	const int32* SystemSpawnCount = FrameEffectSpawnCounts.Find(SpawnEffect);
+
+	return !SystemSpawnCount || *SystemSpawnCount < SystemMaxSpawnsPerFrame;
+}
+
+UFXSystemComponent* UPREffectSpawnBudgetSubsystem::CoalesceEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, float CoalesceRadius, float& OutIntensity)
+{
+	OutIntensity = 1.0f;
+	if(!SpawnEffect || CoalesceRadius <= 0.0f)
+	{
+		return nullptr;
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+	const float CoalesceRadiusSquared = FMath::Square(CoalesceRadius);
+	for(int32 Index = RecentEffectSpawns.Num() - 1; Index >= 0; Index--)
+	{
+		FPRRecentEffectSpawn& RecentEffectSpawn = RecentEffectSpawns[Index];
+		if(!IsRecentEffectSpawnValid(RecentEffectSpawn, CurrentTime))
+		{
+			RecentEffectSpawns.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if(RecentEffectSpawn.EffectAsset == SpawnEffect && FVector::DistSquared(RecentEffectSpawn.Location, Location) <= CoalesceRadiusSquared)
+		{
+			RecentEffectSpawn.Intensity += 1.0f;
+			OutIntensity = RecentEffectSpawn.Intensity;
+
+			return RecentEffectSpawn.EffectComponent.Get();
+		}
+	}
+
+	return nullptr;
+}
+
+void UPREffectSpawnBudgetSubsystem::RecordEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, UFXSystemComponent* EffectComponent, float Intensity, float CoalesceTimeWindow)
+{
+	if(!SpawnEffect)
+	{
+		return;
+	}
+
+	FrameEffectSpawnCounts.FindOrAdd(SpawnEffect)++;
+	FrameTotalEffectSpawnCount++;
+
+	if(!IsValid(EffectComponent))
+	{
+		return;
+	}
+
+	// 재사용된 Component가 이전 요청의 병합 대상으로 사용되지 않도록 Spawn할 때마다 새 번호를 발급합니다.
+	const int32 SpawnSerial = NextEffectSpawnSerial++;
+	EffectSpawnSerials.Emplace(EffectComponent, SpawnSerial);
+
+	if(CoalesceTimeWindow > 0.0f)
+	{
+		FPRRecentEffectSpawn RecentEffectSpawn;
+		RecentEffectSpawn.EffectAsset = SpawnEffect;
+		RecentEffectSpawn.Location = Location;
+		RecentEffectSpawn.ExpireTime = GetWorld()->GetTimeSeconds() + CoalesceTimeWindow;
+		RecentEffectSpawn.EffectComponent = EffectComponent;
+		RecentEffectSpawn.SpawnSerial = SpawnSerial;
+		RecentEffectSpawn.Intensity = Intensity;
+		RecentEffectSpawns.Emplace(RecentEffectSpawn);
+	}
+}
+
+bool UPREffectSpawnBudgetSubsystem::IsRecentEffectSpawnValid(const FPRRecentEffectSpawn& RecentEffectSpawn, float CurrentTime) const
+{
+	if(CurrentTime > RecentEffectSpawn.ExpireTime)
+	{
+		return false;
+	}
+
+	const UFXSystemComponent* EffectComponent = RecentEffectSpawn.EffectComponent.Get();
+	if(!IsValid(EffectComponent) || !EffectComponent->IsActive())
+	{
+		return false;
+	}
+
+	const int32* SpawnSerial = EffectSpawnSerials.Find(RecentEffectSpawn.EffectComponent);
+
+	return SpawnSerial && *SpawnSerial == RecentEffectSpawn.SpawnSerial;
+}
@@ -0,0 +1,226 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRFootstepSubsystem.h"
+#include "Subsystems/PRAudioSubsystem.h"
+#include "Subsystems/PRDecalSubsystem.h"
+#include "Subsystems/PRSurfaceCacheSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Sound/SoundBase.h"
+
+UPRFootstepSubsystem::UPRFootstepSubsystem()
+{
+	QueuedFootstepRequests.Empty();
+	PendingFootstepRequests.Empty();
+	CompletedFootstepTraces.Empty();
+	FootstepStats = FPRFootstepStats();
+	MaxTracesPerTick = 32;
+	RecentlyRenderedTolerance = 0.2f;
+}
+
+void UPRFootstepSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FootstepTraceDelegate.BindUObject(this, &UPRFootstepSubsystem::OnFootstepTraceCompleted);
+}
+
+void UPRFootstepSubsystem::Deinitialize()
+{
+	FootstepTraceDelegate.Unbind();
+	QueuedFootstepRequests.Empty();
+	PendingFootstepRequests.Empty();
+	CompletedFootstepTraces.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPRFootstepSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 월드의 Tick이 시작될 때 완료된 이전 프레임의 Trace를 먼저 처리하고, 이번 프레임의 요청을 Trace합니다.
+	ProcessCompletedFootsteps();
+	StartFootstepTraces();
+}
+
+TStatId UPRFootstepSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRFootstepSubsystem, STATGROUP_Tickables);
+}
+
+void UPRFootstepSubsystem::RequestFootstep(const FPRFootstepRequest& FootstepRequest, bool bSkipTraceWhenNotRendered)
+{
+	const USkeletalMeshComponent* MeshComp = FootstepRequest.MeshComp.Get();
+	if(!IsValid(MeshComp))
+	{
+		return;
+	}
+
+	FootstepStats.RequestedCount++;
+
+	// 같은 위치의 표면이 캐시에 있을 경우 Trace 없이 저장한 바닥에서 실행합니다.
+	if(FootstepRequest.bUseSurfaceCache)
+	{
+		UPRSurfaceCacheSubsystem* SurfaceCacheSubsystem = GetWorld()->GetSubsystem<UPRSurfaceCacheSubsystem>();
+		FPRSurfaceCacheEntry SurfaceEntry;
+		if(SurfaceCacheSubsystem && SurfaceCacheSubsystem->FindSurface(FootstepRequest.TraceStart, SurfaceEntry))
+		{
+			FHitResult CachedHitResult;
+			CachedHitResult.bBlockingHit = true;
+			CachedHitResult.Location = FVector(FootstepRequest.TraceStart.X, FootstepRequest.TraceStart.Y, SurfaceEntry.GroundHeight);
+			CachedHitResult.ImpactPoint = CachedHitResult.Location;
+			CachedHitResult.ImpactNormal = SurfaceEntry.ImpactNormal;
+
+			FootstepStats.CachedCount++;
+			ExecuteFootstep(FootstepRequest, true, CachedHitResult, SurfaceEntry.SurfaceType);
+			return;
+		}
+	}
+
+	// 렌더링되지 않은 캐릭터는 발자국이 보이지 않으므로 Trace 없이 기본 표면의 발소리만 재생합니다.
+	// 바닥의 확인은 CharacterMovement로 대신하며, CharacterMovement가 없을 경우 Trace로 바닥을 확인합니다.
+	const ACharacter* OwnerCharacter = Cast<ACharacter>(MeshComp->GetOwner());
+	const UCharacterMovementComponent* CharacterMovement = OwnerCharacter ? OwnerCharacter->GetCharacterMovement() : nullptr;
+	if(bSkipTraceWhenNotRendered && CharacterMovement && !MeshComp->WasRecentlyRendered(RecentlyRenderedTolerance))
+	{
+		FootstepStats.SkippedTraceCount++;
+
+		// 공중이나 수영 중인 캐릭터는 밟은 바닥이 없으므로 발소리를 재생하지 않습니다.
+		if(CharacterMovement->IsMovingOnGround())
+		{
+			ExecuteFootstep(FootstepRequest, false, FHitResult(), SurfaceType_Default);
+		}
+
+		return;
+	}
+
+	QueuedFootstepRequests.Emplace(FootstepRequest);
+}
+
+void UPRFootstepSubsystem::ResetFootstepStats()
+{
+	FootstepStats = FPRFootstepStats();
+}
+
+void UPRFootstepSubsystem::StartFootstepTraces()
+{
+	if(QueuedFootstepRequests.IsEmpty())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const int32 TraceCount = FMath::Min(QueuedFootstepRequests.Num(), MaxTracesPerTick);
+	for(int32 Index = 0; Index < TraceCount; Index++)
+	{
+		const FPRFootstepRequest& FootstepRequest = QueuedFootstepRequests[Index];
+
+		// 캐릭터 자신은 QueryParams의 무시 목록으로 제외하여 Trace마다 배열을 할당하지 않습니다.
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PRFootstepTrace), true, FootstepRequest.MeshComp.IsValid() ? FootstepRequest.MeshComp->GetOwner() : nullptr);
+		QueryParams.bReturnPhysicalMaterial = true;
+
+		const int32 RequestIndex = PendingFootstepRequests.Add(FootstepRequest);
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, FootstepRequest.TraceStart, FootstepRequest.TraceEnd, ECC_Visibility, QueryParams,
+										FCollisionResponseParams::DefaultResponseParam, &FootstepTraceDelegate, static_cast<uint32>(RequestIndex));
+	}
+
+	FootstepStats.TracedCount += TraceCount;
+	FootstepStats.DroppedCount += QueuedFootstepRequests.Num() - TraceCount;
+	QueuedFootstepRequests.Reset();
+}
+
+void UPRFootstepSubsystem::ProcessCompletedFootsteps()
+{
+	for(const FPRFootstepTraceResult& TraceResult : CompletedFootstepTraces)
+	{
+		if(!PendingFootstepRequests.IsValidIndex(TraceResult.RequestIndex))
+		{
+			continue;
+		}
+
+		const FPRFootstepRequest& FootstepRequest = PendingFootstepRequests[TraceResult.RequestIndex];
+		PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Footsteps, FootstepRequest.bDebug,
+						DrawDebugLine(GetWorld(), FootstepRequest.TraceStart, TraceResult.bIsHit ? TraceResult.HitResult.ImpactPoint : FootstepRequest.TraceEnd, TraceResult.bIsHit ? FColor::Green : FColor::Red, false, 2.0f));
+
+		// 바닥에 닿지 않은 발걸음은 실행하지 않습니다.
+		if(TraceResult.bIsHit)
+		{
+			const EPhysicalSurface SurfaceType = UPhysicalMaterial::DetermineSurfaceType(TraceResult.HitResult.PhysMaterial.Get());
+			if(FootstepRequest.bUseSurfaceCache)
+			{
+				if(UPRSurfaceCacheSubsystem* SurfaceCacheSubsystem = GetWorld()->GetSubsystem<UPRSurfaceCacheSubsystem>())
+				{
+					SurfaceCacheSubsystem->AddSurface(FootstepRequest.TraceStart, TraceResult.HitResult, SurfaceType);
+				}
+			}
+
+			ExecuteFootstep(FootstepRequest, true, TraceResult.HitResult, SurfaceType);
+		}
+
+		PendingFootstepRequests.RemoveAt(TraceResult.RequestIndex);
+		FootstepStats.CompletedCount++;
+	}
+
+	CompletedFootstepTraces.Reset();
+}
+
+void UPRFootstepSubsystem::OnFootstepTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	const bool bIsHit = !TraceDatum.OutHits.IsEmpty() && TraceDatum.OutHits[0].bBlockingHit;
+	CompletedFootstepTraces.Emplace(static_cast<int32>(TraceDatum.UserData), bIsHit, bIsHit ? TraceDatum.OutHits[0] : FHitResult());
+}
+
+void UPRFootstepSubsystem::ExecuteFootstep(const FPRFootstepRequest& FootstepRequest, bool bIsHit, const FHitResult& HitResult, EPhysicalSurface SurfaceType) const
+{
+	USkeletalMeshComponent* MeshComp = FootstepRequest.MeshComp.Get();
+	if(!IsValid(MeshComp) || !IsValid(MeshComp->GetOwner()))
+	{
+		return;
+	}
+
+	// 발소리를 재생합니다. Trace를 생략했을 경우 기본 표면으로 탐색 시작 위치에서 재생합니다.
+	USoundBase* Sound = FootstepRequest.Sound.Get();
+	if(Sound)
+	{
+		const FVector SoundLocation = bIsHit ? HitResult.Location : FootstepRequest.TraceStart;
+
+		TArray<FAudioParameter> FootstepsParameters;
+		if(FootstepRequest.Gender != INDEX_NONE)
+		{
+			FootstepsParameters.Emplace(TEXT("Gender"), FootstepRequest.Gender);
+		}
+		FootstepsParameters.Emplace(TEXT("SurfaceType"), static_cast<int32>(SurfaceType));
+
+		// AudioSubsystem이 있을 경우 Pool의 AudioComponent로 재생합니다.
+		UPRAudioSubsystem* AudioSubsystem = GetWorld()->GetSubsystem<UPRAudioSubsystem>();
+		if(AudioSubsystem)
+		{
+			AudioSubsystem->PlaySoundAtLocation(Sound, SoundLocation, FootstepsParameters);
+		}
+		else
+		{
+			UAudioComponent* FootstepsAudioComp = UGameplayStatics::SpawnSoundAtLocation(GetWorld(), Sound, SoundLocation);
+			if(IsValid(FootstepsAudioComp))
+			{
+				FootstepsAudioComp->SetParameters(MoveTemp(FootstepsParameters));
+				FootstepsAudioComp->Play();
+			}
+		}
+	}
+
+	// 바닥에 닿았을 경우 발자국 데칼을 배치합니다.
+	UMaterialInterface* FootprintDecalMaterial = FootstepRequest.FootprintDecalMaterial.Get();
+	UPRDecalSubsystem* DecalSubsystem = GetWorld()->GetSubsystem<UPRDecalSubsystem>();
+	if(bIsHit && FootprintDecalMaterial && DecalSubsystem)
+	{
+		// 바닥으로 투영하고, 발자국의 앞쪽이 캐릭터가 바라보는 방향을 향하도록 회전합니다.
+		const FRotator DecalRotation = FRotationMatrix::MakeFromXZ(-HitResult.ImpactNormal, MeshComp->GetOwner()->GetActorForwardVector()).Rotator() + FootstepRequest.FootprintDecalRotationOffset;
+		DecalSubsystem->AddDecal(FootprintDecalMaterial, HitResult.ImpactPoint, DecalRotation, FootstepRequest.FootprintDecalSize);
+	}
+}
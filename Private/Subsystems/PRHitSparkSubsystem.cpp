@@ -0,0 +1,110 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRHitSparkSubsystem.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+
+UPRHitSparkSubsystem::UPRHitSparkSubsystem()
+{
+	HitSparkBatches.Empty();
+	MaxHitSparksPerFrame = 1024;
+	HitPositionsParameterName = TEXT("HitPositions");
+	HitNormalsParameterName = TEXT("HitNormals");
+	HitColorsParameterName = TEXT("HitColors");
+}
+
+void UPRHitSparkSubsystem::Deinitialize()
+{
+	for(auto& HitSparkBatch : HitSparkBatches)
+	{
+		if(IsValid(HitSparkBatch.Value.NiagaraComponent))
+		{
+			HitSparkBatch.Value.NiagaraComponent->DestroyComponent();
+		}
+	}
+
+	HitSparkBatches.Empty();
+
+	Super::Deinitialize();
+}
+
+void UPRHitSparkSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// 액터의 Tick이 끝난 후 이번 프레임에 모은 히트 정보를 한 번에 전달합니다.
+	for(auto& HitSparkBatch : HitSparkBatches)
+	{
+		FPRHitSparkBatch& Batch = HitSparkBatch.Value;
+		const bool bHasHits = !Batch.HitPositions.IsEmpty();
+
+		// 히트가 없는 프레임에는 이전 프레임에 전달한 배열을 한 번만 비웁니다.
+		if(!bHasHits && !Batch.bHasSubmittedHits)
+		{
+			continue;
+		}
+
+		UNiagaraComponent* NiagaraComponent = GetOrCreateHitSparkComponent(HitSparkBatch.Key, Batch);
+		if(NiagaraComponent)
+		{
+			SubmitHitSparkBatch(NiagaraComponent, Batch);
+		}
+
+		Batch.bHasSubmittedHits = bHasHits;
+		Batch.HitPositions.Reset();
+		Batch.HitNormals.Reset();
+		Batch.HitColors.Reset();
+	}
+}
+
+TStatId UPRHitSparkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPRHitSparkSubsystem, STATGROUP_Tickables);
+}
+
+void UPRHitSparkSubsystem::AddHitSpark(UNiagaraSystem* HitSparkSystem, const FVector& Location, const FVector& Normal, const FLinearColor& Color)
+{
+	if(!HitSparkSystem)
+	{
+		return;
+	}
+
+	FPRHitSparkBatch& HitSparkBatch = HitSparkBatches.FindOrAdd(HitSparkSystem);
+	if(HitSparkBatch.HitPositions.Num() >= MaxHitSparksPerFrame)
+	{
+		return;
+	}
+
+	HitSparkBatch.HitPositions.Emplace(Location);
+	HitSparkBatch.HitNormals.Emplace(Normal);
+	HitSparkBatch.HitColors.Emplace(Color);
+}
+
+UNiagaraComponent* UPRHitSparkSubsystem::GetOrCreateHitSparkComponent(UNiagaraSystem* HitSparkSystem, FPRHitSparkBatch& HitSparkBatch)
+{
+	if(IsValid(HitSparkBatch.NiagaraComponent))
+	{
+		return HitSparkBatch.NiagaraComponent;
+	}
+
+	if(!HitSparkSystem || !GetWorld())
+	{
+		return nullptr;
+	}
+
+	// 파티클은 월드 좌표로 Spawn하므로 원점에 자동으로 제거되지 않는 NiagaraComponent를 하나 생성합니다.
+	HitSparkBatch.NiagaraComponent = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), HitSparkSystem, FVector::ZeroVector, FRotator::ZeroRotator,
+																					FVector(1.0f), false, true, ENCPoolMethod::None);
+
+	return HitSparkBatch.NiagaraComponent;
+}
+
+void UPRHitSparkSubsystem::SubmitHitSparkBatch(UNiagaraComponent* NiagaraComponent, const FPRHitSparkBatch& HitSparkBatch) const
+{
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(NiagaraComponent, HitPositionsParameterName, HitSparkBatch.HitPositions);
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(NiagaraComponent, HitNormalsParameterName, HitSparkBatch.HitNormals);
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayColor(NiagaraComponent, HitColorsParameterName, HitSparkBatch.HitColors);
+}
@@ -0,0 +1,320 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Subsystems/PRSurfaceCacheSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+
+DECLARE_STATS_GROUP(TEXT("PRSurfaceCache"), STATGROUP_PRSurfaceCache, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cache Hits"), STAT_PRSurfaceCacheHits, STATGROUP_PRSurfaceCache);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cache Misses"), STAT_PRSurfaceCacheMisses, STATGROUP_PRSurfaceCache);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Invalidated Cells"), STAT_PRSurfaceCacheInvalidated, STATGROUP_PRSurfaceCache);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cached Cells"), STAT_PRSurfaceCacheCells, STATGROUP_PRSurfaceCache);
+
+UPRSurfaceCacheSubsystem::UPRSurfaceCacheSubsystem()
+{
+	SurfaceCells.Empty();
+	TrackedMovableSurfaceComponents.Empty();
+	MovingCollisionComponents.Empty();
+	SurfaceCacheStats = FPRSurfaceCacheStats();
+	CellSize = 50.0f;
+	HeightBandSize = 50.0f;
+	EntryLifespan = 30.0f;
+	MaxCachedCells = 8192;
+}
+
+void UPRSurfaceCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UPRSurfaceCacheSubsystem::OnLevelStreamingChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UPRSurfaceCacheSubsystem::OnLevelStreamingChanged);
+}
+
+void UPRSurfaceCacheSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	ClearSurfaceCache();
+	UnregisterAllMovingCollisionComponents();
+
+	Super::Deinitialize();
+}
+
+bool UPRSurfaceCacheSubsystem::FindSurface(const FVector& TraceStart, FPRSurfaceCacheEntry& OutEntry)
+{
+	const FIntVector CellKey = GetSurfaceCellKey(TraceStart);
+	const FPRSurfaceCacheEntry* Entry = SurfaceCells.Find(CellKey);
+	if(Entry && !IsValidSurfaceEntry(*Entry))
+	{
+		// 바닥이 움직였거나 제거된 칸은 다시 탐색하도록 제거합니다.
+		SurfaceCells.Remove(CellKey);
+		Entry = nullptr;
+		SurfaceCacheStats.InvalidatedCount++;
+		INC_DWORD_STAT(STAT_PRSurfaceCacheInvalidated);
+		UpdateCachedCellCount();
+	}
+
+	if(!Entry)
+	{
+		SurfaceCacheStats.MissCount++;
+		INC_DWORD_STAT(STAT_PRSurfaceCacheMisses);
+		return false;
+	}
+
+	OutEntry = *Entry;
+	SurfaceCacheStats.HitCount++;
+	INC_DWORD_STAT(STAT_PRSurfaceCacheHits);
+	return true;
+}
+
+void UPRSurfaceCacheSubsystem::AddSurface(const FVector& TraceStart, const FHitResult& HitResult, EPhysicalSurface SurfaceType)
+{
+	if(!HitResult.bBlockingHit)
+	{
+		return;
+	}
+
+	// 최대 수를 초과할 경우 오래된 칸을 찾지 않고 캐시를 비웁니다.
+	if(SurfaceCells.Num() >= MaxCachedCells)
+	{
+		SurfaceCells.Reset();
+		UntrackAllMovableSurfaceComponents();
+	}
+
+	UPrimitiveComponent* HitComponent = HitResult.GetComponent();
+
+	FPRSurfaceCacheEntry& Entry = SurfaceCells.FindOrAdd(GetSurfaceCellKey(TraceStart));
+	Entry.SurfaceType = SurfaceType;
+	Entry.GroundHeight = HitResult.ImpactPoint.Z;
+	Entry.ImpactNormal = HitResult.ImpactNormal;
+	Entry.HitComponent = HitComponent;
+	Entry.HitComponentTransform = IsValid(HitComponent) ? HitComponent->GetComponentTransform() : FTransform::Identity;
+	Entry.CachedTime = GetWorld()->GetTimeSeconds();
+
+	// 움직일 수 있는 바닥은 움직이는 즉시 칸을 제거하도록 추적합니다.
+	if(IsValid(HitComponent) && HitComponent->Mobility != EComponentMobility::Static)
+	{
+		TrackMovableSurfaceComponent(HitComponent);
+	}
+
+	UpdateCachedCellCount();
+}
+
+void UPRSurfaceCacheSubsystem::InvalidateSurfaceCacheInBounds(const FBox& Bounds)
+{
+	if(!Bounds.IsValid)
+	{
+		return;
+	}
+
+	// 영역과 겹치는 칸의 범위를 구합니다. 높이 구간은 영역의 위아래 한 칸까지 포함합니다.
+	const FIntVector MinKey = GetSurfaceCellKey(Bounds.Min) - FIntVector(0, 0, 1);
+	const FIntVector MaxKey = GetSurfaceCellKey(Bounds.Max) + FIntVector(0, 0, 1);
+	const int64 RangeCellCount = static_cast<int64>(MaxKey.X - MinKey.X + 1) * (MaxKey.Y - MinKey.Y + 1) * (MaxKey.Z - MinKey.Z + 1);
+	int32 RemoveCount = 0;
+	if(RangeCellCount <= SurfaceCells.Num())
+	{
+		// 움직이는 충돌은 매 프레임 호출하므로 범위가 작을 경우 범위 안의 키만 제거합니다.
+		for(int32 X = MinKey.X; X <= MaxKey.X; X++)
+		{
+			for(int32 Y = MinKey.Y; Y <= MaxKey.Y; Y++)
+			{
+				for(int32 Z = MinKey.Z; Z <= MaxKey.Z; Z++)
+				{
+					RemoveCount += SurfaceCells.Remove(FIntVector(X, Y, Z));
+				}
+			}
+		}
+	}
+	else
+	{
+		for(auto It = SurfaceCells.CreateIterator(); It; ++It)
+		{
+			const FIntVector& CellKey = It.Key();
+			if(CellKey.X >= MinKey.X && CellKey.X <= MaxKey.X
+				&& CellKey.Y >= MinKey.Y && CellKey.Y <= MaxKey.Y
+				&& CellKey.Z >= MinKey.Z && CellKey.Z <= MaxKey.Z)
+			{
+				It.RemoveCurrent();
+				RemoveCount++;
+			}
+		}
+	}
+
+	if(RemoveCount == 0)
+	{
+		return;
+	}
+
+	SurfaceCacheStats.InvalidatedCount += RemoveCount;
+	INC_DWORD_STAT_BY(STAT_PRSurfaceCacheInvalidated, RemoveCount);
+	UpdateCachedCellCount();
+}
+
+void UPRSurfaceCacheSubsystem::RegisterMovingCollisionComponent(UPrimitiveComponent* CollisionComponent)
+{
+	if(!IsValid(CollisionComponent) || MovingCollisionComponents.Contains(CollisionComponent))
+	{
+		return;
+	}
+
+	FPRMovingCollisionRegistration& Registration = MovingCollisionComponents.Emplace(CollisionComponent);
+	Registration.TransformUpdatedHandle = CollisionComponent->TransformUpdated.AddUObject(this, &UPRSurfaceCacheSubsystem::OnMovingCollisionTransformUpdated);
+	Registration.LastBounds = CollisionComponent->Bounds.GetBox();
+
+	// 등록하기 전에 저장한 칸이 이미 충돌에 덮였을 수 있으므로 현재 영역의 칸을 제거합니다.
+	InvalidateSurfaceCacheInBounds(Registration.LastBounds);
+}
+
+void UPRSurfaceCacheSubsystem::UnregisterMovingCollisionComponent(UPrimitiveComponent* CollisionComponent)
+{
+	FPRMovingCollisionRegistration Registration;
+	if(MovingCollisionComponents.RemoveAndCopyValue(CollisionComponent, Registration) && IsValid(CollisionComponent))
+	{
+		CollisionComponent->TransformUpdated.Remove(Registration.TransformUpdatedHandle);
+	}
+}
+
+void UPRSurfaceCacheSubsystem::ClearSurfaceCache()
+{
+	SurfaceCells.Empty();
+	UntrackAllMovableSurfaceComponents();
+	UpdateCachedCellCount();
+}
+
+void UPRSurfaceCacheSubsystem::ResetSurfaceCacheStats()
+{
+	SurfaceCacheStats.HitCount = 0;
+	SurfaceCacheStats.MissCount = 0;
+	SurfaceCacheStats.InvalidatedCount = 0;
+}
+
+FIntVector UPRSurfaceCacheSubsystem::GetSurfaceCellKey(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt32(Location.X / CellSize),
+						FMath::FloorToInt32(Location.Y / CellSize),
+						FMath::FloorToInt32(Location.Z / HeightBandSize));
+}
+
+bool UPRSurfaceCacheSubsystem::IsValidSurfaceEntry(const FPRSurfaceCacheEntry& Entry) const
+{
+	if(GetWorld()->GetTimeSeconds() - Entry.CachedTime > EntryLifespan)
+	{
+		return false;
+	}
+
+	const UPrimitiveComponent* HitComponent = Entry.HitComponent.Get();
+	if(!IsValid(HitComponent) || !HitComponent->IsCollisionEnabled())
+	{
+		return false;
+	}
+
+	// Static 바닥은 움직일 수 없으므로 Transform을 비교하지 않습니다.
+	if(HitComponent->Mobility == EComponentMobility::Static)
+	{
+		return true;
+	}
+
+	return HitComponent->GetComponentTransform().Equals(Entry.HitComponentTransform, KINDA_SMALL_NUMBER);
+}
+
+void UPRSurfaceCacheSubsystem::OnLevelStreamingChanged(ULevel* Level, UWorld* World)
+{
+	// 스트리밍된 레벨의 바닥이 기존 칸과 겹칠 수 있으므로 캐시를 비웁니다.
+	if(World == GetWorld())
+	{
+		ClearSurfaceCache();
+	}
+}
+
+void UPRSurfaceCacheSubsystem::UpdateCachedCellCount()
+{
+	SurfaceCacheStats.CachedCellCount = SurfaceCells.Num();
+	SET_DWORD_STAT(STAT_PRSurfaceCacheCells, SurfaceCells.Num());
+}
+
+void UPRSurfaceCacheSubsystem::TrackMovableSurfaceComponent(UPrimitiveComponent* SurfaceComponent)
+{
+	if(TrackedMovableSurfaceComponents.Contains(SurfaceComponent))
+	{
+		return;
+	}
+
+	const FDelegateHandle TransformUpdatedHandle = SurfaceComponent->TransformUpdated.AddUObject(this, &UPRSurfaceCacheSubsystem::OnSurfaceComponentTransformUpdated);
+	TrackedMovableSurfaceComponents.Emplace(SurfaceComponent, TransformUpdatedHandle);
+}
+
+void UPRSurfaceCacheSubsystem::UntrackAllMovableSurfaceComponents()
+{
+	for(const auto& TrackedComponent : TrackedMovableSurfaceComponents)
+	{
+		if(UPrimitiveComponent* SurfaceComponent = TrackedComponent.Key.Get())
+		{
+			SurfaceComponent->TransformUpdated.Remove(TrackedComponent.Value);
+		}
+	}
+
+	TrackedMovableSurfaceComponents.Empty();
+}
+
+void UPRSurfaceCacheSubsystem::OnSurfaceComponentTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UPrimitiveComponent* SurfaceComponent = Cast<UPrimitiveComponent>(UpdatedComponent);
+	if(!SurfaceComponent)
+	{
+		return;
+	}
+
+	// 다음 발걸음에서 다시 탐색하여 저장할 때 추적을 재개하므로, 매 프레임 움직이는 바닥도 한 번만 처리합니다.
+	FDelegateHandle TransformUpdatedHandle;
+	if(TrackedMovableSurfaceComponents.RemoveAndCopyValue(SurfaceComponent, TransformUpdatedHandle))
+	{
+		SurfaceComponent->TransformUpdated.Remove(TransformUpdatedHandle);
+	}
+
+	// 움직이기 전의 위치에 저장한 칸을 제거합니다.
+	int32 RemoveCount = 0;
+	for(auto It = SurfaceCells.CreateIterator(); It; ++It)
+	{
+		if(It.Value().HitComponent == SurfaceComponent)
+		{
+			It.RemoveCurrent();
+			RemoveCount++;
+		}
+	}
+
+	SurfaceCacheStats.InvalidatedCount += RemoveCount;
+	INC_DWORD_STAT_BY(STAT_PRSurfaceCacheInvalidated, RemoveCount);
+
+	// 움직인 바닥이 다른 바닥의 칸을 덮었을 수 있으므로 이동한 영역의 칸도 제거합니다.
+	InvalidateSurfaceCacheInBounds(SurfaceComponent->Bounds.GetBox());
+}
+
+void UPRSurfaceCacheSubsystem::UnregisterAllMovingCollisionComponents()
+{
+	for(const auto& MovingCollision : MovingCollisionComponents)
+	{
+		if(UPrimitiveComponent* CollisionComponent = MovingCollision.Key.Get())
+		{
+			CollisionComponent->TransformUpdated.Remove(MovingCollision.Value.TransformUpdatedHandle);
+		}
+	}
+
+	MovingCollisionComponents.Empty();
+}
+
+void UPRSurfaceCacheSubsystem::OnMovingCollisionTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UPrimitiveComponent* CollisionComponent = Cast<UPrimitiveComponent>(UpdatedComponent);
+	FPRMovingCollisionRegistration* Registration = MovingCollisionComponents.Find(CollisionComponent);
+	if(!Registration)
+	{
+		return;
+	}
+
+	// 등록은 유지하므로 매 프레임 움직이는 충돌도 이전 영역과 이동한 영역의 칸을 계속 제거합니다.
+	const FBox CurrentBounds = CollisionComponent->Bounds.GetBox();
+	InvalidateSurfaceCacheInBounds(Registration->LastBounds);
+	InvalidateSurfaceCacheInBounds(CurrentBounds);
+	Registration->LastBounds = CurrentBounds;
+}
@@ -4,9 +4,6 @@
 #include "Weapons/PRBaseWeapon.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
-#include "Effects/PRNiagaraEffect.h"
-#include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 
 APRBaseWeapon::APRBaseWeapon()
 {
@@ -27,6 +24,8 @@ APRBaseWeapon::APRBaseWeapon()
 	EffectColor = FLinearColor(20.0f, 15.0f, 200.0f, 1.0f);
 	WeaponMeshVariableName = TEXT("WeaponMesh");
 	EffectColorVariableName = TEXT("EffectColor");
+	MainWeaponSpawnEffectParameters = FPRNiagaraParameterBlock();
+	MainWeaponSheatheEffectParameters = FPRNiagaraParameterBlock();
 
 	// MainWeapon
 	MainWeapon = CreateDefaultSubobject<USceneComponent>(TEXT("MainWeapon"));
@@ -45,7 +44,12 @@ APRBaseWeapon::APRBaseWeapon()
 void APRBaseWeapon::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	// Spawn 이펙트의 사용자 파라미터는 바뀌지 않으므로 미리 설정합니다.
+	MainWeaponSpawnEffectParameters.SetStaticMeshComponentParameter(WeaponMeshVariableName, MainWeaponMesh);
+	MainWeaponSpawnEffectParameters.SetLinearColorParameter(EffectColorVariableName, EffectColor);
+	MainWeaponSheatheEffectParameters.SetStaticMeshParameter(WeaponMeshVariableName, MainWeaponMesh->GetStaticMesh());
+	MainWeaponSheatheEffectParameters.SetLinearColorParameter(EffectColorVariableName, EffectColor);
 }
 
 void APRBaseWeapon::InitializeWeapon(APRBaseCharacter* NewPROwner, FPRWeaponStat NewWeaponStat)
@@ -87,18 +91,8 @@ void APRBaseWeapon::Draw(bool bActivateSpawnEffect)
 		// SpawnEffect를 Spawn합니다.
 		if(bActivateSpawnEffect)
 		{
-			APRNiagaraEffect* MainWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, MainWeapon->GetComponentLocation(),
-																																MainWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																																true, true);
-			
-			if(IsValid(MainWeaponSpawnNiagaraEffect))
-			{
-				// StaticMesh
-				UNiagaraFunctionLibrary::OverrideSystemUserVariableStaticMeshComponent(MainWeaponSpawnNiagaraEffect->GetNiagaraEffect(), WeaponMeshVariableName.ToString(), MainWeaponMesh);
-
-				// LinearColor
-				MainWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, MainWeaponSpawnEffectParameters, MainWeapon->GetComponentLocation(),
+																												MainWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 		}
 		
 		if(IsActivate() == false)
@@ -115,17 +109,8 @@ void APRBaseWeapon::Sheathe(bool bActivateSpawnEffect, bool bVisible)
 		// SpawnEffect를 Spawn합니다.
 		if(bActivateSpawnEffect)
 		{
-			APRNiagaraEffect* MainWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, MainWeapon->GetComponentLocation(),
-																																MainWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																																true, true);
-			if(IsValid(MainWeaponSpawnNiagaraEffect))
-			{
-				// StaticMesh
-				MainWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableStaticMesh(WeaponMeshVariableName, MainWeaponMesh->GetStaticMesh());
-
-				// LinearColor
-				MainWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, MainWeaponSheatheEffectParameters, MainWeapon->GetComponentLocation(),
+																												MainWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 		}
 		
 		// 무기를 숨길 경우 비활성화합니다.
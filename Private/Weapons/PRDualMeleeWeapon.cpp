@@ -4,9 +4,6 @@
 #include "Weapons/PRDualMeleeWeapon.h"
 #include "Characters/PRBaseCharacter.h"
 #include "Components/PREffectSystemComponent.h"
-#include "Effects/PRNiagaraEffect.h"
-#include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 
 APRDualMeleeWeapon::APRDualMeleeWeapon()
 {
@@ -29,6 +26,16 @@ APRDualMeleeWeapon::APRDualMeleeWeapon()
 	SubWeaponDrawRotationOffset = FRotator::ZeroRotator;
 	SubWeaponSheatheLocationOffset = FVector::ZeroVector;
 	SubWeaponSheatheRotationOffset = FRotator::ZeroRotator;
+	SubWeaponSpawnEffectParameters = FPRNiagaraParameterBlock();
+}
+
+void APRDualMeleeWeapon::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Spawn 이펙트의 사용자 파라미터는 바뀌지 않으므로 미리 설정합니다.
+	SubWeaponSpawnEffectParameters.SetStaticMeshComponentParameter(WeaponMeshVariableName, SubWeaponMesh);
+	SubWeaponSpawnEffectParameters.SetLinearColorParameter(EffectColorVariableName, EffectColor);
 }
 
 void APRDualMeleeWeapon::Draw(bool bActivateSpawnEffect)
@@ -46,29 +53,12 @@ void APRDualMeleeWeapon::Draw(bool bActivateSpawnEffect)
 		if(bActivateSpawnEffect)
 		{
 			// MainWeaponSpawnEffect
-			APRNiagaraEffect* MainWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, MainWeapon->GetComponentLocation(),
-																																MainWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																																true, true);
-			if(IsValid(MainWeaponSpawnNiagaraEffect))
-			{
-				UNiagaraFunctionLibrary::OverrideSystemUserVariableStaticMeshComponent(MainWeaponSpawnNiagaraEffect->GetNiagaraEffect(), WeaponMeshVariableName.ToString(), MainWeaponMesh);
-				
-				// LinearColor
-				MainWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, MainWeaponSpawnEffectParameters, MainWeapon->GetComponentLocation(),
+																												MainWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 
 			// SubWeaponSpawnEffect
-			APRNiagaraEffect* SubWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, SubWeapon->GetComponentLocation(),
-																																SubWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																																true, true);
-			if(IsValid(SubWeaponSpawnNiagaraEffect))
-			{
-				// StaticMesh
-				UNiagaraFunctionLibrary::OverrideSystemUserVariableStaticMeshComponent(SubWeaponSpawnNiagaraEffect->GetNiagaraEffect(), WeaponMeshVariableName.ToString(), SubWeaponMesh);
-
-				// LinearColor
-				SubWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, SubWeaponSpawnEffectParameters, SubWeapon->GetComponentLocation(),
+																												SubWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 		}
 		
 		// 활성하되지 않았을 경우 활성화합니다.
@@ -87,30 +77,12 @@ void APRDualMeleeWeapon::Sheathe(bool bActivateSpawnEffect, bool bVisible)
 		if(bActivateSpawnEffect)
 		{
 			// MainWeaponSpawnEffect
-			APRNiagaraEffect* MainWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, MainWeapon->GetComponentLocation(),
-																															MainWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																															true, true);
-			if(IsValid(MainWeaponSpawnNiagaraEffect))
-			{
-				// StaticMesh
-				UNiagaraFunctionLibrary::OverrideSystemUserVariableStaticMeshComponent(MainWeaponSpawnNiagaraEffect->GetNiagaraEffect(), WeaponMeshVariableName.ToString(), MainWeaponMesh);
-
-				// LinearColor
-				MainWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, MainWeaponSpawnEffectParameters, MainWeapon->GetComponentLocation(),
+																												MainWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 
 			// SubWeaponSpawnEffect
-			APRNiagaraEffect* SubWeaponSpawnNiagaraEffect = GetPROwner()->GetEffectSystem()->SpawnNiagaraEffectAtLocation(SpawnNiagaraEffect, SubWeapon->GetComponentLocation(),
-																															SubWeaponMesh->GetComponentRotation(), FVector(1.0f),
-																															true, true);
-			if(IsValid(SubWeaponSpawnNiagaraEffect))
-			{
-				// StaticMesh
-				UNiagaraFunctionLibrary::OverrideSystemUserVariableStaticMeshComponent(SubWeaponSpawnNiagaraEffect->GetNiagaraEffect(), WeaponMeshVariableName.ToString(), SubWeaponMesh);
-
-				// LinearColor
-				SubWeaponSpawnNiagaraEffect->GetNiagaraEffect()->SetVariableLinearColor(EffectColorVariableName, EffectColor);
-			}
+			GetPROwner()->GetEffectSystem()->SpawnNiagaraSystemAtLocationWithParameters(SpawnNiagaraEffect, SubWeaponSpawnEffectParameters, SubWeapon->GetComponentLocation(),
+																												SubWeaponMesh->GetComponentRotation(), FVector(1.0f), true, true);
 		}
 		
 		// 무기를 숨길 경우 비활성화합니다.
@@ -23,7 +23,9 @@ public class ProjectReplica : ModuleRules
 			"AnimationLocomotionLibraryRuntime",
 			"AnimGraphRuntime",
 			"MotionWarping",
-			"NiagaraAnimNotifies"
+			"NiagaraAnimNotifies",
+			"AssetRegistry",
+			"AudioExtensions"
 		});
 	}
 }
@@ -4,10 +4,110 @@
 
 #include "ProjectReplica.h"
 #include "AnimNotifies/ANS_PRTimedNiagaraEffect.h"
+#include "Effects/PRNiagaraParameterBlock.h"
 #include "ANS_PRNiagaraEffectTrail.generated.h"
 
+/**
+ * Trail의 Socket 위치를 일정한 시간 간격으로 보관하는 고정된 크기의 링 버퍼를 나타내는 구조체입니다.
+ * 최근 프레임의 Socket 위치를 Catmull-Rom 스플라인의 제어점으로 보관하여 프레임 사이의 위치를 계산합니다.
+ */
+struct FPRTrailSampleRingBuffer
+{
+public:
+	FPRTrailSampleRingBuffer()
+		: StartLocations()
+		, EndLocations()
+		, NextIndex(0)
+		, SampleCount(0)
+		, KeyStartLocations{FVector::ZeroVector, FVector::ZeroVector}
+		, KeyEndLocations{FVector::ZeroVector, FVector::ZeroVector}
+		, KeyTimes{0.0f, 0.0f}
+		, KeyCount(0)
+		, ElapsedTime(0.0f)
+		, NextSampleTime(0.0f)
+	{}
+
+public:
+	/** 링 버퍼를 주어진 크기로 초기화하는 함수입니다. */
+	void Reset(int32 Capacity)
+	{
+		StartLocations.SetNumUninitialized(Capacity);
+		EndLocations.SetNumUninitialized(Capacity);
+		NextIndex = 0;
+		SampleCount = 0;
+		KeyCount = 0;
+		ElapsedTime = 0.0f;
+		NextSampleTime = 0.0f;
+	}
+
+	/** 샘플을 링 버퍼에 추가하는 함수입니다. 가득 찼을 경우 가장 오래된 샘플을 덮어씁니다. */
+	void AddSample(const FVector& StartLocation, const FVector& EndLocation)
+	{
+		const int32 Capacity = StartLocations.Num();
+		if(Capacity <= 0)
+		{
+			return;
+		}
+
+		StartLocations[NextIndex] = StartLocation;
+		EndLocations[NextIndex] = EndLocation;
+		NextIndex = (NextIndex + 1) % Capacity;
+		SampleCount = FMath::Min(SampleCount + 1, Capacity);
+	}
+
+	/** Socket 위치를 제어점에 추가하는 함수입니다. 최근 2개의 제어점만 보관합니다. */
+	void AddKey(const FVector& StartLocation, const FVector& EndLocation, float Time)
+	{
+		if(KeyCount == 2)
+		{
+			KeyStartLocations[0] = KeyStartLocations[1];
+			KeyEndLocations[0] = KeyEndLocations[1];
+			KeyTimes[0] = KeyTimes[1];
+			KeyCount--;
+		}
+
+		KeyStartLocations[KeyCount] = StartLocation;
+		KeyEndLocations[KeyCount] = EndLocation;
+		KeyTimes[KeyCount] = Time;
+		KeyCount++;
+	}
+
+public:
+	/** 샘플링한 Trail의 시작 위치입니다. */
+	TArray<FVector> StartLocations;
+
+	/** 샘플링한 Trail의 끝 위치입니다. */
+	TArray<FVector> EndLocations;
+
+	/** 다음에 샘플을 저장할 Index입니다. */
+	int32 NextIndex;
+
+	/** 링 버퍼에 저장된 샘플의 수입니다. */
+	int32 SampleCount;
+
+	/** 최근 프레임의 Trail의 시작 위치입니다. */
+	FVector KeyStartLocations[2];
+
+	/** 최근 프레임의 Trail의 끝 위치입니다. */
+	FVector KeyEndLocations[2];
+
+	/** 최근 프레임의 시간입니다. */
+	float KeyTimes[2];
+
+	/** 저장된 제어점의 수입니다. */
+	int32 KeyCount;
+
+	/** NotifyBegin부터 지난 시간입니다. */
+	float ElapsedTime;
+
+	/** 다음 샘플을 계산할 시간입니다. */
+	float NextSampleTime;
+};
+
 /**
  * 캐릭터의 EffectSystem에서 가져온 NiagaraEffect Trail을 가져와 Spawn하는 AnimNotifyState 클래스입니다.
+ * Socket 위치를 프레임보다 짧은 일정한 시간 간격으로 샘플링하여 링 버퍼에 저장하고, 프레임마다 한 번에 배열로 Niagara에 전달합니다.
+ * NotifyTick은 프레임마다 Socket을 샘플링하므로 바로 실행하며, 첫 Tick에 Trail이 있도록 NotifyBegin과 NotifyEnd도 큐에 저장하지 않고 바로 실행합니다.
  */
 UCLASS()
 class PROJECTREPLICA_API UANS_PRNiagaraEffectTrail : public UANS_PRTimedNiagaraEffect
@@ -18,7 +118,28 @@ public:
 	UANS_PRNiagaraEffectTrail(const FObjectInitializer& ObjectInitializer);
 
 public:
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+private:
+	/**
+	 * 이전 프레임부터 현재 프레임까지 일정한 시간 간격으로 Socket 위치를 계산하여 링 버퍼에 추가하는 함수입니다.
+	 *
+	 * @param SampleBuffer 샘플을 추가할 링 버퍼입니다.
+	 * @param StartLocation 현재 프레임의 Trail의 시작 위치입니다.
+	 * @param EndLocation 현재 프레임의 Trail의 끝 위치입니다.
+	 * @param FrameDeltaTime 이전 프레임부터 지난 시간입니다.
+	 */
+	void AddSubFrameSamples(FPRTrailSampleRingBuffer& SampleBuffer, const FVector& StartLocation, const FVector& EndLocation, float FrameDeltaTime) const;
+
+	/**
+	 * 링 버퍼의 샘플을 오래된 순서대로 NiagaraComponent의 배열 파라미터에 한 번에 전달하는 함수입니다.
+	 *
+	 * @param NiagaraComponent 샘플을 전달할 NiagaraComponent입니다.
+	 * @param SampleBuffer 전달할 샘플의 링 버퍼입니다.
+	 */
+	void SubmitTrailSamples(UNiagaraComponent* NiagaraComponent, const FPRTrailSampleRingBuffer& SampleBuffer);
 
 protected:
 	/** Trail의 시작 Socket의 이름입니다. */
@@ -28,4 +149,46 @@ protected:
 	/** Trail의 끝 Socket의 이름입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect")
 	FName EndSocket;
+
+	/** Trail의 시작 위치를 전달할 사용자 파라미터의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect")
+	FName StartSocketVariableName;
+
+	/** Trail의 끝 위치를 전달할 사용자 파라미터의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect")
+	FName EndSocketVariableName;
+
+	/** 샘플링한 Trail의 시작 위치들을 전달할 Position 배열 사용자 파라미터의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling")
+	FName StartSamplesVariableName;
+
+	/** 샘플링한 Trail의 끝 위치들을 전달할 Position 배열 사용자 파라미터의 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling")
+	FName EndSamplesVariableName;
+
+	/** Socket 위치를 샘플링하는 초당 횟수입니다. 게임의 프레임레이트와 관계없이 일정한 간격으로 샘플링합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (ClampMin = "1.0"))
+	float SubFrameSampleRate;
+
+	/** 한 프레임에 추가할 수 있는 최대 샘플의 수입니다. 프레임이 크게 늦어져도 샘플링 비용이 늘어나지 않도록 합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (ClampMin = "1"))
+	int32 MaxSamplesPerTick;
+
+	/** 링 버퍼에 보관하는 샘플의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|NiagaraEffect|SubFrameSampling", meta = (ClampMin = "2"))
+	int32 SampleBufferCapacity;
+
+private:
+	/** Tick마다 Trail에 적용할 사용자 파라미터입니다. 파라미터의 Offset을 저장하여 이름으로 다시 찾지 않습니다. */
+	UPROPERTY(Transient)
+	FPRNiagaraParameterBlock TrailParameters;
+
+	/** SkeletalMeshComponent와 노티파이 이벤트별 Trail 샘플의 링 버퍼입니다. 종료된 링 버퍼는 배열을 해제하지 않고 재사용합니다. */
+	TPRNotifyInstanceStorage<FPRTrailSampleRingBuffer> TrailSampleBuffers;
+
+	/** 링 버퍼의 샘플을 순서대로 정렬하여 전달할 때 재사용하는 배열입니다. */
+	TArray<FVector> SubmitStartLocations;
+
+	/** 링 버퍼의 샘플을 순서대로 정렬하여 전달할 때 재사용하는 배열입니다. */
+	TArray<FVector> SubmitEndLocations;
 };
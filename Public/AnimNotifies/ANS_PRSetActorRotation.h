@@ -4,13 +4,14 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "ANS_PRSetActorRotation.generated.h"
 
 /**
  * NotifyBegin에서 현재 액터의 회전 값을 저장하고 NotifyEnd에서 설정한 회전 값을 더하여 액터의 회전 값을 설정하는 AnimNotifyState 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UANS_PRSetActorRotation : public UAnimNotifyState
+class PROJECTREPLICA_API UANS_PRSetActorRotation : public UAnimNotifyState, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
@@ -20,6 +21,7 @@ public:
 public:
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
 
 protected:
 	/** 입력받은 인자의 Owner의 현재 회전 값을 CurrentRotation에 저장하는 함수입니다. */
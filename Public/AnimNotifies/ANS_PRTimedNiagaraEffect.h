@@ -4,15 +4,18 @@
 
 #include "ProjectReplica.h"
 #include "AnimNotifyState_TimedNiagaraEffect.h"
+#include "AnimNotifies/PRNotifyInstanceStorage.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "ANS_PRTimedNiagaraEffect.generated.h"
 
 class APRNiagaraEffect;
+class UPREffectSystemComponent;
 
 /**
  * 캐릭터의 EffectSystem에서 NiagaraEffect를 가져와 Spawn하는 AnimNotifyState 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UANS_PRTimedNiagaraEffect : public UAnimNotifyState_TimedNiagaraEffect
+class PROJECTREPLICA_API UANS_PRTimedNiagaraEffect : public UAnimNotifyState_TimedNiagaraEffect, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
@@ -22,14 +25,44 @@ public:
 public:
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(class USkeletalMeshComponent * MeshComp, class UAnimSequenceBase * Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const override;
 
 protected:
 	/** NiagaraEffect를 Spawn하는 함수입니다. */
 	UFUNCTION(BlueprintCallable, Category = "EffectSystem|NiagaraEffect")
 	APRNiagaraEffect* SpawnNiagaraEffect(USkeletalMeshComponent* MeshComp);
 
+	/** NiagaraEffect를 Spawn하고 인스턴스에 저장하는 함수입니다. NotifyBegin에서 실행합니다. */
+	void BeginTimedEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference);
+
+	/** 인스턴스가 Spawn한 NiagaraEffect를 비활성화하는 함수입니다. NotifyEnd에서 실행합니다. */
+	void EndTimedEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference);
+
+	/**
+	 * 인스턴스가 Spawn한 NiagaraEffect를 반환하는 함수입니다.
+	 *
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @return Spawn한 NiagaraEffect입니다. 없을 경우 nullptr을 반환합니다.
+	 */
+	APRNiagaraEffect* GetSpawnedNiagaraEffect(const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference);
+
+	/**
+	 * 노티파이를 실행한 캐릭터의 EffectSystem을 반환하는 함수입니다.
+	 * EffectSystem이 있을 경우 EffectSystem이 Spawn하지 않은 이펙트를 엔진의 방식으로 Spawn하지 않습니다.
+	 *
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @return 캐릭터의 EffectSystem입니다. 없을 경우 nullptr을 반환합니다.
+	 */
+	UPREffectSystemComponent* GetOwnerEffectSystem(const USkeletalMeshComponent* MeshComp) const;
+
 protected:
-	/** Spawn한 NiagaraEffect입니다. */
-	UPROPERTY(BlueprintReadWrite, Category ="EffectSystem|NiagaraEffect")
-	TObjectPtr<APRNiagaraEffect> NiagaraEffect;
+	/** 캐릭터의 Significance에 따라 NiagaraEffect를 Spawn하지 않는 설정입니다. NotifyEnd는 항상 실행합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EffectSystem|Significance")
+	FPRAnimNotifySignificanceSettings SignificanceSettings;
+
+private:
+	/** SkeletalMeshComponent와 노티파이 이벤트별로 Spawn한 NiagaraEffect입니다. 노티파이 객체는 같은 몽타주를 재생하는 모든 캐릭터가 공유합니다. */
+	TPRNotifyInstanceStorage<FPRTimedEffectInstance> EffectInstances;
 };
@@ -4,17 +4,26 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "ANS_PRVault.generated.h"
 
 /**
  * 캐릭터가 장애물을 뛰어넘을 때 사용하는 AnimNotifyState 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UANS_PRVault : public UAnimNotifyState
+class PROJECTREPLICA_API UANS_PRVault : public UAnimNotifyState, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
 public:
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+
+protected:
+	/** 입력받은 인자의 Owner를 Vault 상태로 설정하는 함수입니다. */
+	void SetOwnerVaultState(USkeletalMeshComponent* MeshComp);
+
+	/** 입력받은 인자의 Owner의 Vault 상태를 초기화하는 함수입니다. */
+	void ResetOwnerVaultState(USkeletalMeshComponent* MeshComp);
 };
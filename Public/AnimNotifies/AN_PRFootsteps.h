@@ -4,13 +4,17 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRFootsteps.generated.h"
 
+class UMaterialInterface;
+
 /**
  * 캐릭터의 발소리를 재생하고 발걸음 이펙트를 실행하는 AnimNotify 클래스입니다.
+ * 바닥의 탐색은 FootstepSubsystem의 비동기 Trace 한 번으로 발소리와 발자국 데칼이 함께 사용합니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRFootsteps : public UAnimNotify
+class PROJECTREPLICA_API UAN_PRFootsteps : public UAnimNotify, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 	
@@ -19,16 +23,15 @@ public:
 
 public:
 	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const override;
 
 private:
-	/** 발소리를 재생하는 함수입니다. */
+	/** FootstepSubsystem에 발소리와 발자국 데칼을 요청하는 함수입니다. */
 	void PlayFootsteps(USkeletalMeshComponent* MeshComp);
 
-	/** 발걸음 이펙트를 실행하는 함수입니다. */
-	void ActivateFootstepsEffect(USkeletalMeshComponent* MeshComp);
-
 private:
-	/** 디버그 실행을 나타내는 변수입니다. */
+	/** 디버그 실행을 나타내는 변수입니다. true일 경우 pr.Debug.Footsteps 콘솔 변수와 관계없이 디버그를 실행합니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Debug", meta = (AllowPrivateAccess = "true"))
 	bool bDebug;
 
@@ -36,6 +39,14 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps", meta = (AllowPrivateAccess = "true"))
 	float TraceDistance;
 
+	/** true일 경우 렌더링되지 않은 캐릭터는 바닥을 탐색하지 않고 기본 표면의 발소리만 재생합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps", meta = (AllowPrivateAccess = "true"))
+	bool bSkipTraceWhenNotRendered;
+
+	/** 캐릭터의 Significance에 따라 발걸음을 실행하지 않거나 간격을 두고 실행하는 설정입니다. 간격을 두고 실행하는 동안 바닥의 탐색도 같은 간격으로 줄어듭니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Significance", meta = (AllowPrivateAccess = "true"))
+	FPRAnimNotifySignificanceSettings SignificanceSettings;
+
 	/** 발걸음 이펙트의 위치 오프셋입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Effect", meta = (AllowPrivateAccess = "true"))
 	FVector EffectLocationOffset;
@@ -51,4 +62,12 @@ private:
 	/** 발걸음 이펙트를 Spawn할 위치에 해당하는 본의 이름입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Effect", meta = (AllowPrivateAccess = "true"))
 	FName BoneName;	
+
+	/** DecalSubsystem으로 바닥에 남기는 발자국 데칼의 머티리얼입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Effect", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UMaterialInterface> FootprintDecalMaterial;
+
+	/** 발자국 데칼의 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Effect", meta = (AllowPrivateAccess = "true"))
+	FVector FootprintDecalSize;
 };
@@ -4,13 +4,14 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRPlayFootsteps.generated.h"
 
 /**
  * 캐릭터의 발소리를 재생하는 AnimNotify 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRPlayFootsteps : public UAnimNotify
+class PROJECTREPLICA_API UAN_PRPlayFootsteps : public UAnimNotify, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
@@ -19,18 +20,31 @@ public:
 
 public:
 	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const override;
 
 private:
-	/** 발소리를 재생하는 함수입니다. */
+	/** FootstepSubsystem에 발소리를 요청하는 함수입니다. */
 	void PlayFootsteps(USkeletalMeshComponent* MeshComp);
 
 private:
-	/** 디버그 실행을 나타내는 변수입니다. */
+	/** 디버그 실행을 나타내는 변수입니다. true일 경우 pr.Debug.Footsteps 콘솔 변수와 관계없이 디버그를 실행합니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Debug", meta = (AllowPrivateAccess = "true"))
 	bool bDebug;
 
 	/** 발바닥에서부터 발소리를 출력할 피직스 머테리얼을 탐색하는 거리입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps", meta = (AllowPrivateAccess = "true"))
 	float TraceDistance;
-	
+
+	/** true일 경우 렌더링되지 않은 캐릭터는 바닥을 탐색하지 않고 기본 표면의 발소리만 재생합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps", meta = (AllowPrivateAccess = "true"))
+	bool bSkipTraceWhenNotRendered;
+
+	/** 캐릭터의 Significance에 따라 발걸음을 실행하지 않거나 간격을 두고 실행하는 설정입니다. 간격을 두고 실행하는 동안 바닥의 탐색도 같은 간격으로 줄어듭니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps|Significance", meta = (AllowPrivateAccess = "true"))
+	FPRAnimNotifySignificanceSettings SignificanceSettings;
+
+	/** true일 경우 SurfaceCacheSubsystem에 저장한 바닥의 표면을 사용하여 대부분의 바닥 탐색을 생략합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRPlayFootsteps", meta = (AllowPrivateAccess = "true"))
+	bool bUseSurfaceCache;
 };
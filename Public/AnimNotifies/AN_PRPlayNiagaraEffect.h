@@ -4,17 +4,30 @@
 
 #include "ProjectReplica.h"
 #include "AnimNotify_PlayNiagaraEffect.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRPlayNiagaraEffect.generated.h"
 
 /**
  * 캐릭터의 EffectSystem에서 NiagaraEffect를 가져와 Spawn하는 AnimNotify 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRPlayNiagaraEffect : public UAnimNotify_PlayNiagaraEffect
+class PROJECTREPLICA_API UAN_PRPlayNiagaraEffect : public UAnimNotify_PlayNiagaraEffect, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
 public:
+	UAN_PRPlayNiagaraEffect(const FObjectInitializer& ObjectInitializer);
+
+public:
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const override;
+
 	/** NiagaraSystemComponent를 Spawn하는 함수입니다. Notify에서 호출됩니다. */
 	virtual UFXSystemComponent* SpawnEffect(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation) override;
+
+private:
+	/** 캐릭터의 Significance에 따라 NiagaraEffect를 Spawn하지 않는 설정입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "EffectSystem|Significance", meta = (AllowPrivateAccess = "true"))
+	FPRAnimNotifySignificanceSettings SignificanceSettings;
 };
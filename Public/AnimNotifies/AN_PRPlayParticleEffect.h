@@ -4,17 +4,30 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotify_PlayParticleEffect.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRPlayParticleEffect.generated.h"
 
 /**
  * 캐릭터의 EffectSystem에서 ParticleEffect를 가져와 Spawn하는 AnimNotify 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRPlayParticleEffect : public UAnimNotify_PlayParticleEffect
+class PROJECTREPLICA_API UAN_PRPlayParticleEffect : public UAnimNotify_PlayParticleEffect, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
 public:
+	UAN_PRPlayParticleEffect(const FObjectInitializer& ObjectInitializer);
+
+public:
+	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const override;
+
 	/** ParticleSystemComponent를 Spawn하는 함수입니다. Notify에서 호출됩니다. */
 	virtual UParticleSystemComponent* SpawnParticleSystem(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation) override;
+
+private:
+	/** 캐릭터의 Significance에 따라 ParticleEffect를 Spawn하지 않는 설정입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "EffectSystem|Significance", meta = (AllowPrivateAccess = "true"))
+	FPRAnimNotifySignificanceSettings SignificanceSettings;
 };
@@ -4,13 +4,14 @@
 
 #include "ProjectReplica.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRSetActorRotation.generated.h"
 
 /**
  * 액터의 회전 값을 적용하는 AnimNotify 클래스입니다.
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRSetActorRotation : public UAnimNotify
+class PROJECTREPLICA_API UAN_PRSetActorRotation : public UAnimNotify, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
@@ -19,6 +20,7 @@ public:
 
 public:
 	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
 
 protected:
 	/** 입력받은 인자의 Owner의 RootLock을 설정하는 함수입니다. */
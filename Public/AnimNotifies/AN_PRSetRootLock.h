@@ -4,13 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
 #include "AN_PRSetRootLock.generated.h"
 
 /**
  * 캐릭터의 RootLock을 설정하여 재생하는 애니메이션의 RootMotion을 실행할지 설정하는 AnimNotify 클래스입니다. 
  */
 UCLASS()
-class PROJECTREPLICA_API UAN_PRSetRootLock : public UAnimNotify
+class PROJECTREPLICA_API UAN_PRSetRootLock : public UAnimNotify, public IPRDeferredAnimNotifyInterface
 {
 	GENERATED_BODY()
 
@@ -19,6 +20,7 @@ public:
 
 public:
 	virtual void Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) override;
 	virtual FString GetNotifyName_Implementation() const override;
 
 protected:
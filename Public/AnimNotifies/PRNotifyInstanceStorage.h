@@ -0,0 +1,186 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Animation/AnimTypes.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Effects/PREffect.h"
+#include "Objects/PRPooledRef.h"
+
+/**
+ * AnimNotifyState의 실행 인스턴스를 구분하는 키를 나타내는 구조체입니다.
+ * 같은 몽타주를 재생하는 SkeletalMeshComponent와 몽타주 안의 노티파이 이벤트의 조합으로 구분합니다.
+ */
+struct FPRNotifyInstanceKey
+{
+public:
+	FPRNotifyInstanceKey()
+		: MeshComp(nullptr)
+		, NotifyEvent(nullptr)
+	{}
+
+	FPRNotifyInstanceKey(const USkeletalMeshComponent* NewMeshComp, const FAnimNotifyEvent* NewNotifyEvent)
+		: MeshComp(NewMeshComp)
+		, NotifyEvent(NewNotifyEvent)
+	{}
+
+	bool operator==(const FPRNotifyInstanceKey& Other) const
+	{
+		return MeshComp == Other.MeshComp && NotifyEvent == Other.NotifyEvent;
+	}
+
+	friend uint32 GetTypeHash(const FPRNotifyInstanceKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MeshComp), PointerHash(Key.NotifyEvent));
+	}
+
+public:
+	/** 노티파이를 실행한 SkeletalMeshComponent입니다. */
+	TWeakObjectPtr<const USkeletalMeshComponent> MeshComp;
+
+	/** 실행한 노티파이 이벤트입니다. 키로만 사용하며 역참조하지 않습니다. */
+	const FAnimNotifyEvent* NotifyEvent;
+};
+
+/**
+ * 이펙트를 Spawn하는 AnimNotifyState의 인스턴스별 런타임 데이터를 나타내는 구조체입니다.
+ */
+struct FPRTimedEffectInstance
+{
+public:
+	FPRTimedEffectInstance()
+		: EffectRef()
+	{}
+
+public:
+	/**
+	 * Spawn한 이펙트의 핸들입니다.
+	 * 실행이 끝나 Pool에 반환된 후 다른 곳에서 다시 사용 중인 이펙트는 반환하지 않습니다.
+	 * 제거된 SkeletalMeshComponent의 데이터를 재사용할 때 남아있는 이펙트를 Pool에 반환합니다.
+	 */
+	TPRPooledRef<APREffect> EffectRef;
+};
+
+/**
+ * AnimNotifyState의 런타임 데이터를 SkeletalMeshComponent와 노티파이 이벤트별로 보관하는 템플릿 클래스입니다.
+ * 노티파이 객체는 몽타주를 재생하는 모든 SkeletalMeshComponent가 공유하므로 런타임 데이터를 멤버 변수에 직접 저장하지 않고 이 저장소에 저장합니다.
+ * 제거한 데이터는 해제하지 않고 재사용하므로, 같은 수의 인스턴스가 반복하여 실행되는 동안 데이터와 데이터가 가진 배열을 다시 할당하지 않습니다.
+ * 게임 스레드에서만 사용합니다.
+ */
+template<typename ValueType>
+class TPRNotifyInstanceStorage
+{
+public:
+	TPRNotifyInstanceStorage()
+		: InstanceIndices()
+		, Instances()
+		, FreeIndices()
+	{}
+
+public:
+	/**
+	 * 인스턴스의 데이터를 반환하는 함수입니다. 없을 경우 재사용하거나 추가합니다.
+	 * 재사용한 데이터는 이전 인스턴스의 값을 가지고 있으므로 bOutAdded가 true일 경우 초기화해야 합니다.
+	 *
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @param bOutAdded 새로 추가했는지 여부입니다.
+	 * @return 인스턴스의 데이터입니다.
+	 */
+	ValueType& FindOrAdd(const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference, bool* bOutAdded = nullptr)
+	{
+		const FPRNotifyInstanceKey Key(MeshComp, EventReference.GetNotify());
+		if(const int32* InstanceIndex = InstanceIndices.Find(Key))
+		{
+			if(bOutAdded)
+			{
+				*bOutAdded = false;
+			}
+
+			return Instances[*InstanceIndex];
+		}
+
+		// 저장소를 늘리기 전에 제거된 SkeletalMeshComponent의 인스턴스를 정리하여 재사용합니다.
+		if(FreeIndices.IsEmpty())
+		{
+			RemoveStaleInstances();
+		}
+
+		const int32 NewIndex = FreeIndices.IsEmpty() ? Instances.AddDefaulted() : FreeIndices.Pop(false);
+		InstanceIndices.Add(Key, NewIndex);
+		if(bOutAdded)
+		{
+			*bOutAdded = true;
+		}
+
+		return Instances[NewIndex];
+	}
+
+	/**
+	 * 인스턴스의 데이터를 찾는 함수입니다.
+	 *
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @return 인스턴스의 데이터입니다. 없을 경우 nullptr을 반환합니다.
+	 */
+	ValueType* Find(const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+	{
+		const int32* InstanceIndex = InstanceIndices.Find(FPRNotifyInstanceKey(MeshComp, EventReference.GetNotify()));
+		return InstanceIndex ? &Instances[*InstanceIndex] : nullptr;
+	}
+
+	/**
+	 * 인스턴스를 제거하는 함수입니다. 데이터는 해제하지 않고 다음 인스턴스에서 재사용합니다.
+	 *
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @return 제거했을 경우 true를 반환합니다.
+	 */
+	bool Remove(const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference)
+	{
+		int32 InstanceIndex = INDEX_NONE;
+		if(InstanceIndices.RemoveAndCopyValue(FPRNotifyInstanceKey(MeshComp, EventReference.GetNotify()), InstanceIndex))
+		{
+			FreeIndices.Push(InstanceIndex);
+			return true;
+		}
+
+		return false;
+	}
+
+	/** NotifyEnd 없이 SkeletalMeshComponent가 제거된 인스턴스를 제거하는 함수입니다. */
+	void RemoveStaleInstances()
+	{
+		for(auto It = InstanceIndices.CreateIterator(); It; ++It)
+		{
+			if(!It.Key().MeshComp.IsValid())
+			{
+				FreeIndices.Push(It.Value());
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	/** 모든 인스턴스와 데이터를 해제하는 함수입니다. */
+	void Empty()
+	{
+		InstanceIndices.Empty();
+		Instances.Empty();
+		FreeIndices.Empty();
+	}
+
+	/** 실행 중인 인스턴스의 수를 반환하는 함수입니다. */
+	FORCEINLINE int32 Num() const { return InstanceIndices.Num(); }
+
+private:
+	/** 인스턴스의 키와 데이터의 Index입니다. */
+	TMap<FPRNotifyInstanceKey, int32> InstanceIndices;
+
+	/** 인스턴스의 데이터입니다. 제거한 데이터도 재사용하기 위해 보관합니다. */
+	TArray<ValueType> Instances;
+
+	/** 재사용할 수 있는 데이터의 Index입니다. */
+	TArray<int32> FreeIndices;
+};
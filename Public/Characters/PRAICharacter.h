@@ -35,6 +35,9 @@ protected:
 	/** 오브젝트의 PoolIndex를 반환하는 함수입니다. */
 	virtual int32 GetPoolIndex_Implementation() const override;
 
+	/** 오브젝트가 활성화된 횟수를 반환하는 함수입니다. */
+	virtual int32 GetActivationCount_Implementation() const override;
+
 	/** 수명을 반환하는 함수입니다. */
 	virtual float GetLifespan_Implementation() const override;
 
@@ -51,6 +54,10 @@ protected:
 	/** AI 캐릭터의 활성화를 나타내는 변수입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Activate")
 	bool bActivate;
+
+	/** AI 캐릭터가 활성화된 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Activate")
+	int32 ActivationCount;
 #pragma endregion 
 
 #pragma region HealthBar
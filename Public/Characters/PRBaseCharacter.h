@@ -31,6 +31,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAttackEnd);
 // 임시
 class UNiagaraSystem;
 class UNiagaraComponent;
+class UMaterialInterface;
 
 /**
  * 캐릭터 클래스입니다.
@@ -98,7 +99,7 @@ private:
 	TObjectPtr<class UPRDamageSystemComponent> DamageSystem;
 
 	// 임시
-	/** DamageSystem의 디버그의 실행을 나타내는 변수입니다. */
+	/** DamageSystem의 디버그의 실행을 나타내는 변수입니다. true일 경우 pr.Debug.Damage 콘솔 변수와 관계없이 디버그를 실행합니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "임시", meta = (AllowPrivateAccess = "true"))
 	bool bDamageSystemDebug;
 
@@ -106,6 +107,21 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "임시", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UNiagaraSystem> HitNiagaraEffect;
 
+	/**
+	 * HitSparkSubsystem이 월드에 하나의 인스턴스로 모아 렌더링하는 히트 스파크 Niagara 이펙트입니다.
+	 * 설정된 경우 히트마다 HitNiagaraEffect를 Spawn하지 않습니다.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageSystem", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UNiagaraSystem> HitSparkNiagaraEffect;
+
+	/** 대미지를 준 위치에 DecalSubsystem으로 남기는 히트 자국 데칼의 머티리얼입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageSystem", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UMaterialInterface> HitMarkDecalMaterial;
+
+	/** 히트 자국 데칼의 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DamageSystem", meta = (AllowPrivateAccess = "true"))
+	FVector HitMarkDecalSize;
+
 	// 임시
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "임시", meta = (AllowPrivateAccess = "true"))
 	EPRElementType DamageElementType;
@@ -7,6 +7,7 @@
 #include "PRPlayerCharacter.generated.h"
 
 class UPRInputConfigDataAsset;
+class UPREffectPresetDataAsset;
 class UInputMappingContext;
 class UInputAction;
 class USpringArmComponent;
@@ -221,10 +222,17 @@ public:
 	void DoubleJump();
 
 protected:
+	/** 더블 점프 이펙트를 Spawn할 발 아래의 위치를 반환하는 함수입니다. */
+	FVector GetDoubleJumpEffectLocation() const;
+
 	/** 더블 점프 Niagara 이펙트입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DoubleJump")
 	TObjectPtr<UNiagaraSystem> DoubleJumpNiagaraEffect;
 
+	/** 더블 점프 이펙트와 사운드를 함께 Spawn하는 이펙트 프리셋입니다. 설정되었을 경우 DoubleJumpNiagaraEffect 대신 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "DoubleJump")
+	TObjectPtr<UPREffectPresetDataAsset> DoubleJumpEffectPreset;
+
 	/** Root 본 소켓 이름입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "DoubleJump")
 	FName RootSocketName;
@@ -251,6 +259,13 @@ protected:
 
 	/** 점프를 한 후 더블 점프를 할 수 있는 딜레이를 적용하는 TimerHandle입니다. */
 	FTimerHandle DoubleJumpTimerHandle;
+
+public:
+	/** DoubleJumpNiagaraEffect를 반환하는 함수입니다. */
+	FORCEINLINE UNiagaraSystem* GetDoubleJumpNiagaraEffect() const { return DoubleJumpNiagaraEffect; }
+
+	/** DoubleJumpEffectPreset을 반환하는 함수입니다. */
+	FORCEINLINE UPREffectPresetDataAsset* GetDoubleJumpEffectPreset() const { return DoubleJumpEffectPreset; }
 #pragma endregion
 	
 #pragma region Vaulting
@@ -294,7 +309,7 @@ private:
 	TObjectPtr<UCapsuleComponent> VaultCollision;
 	
 protected:
-	/** Vaulting의 디버그 실행을 나타내는 변수입니다. */
+	/** Vaulting의 디버그 실행을 나타내는 변수입니다. true일 경우 pr.Debug.Vault 콘솔 변수와 관계없이 디버그를 실행합니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Vaulting|Debug")
 	bool bVaultDebug;
 	
@@ -0,0 +1,184 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Commandlets/Commandlet.h"
+#include "PREffectPoolSettingsCommandlet.generated.h"
+
+class UDataTable;
+class UFXSystemAsset;
+class UAnimSequenceBase;
+class IAssetRegistry;
+
+/**
+ * 에셋에서 찾은 이펙트의 최대 동시 사용 수를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPoolUsage
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPoolUsage()
+		: MaxConcurrentCount(0)
+		, SourceName()
+	{}
+
+public:
+	/** 하나의 캐릭터가 동시에 사용할 수 있는 이펙트의 최대 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolUsage")
+	int32 MaxConcurrentCount;
+
+	/** MaxConcurrentCount를 결정한 에셋의 경로입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolUsage")
+	FString SourceName;
+};
+
+/**
+ * 애니메이션, 무기, 캐릭터 에셋이 참조하는 이펙트를 찾아 EffectSystem의 Pool 설정 데이터 테이블을 생성하거나 갱신하는 Commandlet 클래스입니다.
+ * 노티파이의 길이와 애니메이션의 재생 속도로 이펙트의 최대 동시 사용 수를 추정하여 PoolSize로 사용합니다.
+ *
+ * ex) UnrealEditor-Cmd.exe ProjectReplica.uproject -run=PREffectPoolSettings -Paths=/Game/ProjectReplica -Instances=2 -DryRun
+ *
+ * -Paths=         검색할 경로입니다. +로 구분합니다. 기본 값은 /Game입니다.
+ * -NiagaraTable=  갱신할 NiagaraEffect Pool 설정 데이터 테이블입니다. 없으면 캐릭터의 EffectSystem에서 찾습니다.
+ * -ParticleTable= 갱신할 ParticleEffect Pool 설정 데이터 테이블입니다. 없으면 캐릭터의 EffectSystem에서 찾습니다.
+ * -Instances=     동시에 이펙트를 사용하는 캐릭터의 수입니다.
+ * -MaxPoolSize=   PoolSize의 최대 값입니다.
+ * -DefaultLifespan= 데이터 테이블에 수명이 없는 일회성 이펙트의 수명입니다.
+ * -AllowShrink    추정한 값이 기존 PoolSize보다 작을 경우에도 갱신합니다.
+ * -DryRun         데이터 테이블을 수정하지 않고 결과만 로그로 남깁니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPREffectPoolSettingsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UPREffectPoolSettingsCommandlet();
+
+public:
+	virtual int32 Main(const FString& Params) override;
+
+#if WITH_EDITOR
+private:
+	/**
+	 * Commandlet의 인자를 읽는 함수입니다.
+	 *
+	 * @param Params Commandlet의 인자입니다.
+	 */
+	void ParseParameters(const FString& Params);
+
+	/**
+	 * 무기와 캐릭터 블루프린트가 참조하는 이펙트를 수집하는 함수입니다.
+	 * 데이터 테이블이 지정되지 않았을 경우 캐릭터의 EffectSystem이 사용하는 데이터 테이블을 가져옵니다.
+	 *
+	 * @param AssetRegistry 블루프린트를 검색할 AssetRegistry입니다.
+	 */
+	void GatherBlueprintEffectUsages(IAssetRegistry& AssetRegistry);
+
+	/**
+	 * 애니메이션 시퀀스와 몽타주의 노티파이가 참조하는 이펙트를 수집하는 함수입니다.
+	 *
+	 * @param AssetRegistry 애니메이션을 검색할 AssetRegistry입니다.
+	 */
+	void GatherAnimationEffectUsages(IAssetRegistry& AssetRegistry);
+
+	/**
+	 * 하나의 애니메이션에서 이펙트별 최대 동시 사용 수를 추정하여 수집하는 함수입니다.
+	 *
+	 * @param Animation 노티파이를 검색할 애니메이션입니다.
+	 */
+	void GatherAnimationEffectUsage(const UAnimSequenceBase* Animation);
+
+	/**
+	 * 이펙트가 활성화된 구간들이 최대 몇 개 겹치는지 계산하는 함수입니다.
+	 * 같은 애니메이션을 연속으로 재생할 경우 이전 재생의 이펙트와 겹치는 수도 포함합니다.
+	 *
+	 * @param ActiveIntervals 이펙트가 활성화된 시작 시간과 끝 시간의 목록입니다.
+	 * @param PlayLength 재생 속도를 적용한 애니메이션의 길이입니다.
+	 * @return 동시에 활성화되는 이펙트의 최대 수입니다.
+	 */
+	int32 EstimateConcurrentCount(const TArray<TPair<float, float>>& ActiveIntervals, float PlayLength) const;
+
+	/**
+	 * 이펙트의 사용 수를 기록하는 함수입니다. 기존의 값보다 클 경우에만 갱신합니다.
+	 *
+	 * @param EffectAsset 사용하는 이펙트입니다.
+	 * @param ConcurrentCount 동시에 사용하는 수입니다.
+	 * @param SourceName 이펙트를 참조하는 에셋의 경로입니다.
+	 */
+	void AddEffectUsage(UFXSystemAsset* EffectAsset, int32 ConcurrentCount, const FString& SourceName);
+
+	/** 데이터 테이블에 설정된 이펙트의 수명을 EffectLifespans에 저장하는 함수입니다. */
+	void CacheEffectLifespans();
+
+	/**
+	 * 일회성 이펙트의 수명을 반환하는 함수입니다.
+	 *
+	 * @param EffectAsset 수명을 찾을 이펙트입니다.
+	 * @return 데이터 테이블에 수명이 있을 경우 그 값을, 그렇지 않을 경우 DefaultEffectLifespan을 반환합니다.
+	 */
+	float GetEffectLifespan(UFXSystemAsset* EffectAsset) const;
+
+	/**
+	 * 수집한 사용 수로 데이터 테이블의 행을 추가하거나 PoolSize를 갱신하는 함수입니다.
+	 *
+	 * @param DataTable 갱신할 데이터 테이블입니다.
+	 * @param EffectAssetMember 데이터 테이블의 행에서 이펙트를 가리키는 멤버입니다.
+	 * @return 추가하거나 갱신한 행의 수입니다.
+	 */
+	template<typename RowType, typename AssetType>
+	int32 UpdatePoolSettingsDataTable(UDataTable* DataTable, TObjectPtr<AssetType> RowType::* EffectAssetMember);
+
+	/**
+	 * 데이터 테이블의 패키지를 저장하는 함수입니다.
+	 *
+	 * @param DataTable 저장할 데이터 테이블입니다.
+	 * @return 저장에 성공했을 경우 true를 반환합니다.
+	 */
+	bool SaveDataTable(UDataTable* DataTable) const;
+#endif
+
+private:
+	/** 에셋을 검색할 경로입니다. */
+	UPROPERTY()
+	TArray<FString> SearchPaths;
+
+	/** 데이터 테이블에 수명이 없는 일회성 이펙트의 수명입니다. */
+	UPROPERTY()
+	float DefaultEffectLifespan;
+
+	/** 동시에 이펙트를 사용하는 캐릭터의 수입니다. 추정한 동시 사용 수에 곱합니다. */
+	UPROPERTY()
+	int32 InstanceCount;
+
+	/** PoolSize의 최대 값입니다. */
+	UPROPERTY()
+	int32 MaxPoolSize;
+
+	/** 추정한 값이 기존 PoolSize보다 작을 경우에도 갱신할지 나타내는 변수입니다. */
+	UPROPERTY()
+	bool bAllowShrink;
+
+	/** 데이터 테이블을 수정하지 않고 결과만 로그로 남길지 나타내는 변수입니다. */
+	UPROPERTY()
+	bool bDryRun;
+
+	/** 갱신할 NiagaraEffect Pool 설정 데이터 테이블입니다. */
+	UPROPERTY()
+	TObjectPtr<UDataTable> NiagaraPoolSettingsDataTable;
+
+	/** 갱신할 ParticleEffect Pool 설정 데이터 테이블입니다. */
+	UPROPERTY()
+	TObjectPtr<UDataTable> ParticlePoolSettingsDataTable;
+
+	/** 이펙트별로 수집한 최대 동시 사용 수입니다. */
+	UPROPERTY()
+	TMap<TObjectPtr<UFXSystemAsset>, FPREffectPoolUsage> EffectUsages;
+
+	/** 데이터 테이블에 설정된 이펙트별 수명입니다. */
+	UPROPERTY()
+	TMap<TObjectPtr<UFXSystemAsset>, float> EffectLifespans;
+};
@@ -133,3 +133,90 @@ enum class EPRStatType : uint8
 	StatType_PhotoDamageBonus		UMETA(DisplayName = "PhotoDamageBonus"),		// 빛 속성 피해 보너스
 	StatType_EreboDamageBonus		UMETA(DisplayName = "EreboDamageBonus")			// 어둠 속성 피해 보너스
 };
+
+/**
+ * EffectSystem이 이펙트를 풀링하는 방식을 나타내는 열거형입니다. NiagaraComponentPool은 NiagaraSystem에만 사용할 수 있습니다.
+ */
+UENUM(BlueprintType)
+enum class EPREffectPoolingBackend : uint8
+{
+	EffectPoolingBackend_Actor						UMETA(DisplayName = "Actor"),						// PRNiagaraEffect 액터를 EffectSystem의 Pool에서 관리합니다.
+	EffectPoolingBackend_NiagaraComponentPool		UMETA(DisplayName = "NiagaraComponentPool"),		// 엔진의 NiagaraComponent Pool(FNCPool)을 사용합니다.
+	EffectPoolingBackend_ComponentOnly				UMETA(DisplayName = "ComponentOnly")				// 이펙트마다 액터를 생성하지 않고 FXComponentPoolManager의 FXComponent를 사용합니다.
+};
+
+/**
+ * 이펙트 Spawn 요청의 Significance 평가 결과를 나타내는 열거형입니다.
+ */
+UENUM(BlueprintType)
+enum class EPREffectSignificance : uint8
+{
+	EffectSignificance_Spawn			UMETA(DisplayName = "Spawn"),			// 요청한 이펙트를 그대로 Spawn합니다.
+	EffectSignificance_Downgrade		UMETA(DisplayName = "Downgrade"),		// 데이터 테이블에 설정된 가벼운 이펙트로 대체하여 Spawn합니다.
+	EffectSignificance_Delay			UMETA(DisplayName = "Delay"),			// 화면에 들어올 때까지 Spawn을 지연합니다.
+	EffectSignificance_Cull				UMETA(DisplayName = "Cull")				// Spawn하지 않습니다.
+};
+
+/**
+ * 이펙트의 Spawn 예산을 초과했을 때의 처리 우선순위를 나타내는 열거형입니다.
+ */
+UENUM(BlueprintType)
+enum class EPREffectSpawnPriority : uint8
+{
+	EffectSpawnPriority_Low				UMETA(DisplayName = "Low"),				// 예산을 초과하면 Spawn하지 않습니다.
+	EffectSpawnPriority_Normal			UMETA(DisplayName = "Normal"),			// 예산을 초과하면 다음 프레임으로 미룹니다.
+	EffectSpawnPriority_High			UMETA(DisplayName = "High")				// 예산과 관계없이 Spawn합니다.
+};
+
+/**
+ * NiagaraSystem의 사용자 파라미터의 타입을 나타내는 열거형입니다.
+ */
+UENUM(BlueprintType)
+enum class EPRNiagaraParameterType : uint8
+{
+	NiagaraParameterType_Float					UMETA(DisplayName = "Float"),
+	NiagaraParameterType_Vector					UMETA(DisplayName = "Vector"),
+	NiagaraParameterType_LinearColor			UMETA(DisplayName = "LinearColor"),
+	NiagaraParameterType_StaticMesh				UMETA(DisplayName = "StaticMesh"),					// UStaticMesh 오브젝트 파라미터입니다.
+	NiagaraParameterType_StaticMeshComponent	UMETA(DisplayName = "StaticMeshComponent")			// StaticMesh DataInterface의 Source Component입니다.
+};
+
+/**
+ * 디버그 드로우의 카테고리를 나타내는 열거형입니다.
+ */
+UENUM(BlueprintType)
+enum class EPRDebugDrawCategory : uint8
+{
+	DebugDrawCategory_Pools				UMETA(DisplayName = "Pools"),			// 오브젝트 Pool의 동적 생성과 예측 확장을 표시합니다.
+	DebugDrawCategory_Effects			UMETA(DisplayName = "Effects"),			// 이펙트의 활성화 위치를 표시합니다.
+	DebugDrawCategory_Vault				UMETA(DisplayName = "Vault"),			// Vault의 Trace와 위치를 표시합니다.
+	DebugDrawCategory_Footsteps			UMETA(DisplayName = "Footsteps"),		// 발소리와 발자국의 Trace를 표시합니다.
+	DebugDrawCategory_Damage			UMETA(DisplayName = "Damage"),			// 공격의 Trace를 표시합니다.
+	DebugDrawCategory_MAX				UMETA(Hidden)
+};
+
+/**
+ * 지연하여 실행하는 AnimNotify 명령의 타입을 나타내는 열거형입니다.
+ * 명령은 이 순서대로 정렬하여 실행합니다.
+ */
+UENUM(BlueprintType)
+enum class EPRAnimNotifyCommandType : uint8
+{
+	AnimNotifyCommandType_RootLock		UMETA(DisplayName = "RootLock"),		// RootLock을 설정합니다.
+	AnimNotifyCommandType_Vault			UMETA(DisplayName = "Vault"),			// Vault 상태를 설정합니다.
+	AnimNotifyCommandType_Rotation		UMETA(DisplayName = "Rotation"),		// 액터의 회전 값을 설정합니다.
+	AnimNotifyCommandType_Effect		UMETA(DisplayName = "Effect"),			// 이펙트를 Spawn하거나 비활성화합니다.
+	AnimNotifyCommandType_Footstep		UMETA(DisplayName = "Footstep"),		// 발소리와 발자국을 요청합니다.
+	AnimNotifyCommandType_MAX			UMETA(Hidden)
+};
+
+/**
+ * 지연하여 실행하는 AnimNotify 명령의 단계를 나타내는 열거형입니다.
+ */
+UENUM(BlueprintType)
+enum class EPRAnimNotifyPhase : uint8
+{
+	AnimNotifyPhase_Notify				UMETA(DisplayName = "Notify"),			// AnimNotify의 Notify입니다.
+	AnimNotifyPhase_NotifyBegin			UMETA(DisplayName = "NotifyBegin"),		// AnimNotifyState의 NotifyBegin입니다.
+	AnimNotifyPhase_NotifyEnd			UMETA(DisplayName = "NotifyEnd")		// AnimNotifyState의 NotifyEnd입니다.
+};
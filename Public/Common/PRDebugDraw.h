@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Common/PRCommonEnum.h"
+
+/**
+ * 카테고리별 콘솔 변수(pr.Debug.*)로 제어하는 디버그 드로우를 정의한 파일입니다.
+ * Shipping과 Test 빌드에서는 모든 함수가 상수로 대체되고 PR_DEBUG_DRAW 매크로의 내용은 컴파일되지 않습니다.
+ * ex) PR_DEBUG_DRAW(EPRDebugDrawCategory::DebugDrawCategory_Vault, bVaultDebug,
+ *                   DrawDebugSphere(GetWorld(), Location, 10.0f, 12, FColor::Blue, false, 5.0f));
+ */
+
+/** 디버그 드로우를 컴파일하는지 나타내는 매크로입니다. */
+#define PR_ENABLE_DEBUG_DRAW (!(UE_BUILD_SHIPPING || UE_BUILD_TEST))
+
+namespace PRDebugDraw
+{
+#if PR_ENABLE_DEBUG_DRAW
+	/** 카테고리별 디버그 드로우의 활성화 여부입니다. pr.Debug.* 콘솔 변수와 연결됩니다. */
+	extern PROJECTREPLICA_API int32 GDebugDrawCategories[static_cast<int32>(EPRDebugDrawCategory::DebugDrawCategory_MAX)];
+
+	/**
+	 * 주어진 카테고리의 디버그 드로우가 활성화되었는지 확인하는 함수입니다.
+	 *
+	 * @param Category 확인할 카테고리입니다.
+	 * @param bLocalDebug 인스턴스별 디버그 설정입니다. true일 경우 콘솔 변수와 관계없이 활성화합니다.
+	 * @return 활성화되었을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool IsEnabled(EPRDebugDrawCategory Category, bool bLocalDebug = false)
+	{
+		return bLocalDebug || GDebugDrawCategories[static_cast<int32>(Category)] != 0;
+	}
+#else
+	FORCEINLINE constexpr bool IsEnabled(EPRDebugDrawCategory Category, bool bLocalDebug = false)
+	{
+		return false;
+	}
+#endif
+
+	/**
+	 * 주어진 카테고리의 Trace에 사용할 디버그 설정을 반환하는 함수입니다.
+	 *
+	 * @param Category 확인할 카테고리입니다.
+	 * @param bLocalDebug 인스턴스별 디버그 설정입니다.
+	 * @return 활성화되었을 경우 ForDuration을, 그렇지 않을 경우 None을 반환합니다.
+	 */
+	FORCEINLINE EDrawDebugTrace::Type GetDrawDebugTrace(EPRDebugDrawCategory Category, bool bLocalDebug = false)
+	{
+		return IsEnabled(Category, bLocalDebug) ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None;
+	}
+}
+
+/**
+ * 주어진 카테고리의 디버그 드로우가 활성화되었을 때만 내용을 실행하는 매크로입니다.
+ * Shipping과 Test 빌드에서는 내용을 컴파일하지 않으므로 인자의 계산 비용도 발생하지 않습니다.
+ */
+#if PR_ENABLE_DEBUG_DRAW
+#define PR_DEBUG_DRAW(Category, bLocalDebug, ...) do { if(PRDebugDraw::IsEnabled(Category, bLocalDebug)) { __VA_ARGS__; } } while(0)
+#else
+#define PR_DEBUG_DRAW(Category, bLocalDebug, ...) do {} while(0)
+#endif
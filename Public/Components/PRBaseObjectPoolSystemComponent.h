@@ -163,7 +163,12 @@ class PROJECTREPLICA_API UPRBaseObjectPoolSystemComponent : public UPRBaseActorC
 public:
 	UPRBaseObjectPoolSystemComponent();
 
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void DestroyComponent(bool bPromoteChildren) override;
 
 public:
@@ -274,6 +279,143 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem", meta = (ClampMin = "1"))
 	int32 DynamicPoolSize;
 
+#pragma region BakedPool
+protected:
+	/**
+	 * 레벨에 미리 배치된 Pool 오브젝트 중 주어진 키에 해당하는 액터를 하나 가져오는 함수입니다.
+	 * SpawnActor로 오브젝트를 생성하기 전에 호출합니다.
+	 *
+	 * @param PoolKey 액터를 가져올 Pool의 키입니다.
+	 * @return 미리 배치된 액터가 있을 경우 액터를 반환합니다. 그렇지 않을 경우 nullptr을 반환합니다.
+	 */
+	AActor* ClaimBakedPoolActor(UObject* PoolKey) const;
+
+	/**
+	 * Pool이 생성된 후 스트리밍된 레벨의 미리 배치된 Pool 오브젝트를 Pool에 추가하는 함수입니다.
+	 * 자식 클래스에서 오버라이딩하여 사용합니다.
+	 */
+	virtual void AdoptBakedPoolActors();
+
+private:
+	/** 미리 배치된 Pool 오브젝트가 등록될 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle BakedPoolActorsRegisteredHandle;
+#pragma endregion
+
+#pragma region PredictiveGrowth
+public:
+	/**
+	 * 주어진 Pool의 수요 통계를 반환하는 함수입니다.
+	 *
+	 * @param PoolKey 수요 통계를 찾을 Pool의 키입니다.
+	 * @return Pool의 수요 통계가 있을 경우 수요 통계를 반환합니다. 그렇지 않을 경우 기본 값을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRBaseObjectPoolSystem|PredictiveGrowth")
+	FPRPoolDemandStats GetPoolDemandStats(UObject* PoolKey) const;
+
+protected:
+	/**
+	 * Pool에서 오브젝트를 획득한 것을 기록하는 함수입니다.
+	 *
+	 * @param PoolKey 오브젝트를 획득한 Pool의 키입니다.
+	 * @param AcquiredObject 획득한 오브젝트입니다.
+	 * @param bDynamicSpawned Pool이 고갈되어 획득 시점에 오브젝트를 동적으로 생성했는지 여부입니다.
+	 */
+	void RecordPoolAcquire(UObject* PoolKey, UObject* AcquiredObject, bool bDynamicSpawned);
+
+#if PR_ENABLE_DEBUG_DRAW
+	/**
+	 * Pool에서 오브젝트를 획득한 결과를 디버그로 표시하는 함수입니다. pr.Debug.Pools 콘솔 변수가 활성화되었을 때만 호출합니다.
+	 *
+	 * @param PoolKey 오브젝트를 획득한 Pool의 키입니다.
+	 * @param Color 표시할 색입니다.
+	 */
+	void DrawPoolAcquireDebug(UObject* PoolKey, const FColor& Color) const;
+#endif
+
+	/**
+	 * 예측 확장으로 생성한 오브젝트를 목록에서 제거하는 함수입니다.
+	 * 동적으로 생성한 오브젝트를 제거할 때 호출합니다.
+	 *
+	 * @param PooledObject 제거할 오브젝트입니다.
+	 */
+	void RemovePredictivelyGrownObject(UObject* PooledObject);
+
+	/** 모든 Pool의 수요 통계와 예측 확장으로 생성한 오브젝트의 목록을 초기화하는 함수입니다. */
+	void ClearPoolDemandStats();
+
+	/**
+	 * 주어진 Pool의 크기를 반환하는 함수입니다.
+	 * 자식 클래스에서 오버라이딩하여 사용합니다.
+	 *
+	 * @param PoolKey 크기를 반환할 Pool의 키입니다.
+	 * @return Pool에 보관된 오브젝트의 수입니다.
+	 */
+	virtual int32 GetPoolCapacity(UObject* PoolKey) const;
+
+	/**
+	 * 주어진 Pool에서 활성화된 오브젝트의 수를 반환하는 함수입니다.
+	 * 자식 클래스에서 오버라이딩하여 사용합니다.
+	 *
+	 * @param PoolKey 활성화된 오브젝트의 수를 반환할 Pool의 키입니다.
+	 * @return Pool에서 활성화된 오브젝트의 수입니다.
+	 */
+	virtual int32 GetActivatePoolObjectCount(UObject* PoolKey) const;
+
+	/**
+	 * 주어진 Pool에 비활성화된 오브젝트를 하나 추가하는 함수입니다.
+	 * 자식 클래스에서 오버라이딩하여 사용합니다.
+	 *
+	 * @param PoolKey 확장할 Pool의 키입니다.
+	 * @return Pool에 추가한 오브젝트입니다.
+	 */
+	virtual UObject* GrowPool(UObject* PoolKey);
+
+private:
+	/**
+	 * 모든 Pool의 획득 빈도를 갱신하고 예측한 수요가 Pool의 크기에 가까우면 Pool을 미리 확장하는 함수입니다.
+	 *
+	 * @param DeltaTime 이전 갱신 이후 경과한 시간입니다.
+	 */
+	void UpdatePredictiveGrowth(float DeltaTime);
+
+protected:
+	/** 예측 확장의 사용 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth")
+	bool bEnablePredictiveGrowth;
+
+	/** 획득 빈도의 지수 가중 이동 평균에 새로운 측정 값을 반영하는 비율입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float AcquireRateSmoothingFactor;
+
+	/** 수요를 예측할 시간입니다. 현재 활성화된 수에 획득 빈도와 이 시간을 곱한 값을 더하여 수요를 예측합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "0.0"))
+	float DemandLookaheadTime;
+
+	/** 예측한 수요가 Pool 크기의 이 비율 이상일 경우 Pool을 확장합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float GrowthThresholdRatio;
+
+	/** 한 번의 갱신에서 예측 확장으로 생성할 수 있는 최대 오브젝트의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "1"))
+	int32 MaxPredictiveGrowthPerUpdate;
+
+	/** 예측 확장으로 늘릴 수 있는 Pool의 최대 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "1"))
+	int32 MaxPredictivePoolSize;
+
+	/** 목표 프레임 예산입니다. 이전 프레임의 게임 스레드 작업 시간이 이 값보다 작거나 같은 여유가 있는 프레임에서만 예측 확장을 실행합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRBaseObjectPoolSystem|PredictiveGrowth", meta = (ClampMin = "0.0", Units = "s"))
+	float IdleFrameTimeThreshold;
+
+	/** Pool별 수요 통계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRBaseObjectPoolSystem|PredictiveGrowth")
+	TMap<TObjectPtr<UObject>, FPRPoolDemandStats> PoolDemandStats;
+
+	/** 예측 확장으로 생성한 후 아직 획득되지 않은 오브젝트의 목록입니다. */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<UObject>> PredictivelyGrownObjects;
+#pragma endregion
+
 #pragma region Template
 protected:
 	/**
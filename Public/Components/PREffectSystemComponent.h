@@ -8,53 +8,81 @@
 #include "Particles/ParticleSystem.h"
 #include "Effects/PRNiagaraEffect.h"
 #include "Effects/PRParticleEffect.h"
+#include "Effects/PRNiagaraParameterBlock.h"
+#include "PerPlatformProperties.h"
 #include "PREffectSystemComponent.generated.h"
 
+class UNiagaraComponent;
+class UParticleSystemComponent;
+class APRFXComponentPoolManager;
+class APRCompositeEffect;
+class UPREffectPresetDataAsset;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEffectSpawnRequestResolved, int32, RequestId, UFXSystemComponent*, EffectComponent);
 
 #pragma region Structs
 /**
- * NiagaraEffect를 보관하는 Pool을 나타내는 구조체입니다.
+ * NiagaraEffect 또는 ParticleEffect를 보관하는 Pool을 나타내는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRNiagaraEffectPool
+struct FPREffectPool
 {
 	GENERATED_BODY()
 
 public:
-	FPRNiagaraEffectPool()
+	FPREffectPool()
 		: PooledEffects()
 	{}
 
-	FPRNiagaraEffectPool(const TArray<TObjectPtr<APRNiagaraEffect>>& NewPooledEffects)
+	FPREffectPool(const TArray<TObjectPtr<APREffect>>& NewPooledEffects)
 		: PooledEffects(NewPooledEffects)
 	{}
 
 public:
-	/** Pool에 보관된 NiagaraEffect들의 Array입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraSystemPool")
-	TArray<TObjectPtr<APRNiagaraEffect>> PooledEffects;
+	/** Pool에 보관된 이펙트들의 Array입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectPool")
+	TArray<TObjectPtr<APREffect>> PooledEffects;
 };
 
 /**
- * 여러 NiagaraEffect Pool을 보관하는 구조체입니다.
+ * NiagaraSystem과 ParticleSystem별로 이펙트 Pool을 보관하는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRNiagaraEffectObjectPool
+struct FPREffectObjectPool
 {
 	GENERATED_BODY()
 
 public:
-	FPRNiagaraEffectObjectPool()
+	FPREffectObjectPool()
 		: Pool()
 	{}
 
-	FPRNiagaraEffectObjectPool(const TMap<TObjectPtr<UNiagaraSystem>, FPRNiagaraEffectPool>& NewPool)
+	FPREffectObjectPool(const TMap<TObjectPtr<UFXSystemAsset>, FPREffectPool>& NewPool)
 		: Pool(NewPool)
 	{}
 
 public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectObjectPool")
-	TMap<TObjectPtr<UNiagaraSystem>, FPRNiagaraEffectPool> Pool;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectObjectPool")
+	TMap<TObjectPtr<UFXSystemAsset>, FPREffectPool> Pool;
+};
+
+/**
+ * 하나의 이펙트 프리셋으로 초기화한 CompositeEffect를 보관하는 Pool을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRCompositeEffectPool
+{
+	GENERATED_BODY()
+
+public:
+	FPRCompositeEffectPool()
+		: PooledEffects()
+	{}
+
+public:
+	/** Pool에 보관된 CompositeEffect들의 Array입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRCompositeEffectPool")
+	TArray<TObjectPtr<APRCompositeEffect>> PooledEffects;
 };
 
 /**
@@ -70,12 +98,18 @@ public:
 		: NiagaraSystem(nullptr)
 		, PoolSize(0)
 		, EffectLifespan(0.0f)
+		, DowngradeNiagaraSystem(nullptr)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
 	{}
 
-	FPRNiagaraEffectPoolSettings(TObjectPtr<UNiagaraSystem> NewNiagaraSystem, int32 NewPoolSize, float NewEffectLifespan)
+	FPRNiagaraEffectPoolSettings(TObjectPtr<UNiagaraSystem> NewNiagaraSystem, int32 NewPoolSize, float NewEffectLifespan, TObjectPtr<UNiagaraSystem> NewDowngradeNiagaraSystem = nullptr)
 		: NiagaraSystem(NewNiagaraSystem)
 		, PoolSize(NewPoolSize)
 		, EffectLifespan(NewEffectLifespan)
+		, DowngradeNiagaraSystem(NewDowngradeNiagaraSystem)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
 	{}
 
 public:
@@ -91,6 +125,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings")
 	float EffectLifespan;
 
+	/** Significance 평가에서 Downgrade로 판정되었을 때 대신 Spawn할 가벼운 NiagaraSystem입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings")
+	TObjectPtr<UNiagaraSystem> DowngradeNiagaraSystem;
+
+	/** 프레임당 Spawn 예산을 초과했을 때의 처리 우선순위입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings")
+	EPREffectSpawnPriority SpawnPriority;
+
+	/** 프레임당 Spawn할 수 있는 최대 수입니다. 0일 경우 EffectSystem의 기본 값을 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraEffectPoolSettings", meta = (ClampMin = "0"))
+	int32 MaxSpawnsPerFrame;
+
 public:
 	/**
 	 * 주어진 NiagaraEffectPoolSettings와 같은지 확인하는 ==연산자 오버로딩입니다.
@@ -102,7 +148,10 @@ public:
 	{
 		return this->NiagaraSystem == TargetNiagaraEffectPoolSettings.NiagaraSystem
 				&& this->PoolSize == TargetNiagaraEffectPoolSettings.PoolSize
-				&& this->EffectLifespan == TargetNiagaraEffectPoolSettings.EffectLifespan;
+				&& this->EffectLifespan == TargetNiagaraEffectPoolSettings.EffectLifespan
+				&& this->DowngradeNiagaraSystem == TargetNiagaraEffectPoolSettings.DowngradeNiagaraSystem
+				&& this->SpawnPriority == TargetNiagaraEffectPoolSettings.SpawnPriority
+				&& this->MaxSpawnsPerFrame == TargetNiagaraEffectPoolSettings.MaxSpawnsPerFrame;
 	}
 
 	/**
@@ -115,273 +164,236 @@ public:
 	{
 		return this->NiagaraSystem != TargetNiagaraEffectPoolSettings.NiagaraSystem
 				|| this->PoolSize != TargetNiagaraEffectPoolSettings.PoolSize
-				|| this->EffectLifespan != TargetNiagaraEffectPoolSettings.EffectLifespan;
+				|| this->EffectLifespan != TargetNiagaraEffectPoolSettings.EffectLifespan
+				|| this->DowngradeNiagaraSystem != TargetNiagaraEffectPoolSettings.DowngradeNiagaraSystem
+				|| this->SpawnPriority != TargetNiagaraEffectPoolSettings.SpawnPriority
+				|| this->MaxSpawnsPerFrame != TargetNiagaraEffectPoolSettings.MaxSpawnsPerFrame;
 	}
 };
 
 /**
- * NiagaraSystem별로 활성화된 NiagaraEffect들의 Index를 보관하는 구조체입니다.
+ * ParticleEffectPool의 설정 값을 나타내는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRActivateNiagaraEffectIndexList
+struct FPRParticleEffectPoolSettings : public FTableRowBase
 {
 	GENERATED_BODY()
 
 public:
-	FPRActivateNiagaraEffectIndexList()
-		: List()
+	FPRParticleEffectPoolSettings()
+		: ParticleSystem(nullptr)
+		, PoolSize(0)
+		, EffectLifespan(0.0f)
+		, DowngradeParticleSystem(nullptr)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
 	{}
 
-	FPRActivateNiagaraEffectIndexList(const TMap<TObjectPtr<UNiagaraSystem>, FPRActivateIndexList>& NewList)
-		: List(NewList)
+	FPRParticleEffectPoolSettings(TObjectPtr<UParticleSystem> NewParticleSystem, int32 NewPoolSize, float NewEffectLifespan, TObjectPtr<UParticleSystem> NewDowngradeParticleSystem = nullptr)
+		: ParticleSystem(NewParticleSystem)
+		, PoolSize(NewPoolSize)
+		, EffectLifespan(NewEffectLifespan)
+		, DowngradeParticleSystem(NewDowngradeParticleSystem)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
 	{}
 
 public:
-	/** NiagaraSystem과 활성화된 Index를 보관하는 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRActivateNiagaraEffectIndexList")
-	TMap<TObjectPtr<UNiagaraSystem>, FPRActivateIndexList> List;
-
-public:
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 Indexes를 반환하는 함수입니다.
-	 *
-	 * @param NiagaraSystemToFind Indexes를 찾을 NiagaraSystem입니다.
-	 * @return Indexes를 찾을 경우 Indexes를 반환합니다. 못찾았을 경우 nullptr을 반환합니다.
-	 */
-	TSet<int32>* GetIndexesForNiagaraSystem(const UNiagaraSystem& NiagaraSystemToFind)
-	{
-		if(!IsValid(&NiagaraSystemToFind))
-		{
-			return nullptr;
-		}
-
-		FPRActivateIndexList* ActivateIndexList = List.Find(NiagaraSystemToFind);
-		if(ActivateIndexList)
-		{
-			return &ActivateIndexList->Indexes;
-		}
-		
-		return nullptr;
-	}
-};
-
-/**
- * NiagaraSystem별로 사용된 NiagaraEffect들의 Index를 보관하는 구조체입니다.
- */
-USTRUCT(Atomic, BlueprintType)
-struct FPRUsedNiagaraEffectIndexList
-{
-	GENERATED_BODY()
-
-public:
-	FPRUsedNiagaraEffectIndexList()
-		: List()
-	{}
+	/** Pool에 넣을 ParticleSystem입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	TObjectPtr<UParticleSystem> ParticleSystem;
 
-	FPRUsedNiagaraEffectIndexList(const TMap<TObjectPtr<UNiagaraSystem>, FPRUsedIndexList>& NewList)
-		: List(NewList)
-	{}
+	/** Pool의 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	int32 PoolSize;
 
-public:
-	/** NiagaraSystem과 해당 NiagaraSystem의 이전에 사용된 Index를 보관하는 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRUsedNiagaraEffectIndexList")
-	TMap<TObjectPtr<UNiagaraSystem>, FPRUsedIndexList> List;
-};
+	/** 이펙트의 수명입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	float EffectLifespan;
 
-/**
- * 동적으로 생성한 NiagaraEffect 목록을 NiagaraSystem별로 보관하는 구조체입니다.
- */
-USTRUCT(Atomic, BlueprintType)
-struct FPRDynamicDestroyNiagaraEffectList
-{
-	GENERATED_BODY()
+	/** Significance 평가에서 Downgrade로 판정되었을 때 대신 Spawn할 가벼운 ParticleSystem입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	TObjectPtr<UParticleSystem> DowngradeParticleSystem;
 
-public:
-	FPRDynamicDestroyNiagaraEffectList()
-		: List()
-	{}
+	/** 프레임당 Spawn 예산을 초과했을 때의 처리 우선순위입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	EPREffectSpawnPriority SpawnPriority;
 
-	FPRDynamicDestroyNiagaraEffectList(const TMap<TObjectPtr<UNiagaraSystem>, FPRDynamicDestroyObject>& NewList)
-		: List(NewList)
-	{}
-	
-public:
-	/** NiagaraSystem과 동적으로 생성한 NiagaraEffect와 해당 NiagaraEffect를 제거하는 TimerHandle을 보관한 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRDynamicDestroyNiagaraEffectList")
-	TMap<TObjectPtr<UNiagaraSystem>, FPRDynamicDestroyObject> List;
+	/** 프레임당 Spawn할 수 있는 최대 수입니다. 0일 경우 EffectSystem의 기본 값을 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings", meta = (ClampMin = "0"))
+	int32 MaxSpawnsPerFrame;
 
 public:
 	/**
-	 * 주어진 NiagaraEffect에 해당하는 TimerHandle을 반환하는 함수입니다.
-	 *
-	 * @param NiagaraEffectToFind TimerHandle을 찾을 NiagaraEffect입니다.
-	 * @return TimerHandle을 찾았을 경우 TimerHandle을 반환합니다. 못 찾았을 경우 nullptr을 반환합니다.
+	 * 주어진 ParticleEffectPoolSettings와 같은지 확인하는 ==연산자 오버로딩입니다.
+	 * 
+	 * @param TargetParticleEffectPoolSettings 비교하는 ParticleEffectPoolSettings와 같은지 확인할 ParticleEffectPoolSettings입니다.
+	 * @return 주어진 ParticleEffectPoolSettings와 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
 	 */
-	FTimerHandle* FindTimerHandleForNiagaraEffect(APRNiagaraEffect& NiagaraEffectToFind)
+	FORCEINLINE bool operator==(const FPRParticleEffectPoolSettings& TargetParticleEffectPoolSettings) const
 	{
-		if(!IsValid(&NiagaraEffectToFind))
-		{
-			return nullptr;
-		}
-
-		FPRDynamicDestroyObject* DestroyObjects = List.Find(NiagaraEffectToFind.GetNiagaraEffectAsset());
-		if(DestroyObjects)
-		{
-			FTimerHandle* FoundTimerHandle = DestroyObjects->TimerHandles.Find(NiagaraEffectToFind);
-			if(FoundTimerHandle)
-			{
-				return FoundTimerHandle;
-			}
-		}
-
-		return nullptr;
+		return this->ParticleSystem == TargetParticleEffectPoolSettings.ParticleSystem
+				&& this->PoolSize == TargetParticleEffectPoolSettings.PoolSize
+				&& this->EffectLifespan == TargetParticleEffectPoolSettings.EffectLifespan
+				&& this->DowngradeParticleSystem == TargetParticleEffectPoolSettings.DowngradeParticleSystem
+				&& this->SpawnPriority == TargetParticleEffectPoolSettings.SpawnPriority
+				&& this->MaxSpawnsPerFrame == TargetParticleEffectPoolSettings.MaxSpawnsPerFrame;
 	}
-};
-
-/**
- * ParticleEffect를 보관하는 Pool을 나타내는 구조체입니다.
- */
-USTRUCT(Atomic, BlueprintType)
-struct FPRParticleEffectPool
-{
-	GENERATED_BODY()
-
-public:
-	FPRParticleEffectPool()
-		: PooledEffects()
-	{}
-
-	FPRParticleEffectPool(const TArray<TObjectPtr<APRParticleEffect>>& NewPooledEffects)
-		: PooledEffects(NewPooledEffects)
-	{}
-
-public:
-	/** Pool에 보관된 ParticleEffect들의 Array입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleSystemPool")
-	TArray<TObjectPtr<APRParticleEffect>> PooledEffects;
-};
-
-/**
- * 여러 ParticleEffect Pool을 보관하는 구조체입니다.
- */
-USTRUCT(Atomic, BlueprintType)
-struct FPRParticleEffectObjectPool
-{
-	GENERATED_BODY()
-
-public:
-	FPRParticleEffectObjectPool()
-		: Pool()
-	{}
-
-	FPRParticleEffectObjectPool(const TMap<TObjectPtr<UParticleSystem>, FPRParticleEffectPool>& NewPool)
-		: Pool(NewPool)
-	{}
 
-public:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectObjectPool")
-	TMap<TObjectPtr<UParticleSystem>, FPRParticleEffectPool> Pool;
+	/**
+	 * 주어진 ParticleEffectPoolSettings와 같지 않은지 확인하는 !=연산자 오버로딩입니다.
+	 * 
+	 * @param TargetParticleEffectPoolSettings 비교하는 ParticleEffectPoolSettings와 같지 않은지 확인할 ParticleEffectPoolSettings입니다.
+	 * @return 주어진 ParticleEffectPoolSettings와 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator!=(const FPRParticleEffectPoolSettings& TargetParticleEffectPoolSettings) const
+	{
+		return this->ParticleSystem != TargetParticleEffectPoolSettings.ParticleSystem
+				|| this->PoolSize != TargetParticleEffectPoolSettings.PoolSize
+				|| this->EffectLifespan != TargetParticleEffectPoolSettings.EffectLifespan
+				|| this->DowngradeParticleSystem != TargetParticleEffectPoolSettings.DowngradeParticleSystem
+				|| this->SpawnPriority != TargetParticleEffectPoolSettings.SpawnPriority
+				|| this->MaxSpawnsPerFrame != TargetParticleEffectPoolSettings.MaxSpawnsPerFrame;
+	}
 };
 
 /**
- * ParticleEffectPool의 설정 값을 나타내는 구조체입니다.
+ * NiagaraEffectPoolSettings와 ParticleEffectPoolSettings를 이펙트의 종류와 관계없이 나타내는 구조체입니다.
+ * EffectSystem은 두 데이터 테이블의 설정 값을 이 구조체로 바꾸어 하나의 Map에 보관합니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRParticleEffectPoolSettings : public FTableRowBase
+struct FPREffectPoolSettings
 {
 	GENERATED_BODY()
 
 public:
-	FPRParticleEffectPoolSettings()
-		: ParticleSystem(nullptr)
+	FPREffectPoolSettings()
+		: EffectAsset(nullptr)
 		, PoolSize(0)
 		, EffectLifespan(0.0f)
+		, DowngradeEffectAsset(nullptr)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
 	{}
 
-	FPRParticleEffectPoolSettings(TObjectPtr<UParticleSystem> NewParticleSystem, int32 NewPoolSize, float NewEffectLifespan)
-		: ParticleSystem(NewParticleSystem)
+	FPREffectPoolSettings(TObjectPtr<UFXSystemAsset> NewEffectAsset, int32 NewPoolSize, float NewEffectLifespan)
+		: EffectAsset(NewEffectAsset)
 		, PoolSize(NewPoolSize)
 		, EffectLifespan(NewEffectLifespan)
+		, DowngradeEffectAsset(nullptr)
+		, SpawnPriority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, MaxSpawnsPerFrame(0)
+	{}
+
+	FPREffectPoolSettings(const FPRNiagaraEffectPoolSettings& NiagaraEffectPoolSettings)
+		: EffectAsset(NiagaraEffectPoolSettings.NiagaraSystem)
+		, PoolSize(NiagaraEffectPoolSettings.PoolSize)
+		, EffectLifespan(NiagaraEffectPoolSettings.EffectLifespan)
+		, DowngradeEffectAsset(NiagaraEffectPoolSettings.DowngradeNiagaraSystem)
+		, SpawnPriority(NiagaraEffectPoolSettings.SpawnPriority)
+		, MaxSpawnsPerFrame(NiagaraEffectPoolSettings.MaxSpawnsPerFrame)
+	{}
+
+	FPREffectPoolSettings(const FPRParticleEffectPoolSettings& ParticleEffectPoolSettings)
+		: EffectAsset(ParticleEffectPoolSettings.ParticleSystem)
+		, PoolSize(ParticleEffectPoolSettings.PoolSize)
+		, EffectLifespan(ParticleEffectPoolSettings.EffectLifespan)
+		, DowngradeEffectAsset(ParticleEffectPoolSettings.DowngradeParticleSystem)
+		, SpawnPriority(ParticleEffectPoolSettings.SpawnPriority)
+		, MaxSpawnsPerFrame(ParticleEffectPoolSettings.MaxSpawnsPerFrame)
 	{}
 
 public:
-	/** Pool에 넣을 ParticleSystem입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
-	TObjectPtr<UParticleSystem> ParticleSystem;
+	/** Pool에 넣을 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
+	TObjectPtr<UFXSystemAsset> EffectAsset;
 
 	/** Pool의 크기입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
 	int32 PoolSize;
 
 	/** 이펙트의 수명입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRParticleEffectPoolSettings")
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
 	float EffectLifespan;
 
+	/** Significance 평가에서 Downgrade로 판정되었을 때 대신 Spawn할 가벼운 이펙트입니다. EffectAsset과 같은 종류입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
+	TObjectPtr<UFXSystemAsset> DowngradeEffectAsset;
+
+	/** 프레임당 Spawn 예산을 초과했을 때의 처리 우선순위입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
+	EPREffectSpawnPriority SpawnPriority;
+
+	/** 프레임당 Spawn할 수 있는 최대 수입니다. 0일 경우 EffectSystem의 기본 값을 사용합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectPoolSettings")
+	int32 MaxSpawnsPerFrame;
+
 public:
 	/**
-	 * 주어진 ParticleEffectPoolSettings와 같은지 확인하는 ==연산자 오버로딩입니다.
+	 * 주어진 EffectPoolSettings와 같은지 확인하는 ==연산자 오버로딩입니다.
 	 * 
-	 * @param TargetParticleEffectPoolSettings 비교하는 ParticleEffectPoolSettings와 같은지 확인할 ParticleEffectPoolSettings입니다.
-	 * @return 주어진 ParticleEffectPoolSettings와 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 * @param TargetEffectPoolSettings 비교하는 EffectPoolSettings와 같은지 확인할 EffectPoolSettings입니다.
+	 * @return 주어진 EffectPoolSettings와 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
 	 */
-	FORCEINLINE bool operator==(const FPRParticleEffectPoolSettings& TargetParticleEffectPoolSettings) const
+	FORCEINLINE bool operator==(const FPREffectPoolSettings& TargetEffectPoolSettings) const
 	{
-		return this->ParticleSystem == TargetParticleEffectPoolSettings.ParticleSystem
-				&& this->PoolSize == TargetParticleEffectPoolSettings.PoolSize
-				&& this->EffectLifespan == TargetParticleEffectPoolSettings.EffectLifespan;
+		return this->EffectAsset == TargetEffectPoolSettings.EffectAsset
+				&& this->PoolSize == TargetEffectPoolSettings.PoolSize
+				&& this->EffectLifespan == TargetEffectPoolSettings.EffectLifespan
+				&& this->DowngradeEffectAsset == TargetEffectPoolSettings.DowngradeEffectAsset
+				&& this->SpawnPriority == TargetEffectPoolSettings.SpawnPriority
+				&& this->MaxSpawnsPerFrame == TargetEffectPoolSettings.MaxSpawnsPerFrame;
 	}
 
 	/**
-	 * 주어진 ParticleEffectPoolSettings와 같지 않은지 확인하는 !=연산자 오버로딩입니다.
+	 * 주어진 EffectPoolSettings와 같지 않은지 확인하는 !=연산자 오버로딩입니다.
 	 * 
-	 * @param TargetParticleEffectPoolSettings 비교하는 ParticleEffectPoolSettings와 같지 않은지 확인할 ParticleEffectPoolSettings입니다.
-	 * @return 주어진 ParticleEffectPoolSettings와 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 * @param TargetEffectPoolSettings 비교하는 EffectPoolSettings와 같지 않은지 확인할 EffectPoolSettings입니다.
+	 * @return 주어진 EffectPoolSettings와 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
 	 */
-	FORCEINLINE bool operator!=(const FPRParticleEffectPoolSettings& TargetParticleEffectPoolSettings) const
+	FORCEINLINE bool operator!=(const FPREffectPoolSettings& TargetEffectPoolSettings) const
 	{
-		return this->ParticleSystem != TargetParticleEffectPoolSettings.ParticleSystem
-				|| this->PoolSize != TargetParticleEffectPoolSettings.PoolSize
-				|| this->EffectLifespan != TargetParticleEffectPoolSettings.EffectLifespan;
+		return !(*this == TargetEffectPoolSettings);
 	}
 };
 
 /**
- * ParticleSystem별로 활성화된 ParticleEffect들의 Index를 보관하는 구조체입니다.
+ * NiagaraSystem과 ParticleSystem별로 활성화된 이펙트들의 Index를 보관하는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRActivateParticleEffectIndexList
+struct FPRActivateEffectIndexList
 {
 	GENERATED_BODY()
 
 public:
-	FPRActivateParticleEffectIndexList()
+	FPRActivateEffectIndexList()
 		: List()
 	{}
 
-	FPRActivateParticleEffectIndexList(const TMap<TObjectPtr<UParticleSystem>, FPRActivateIndexList>& NewList)
+	FPRActivateEffectIndexList(const TMap<TObjectPtr<UFXSystemAsset>, FPRActivateIndexList>& NewList)
 		: List(NewList)
 	{}
 
 public:
-	/** ParticleSystem과 활성화된 Index를 보관하는 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRActivateParticleEffectIndexList")
-	TMap<TObjectPtr<UParticleSystem>, FPRActivateIndexList> List;
+	/** NiagaraSystem 또는 ParticleSystem과 활성화된 Index를 보관하는 Map입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRActivateEffectIndexList")
+	TMap<TObjectPtr<UFXSystemAsset>, FPRActivateIndexList> List;
 
 public:
 	/**
-	 * 주어진 ParticleSystem에 해당하는 Indexes를 반환하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 Indexes를 반환하는 함수입니다.
 	 *
-	 * @param ParticleSystemToFind Indexes를 찾을 ParticleSystem입니다.
+	 * @param EffectAssetToFind Indexes를 찾을 NiagaraSystem 또는 ParticleSystem입니다.
 	 * @return Indexes를 찾을 경우 Indexes를 반환합니다. 못찾았을 경우 nullptr을 반환합니다.
 	 */
-	TSet<int32>* GetIndexesForParticleSystem(const UParticleSystem& ParticleSystemToFind)
+	TSet<int32>* GetIndexesForEffectAsset(const UFXSystemAsset& EffectAssetToFind)
 	{
-		if(!IsValid(&ParticleSystemToFind))
+		if(!IsValid(&EffectAssetToFind))
 		{
 			return nullptr;
 		}
 
-		FPRActivateIndexList* ActivateIndexList = List.Find(ParticleSystemToFind);
+		FPRActivateIndexList* ActivateIndexList = List.Find(EffectAssetToFind);
 		if(ActivateIndexList)
 		{
 			return &ActivateIndexList->Indexes;
@@ -392,542 +404,1540 @@ public:
 };
 
 /**
- * ParticleSystem별로 사용된 ParticleEffect들의 Index를 보관하는 구조체입니다.
+ * NiagaraSystem과 ParticleSystem별로 사용된 이펙트들의 Index를 보관하는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRUsedParticleEffectIndexList
+struct FPRUsedEffectIndexList
 {
 	GENERATED_BODY()
 
 public:
-	FPRUsedParticleEffectIndexList()
+	FPRUsedEffectIndexList()
 		: List()
 	{}
 
-	FPRUsedParticleEffectIndexList(const TMap<TObjectPtr<UParticleSystem>, FPRUsedIndexList>& NewList)
+	FPRUsedEffectIndexList(const TMap<TObjectPtr<UFXSystemAsset>, FPRUsedIndexList>& NewList)
 		: List(NewList)
 	{}
 
 public:
-	/** ParticleSystem과 해당 ParticleSystem의 이전에 사용된 Index를 보관하는 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRUsedParticleEffectIndexList")
-	TMap<TObjectPtr<UParticleSystem>, FPRUsedIndexList> List;
+	/** NiagaraSystem 또는 ParticleSystem과 이전에 사용된 Index를 보관하는 Map입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRUsedEffectIndexList")
+	TMap<TObjectPtr<UFXSystemAsset>, FPRUsedIndexList> List;
 };
 
 /**
- * 동적으로 생성한 ParticleEffect 목록을 ParticleSystem별로 보관하는 구조체입니다.
+ * 동적으로 생성한 이펙트 목록을 NiagaraSystem과 ParticleSystem별로 보관하는 구조체입니다.
  */
 USTRUCT(Atomic, BlueprintType)
-struct FPRDynamicDestroyParticleEffectList
+struct FPRDynamicDestroyEffectList
 {
 	GENERATED_BODY()
 
 public:
-	FPRDynamicDestroyParticleEffectList()
+	FPRDynamicDestroyEffectList()
 		: List()
 	{}
 
-	FPRDynamicDestroyParticleEffectList(const TMap<TObjectPtr<UParticleSystem>, FPRDynamicDestroyObject>& NewList)
+	FPRDynamicDestroyEffectList(const TMap<TObjectPtr<UFXSystemAsset>, FPRDynamicDestroyObject>& NewList)
 		: List(NewList)
 	{}
 	
 public:
-	/** ParticleSystem과 동적으로 생성한 ParticleEffect와 해당 ParticleEffect를 제거하는 TimerHandle을 보관한 Map입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRDynamicDestroyParticleEffectList")
-	TMap<TObjectPtr<UParticleSystem>, FPRDynamicDestroyObject> List;
+	/** NiagaraSystem 또는 ParticleSystem과 동적으로 생성한 이펙트와 해당 이펙트를 제거하는 TimerHandle을 보관한 Map입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRDynamicDestroyEffectList")
+	TMap<TObjectPtr<UFXSystemAsset>, FPRDynamicDestroyObject> List;
 
 public:
 	/**
-	 * 주어진 ParticleEffect에 해당하는 TimerHandle을 반환하는 함수입니다.
+	 * 주어진 이펙트에 해당하는 TimerHandle을 반환하는 함수입니다.
 	 *
-	 * @param ParticleEffectToFind TimerHandle을 찾을 ParticleEffect입니다.
+	 * @param EffectToFind TimerHandle을 찾을 이펙트입니다.
 	 * @return TimerHandle을 찾았을 경우 TimerHandle을 반환합니다. 못 찾았을 경우 nullptr을 반환합니다.
 	 */
-	FTimerHandle* FindTimerHandleForParticleEffect(const APRParticleEffect& ParticleEffectToFind)
+	FTimerHandle* FindTimerHandleForEffect(APREffect& EffectToFind)
 	{
-		if(!IsValid(&ParticleEffectToFind))
+		if(!IsValid(&EffectToFind))
 		{
 			return nullptr;
 		}
 
-		FPRDynamicDestroyObject* DestroyObjects = List.Find(ParticleEffectToFind.GetParticleEffectAsset());
+		FPRDynamicDestroyObject* DestroyObjects = List.Find(EffectToFind.GetEffectAsset());
 		if(DestroyObjects)
 		{
-			FTimerHandle* FoundTimerHandle = DestroyObjects->TimerHandles.Find(ParticleEffectToFind);
-			if(FoundTimerHandle)
-			{
-				return FoundTimerHandle;
-			}
+			return DestroyObjects->TimerHandles.Find(&EffectToFind);
 		}
 
 		return nullptr;
 	}
 };
-#pragma endregion
 
 /**
- * Owner가 사용하는 이펙트를 관리하는 ActorComponent 클래스입니다.
+ * 이펙트 Spawn 요청의 Significance를 평가하는 설정 값을 나타내는 구조체입니다.
+ * 거리 값은 플랫폼별로 다르게 설정할 수 있습니다.
  */
-UCLASS()
-class PROJECTREPLICA_API UPREffectSystemComponent : public UPRBaseObjectPoolSystemComponent
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectSignificanceSettings
 {
 	GENERATED_BODY()
 
 public:
-	UPREffectSystemComponent();
+	FPREffectSignificanceSettings()
+		: AlwaysSpawnDistance(500.0f)
+		, DowngradeDistance(2500.0f)
+		, CullDistance(6000.0f)
+		, ViewConeMarginAngle(15.0f)
+		, MaxDelayTime(0.5f)
+		, OwnerRecentlyRenderedTime(0.2f)
+	{}
 
-#pragma region PRBaseObjectPoolSystem
 public:
-	/** 기존의 ObjectPool을 제거하고, 새로 ObjectPool을 생성하여 초기화하는 함수입니다. */
-	virtual void InitializeObjectPool() override;
+	/** 시야와 관계없이 항상 Spawn하는 카메라와의 거리입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings")
+	FPerPlatformFloat AlwaysSpawnDistance;
 
-	/** 모든 ObjectPool을 제거하는 함수입니다. */
-	virtual void ClearAllObjectPool() override;
-#pragma endregion
+	/** 이 거리보다 멀리 있는 이펙트는 데이터 테이블에 설정된 가벼운 이펙트로 대체합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings")
+	FPerPlatformFloat DowngradeDistance;
 
-#pragma region NiagaraSystem
-public:
-	/** 기존의 NiagaraPool을 제거하고, 새로 NiagaraPool을 생성하여 초기화하는 함수입니다. */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	void InitializeNiagaraPool();
+	/** 이 거리보다 멀리 있는 이펙트는 Spawn하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings")
+	FPerPlatformFloat CullDistance;
 
-	/** 모든 NiagaraPool을 제거하는 함수입니다. */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	void ClearAllNiagaraPool();
+	/** 카메라 FOV의 절반에 더하여 시야 안으로 판정하는 여유 각도입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+	float ViewConeMarginAngle;
 
-	/**
-	 * NiagaraEffect를 지정한 위치에 Spawn하는 함수입니다.
-	 *
-	 * @param SpawnEffect Spawn할 NiagaraEffect
-	 * @param Location NiagaraEffect를 생성할 위치
-	 * @param Rotation NiagaraEffect에 적용한 회전 값
-	 * @param Scale NiagaraEffect에 적용할 크기
-	 * @param bEffectAutoActivate true일 경우 NiagaraEffect를 Spawn하자마다 NiagaraEffect를 실행합니다. false일 경우 NiagaraEffect를 실행하지 않습니다.
-	 * @param bReset 처음부터 다시 재생할지 여부
-	 * @return 지정한 위치에 Spawn한 NiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
-	
-	/**
-	 * NiagaraEffect를 지정한 Component에 부착하여 Spawn하는 함수입니다.
-	 *
-	 * @param SpawnEffect Spawn할 NiagaraEffect
-	 * @param Parent NiagaraEffect를 부착할 Component
-	 * @param AttachSocketName 부착할 소켓의 이름
-	 * @param Location NiagaraEffect를 생성할 위치
-	 * @param Rotation NiagaraEffect에 적용한 회전 값
-	 * @param Scale NiagaraEffect에 적용할 크기
-	 * @param bEffectAutoActivate true일 경우 NiagaraEffect를 Spawn하자마다 NiagaraEffect를 실행합니다. false일 경우 NiagaraEffect를 실행하지 않습니다.
-	 * @param bReset 처음부터 다시 재생할지 여부
-	 * @return 지정한 Component에 부착하여 Spawn한 NiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	/** 시야 밖의 이펙트가 시야에 들어오기를 기다리는 최대 시간입니다. 시간이 지나면 Spawn하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings", meta = (ClampMin = "0.0"))
+	float MaxDelayTime;
 
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 활성화할 수 있는 NiagaraEffect를 반환하는 함수입니다.
-	 *
-	 * @param NiagaraSystem 활성화할 수 있는 NiagaraEffect를 찾을 NiagaraSystem입니다.
-	 * @return 활성화할 수 있는 NiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* GetActivateableNiagaraEffect(UNiagaraSystem* NiagaraSystem);
-	
-	/**
-	 * 주어진 NiagaraEffect가 활성화되어 있는지 확인하는 함수입니다.
-	 * 
-	 * @param NiagaraEffect 확인할 NiagaraEffect입니다.
-	 * @return NiagaraEffect가 활성화되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다. 
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	bool IsActivateNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const;
+	/** 부착할 Component가 이 시간 동안 렌더링되지 않았을 경우 이펙트를 Spawn하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSignificanceSettings", meta = (ClampMin = "0.0"))
+	float OwnerRecentlyRenderedTime;
+};
 
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 NiagaraPool이 생성되어 있는지 확인하는 함수입니다.
-	 * 
-	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
-	 * @return NiagaraPool이 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	bool IsCreateNiagaraPool(UNiagaraSystem* NiagaraSystem) const;	
+/**
+ * 이펙트 Spawn 요청의 Significance 평가 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectSignificanceStats
+{
+	GENERATED_BODY()
 
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 ActivateNiagaraIndexList가 생성되어 있는지 확인하는 함수입니다.
-	 * 
-	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
-	 * @return ActivateNiagaraIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	bool IsCreateActivateNiagaraIndexList(UNiagaraSystem* NiagaraSystem) const;
+public:
+	FPREffectSignificanceStats()
+		: EvaluatedCount(0)
+		, SpawnedCount(0)
+		, DowngradedCount(0)
+		, DelayedCount(0)
+		, DelayedSpawnedCount(0)
+		, CulledCount(0)
+		, DelayExpiredCount(0)
+	{}
 
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 UsedNiagaraIndexList가 생성되어 있는지 확인하는 함수입니다.
-	 * 
-	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
-	 * @return UsedNiagaraIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	bool IsCreateUsedNiagaraIndexList(UNiagaraSystem* NiagaraSystem) const;
+public:
+	/** Significance를 평가한 Spawn 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 EvaluatedCount;
 
-	/**
-	 * 주어진 NiagaraEffect가 동적으로 생성되었는지 확인하는 함수입니다.
-	 * 
-	 * @param NiagaraEffect 확인할 NiagaraEffect입니다.
-	 * @return NiagaraEffect가 동적으로 생성되었으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraSystem")
-	bool IsDynamicNiagaraEffect(APRNiagaraEffect* NiagaraEffect) const;
+	/** 그대로 Spawn한 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 SpawnedCount;
 
-private:
-	/**
-	 * 주어진 NiagaraPool을 제거하는 함수입니다.
-	 * 
-	 * @param TargetNiagaraPool 제거할 NiagaraPool입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	void ClearNiagaraPool(FPRNiagaraEffectObjectPool& TargetNiagaraPool);
-	
-	/**
-	 * 주어진 NiagaraPool의 설정 값을 바탕으로 NiagaraPool을 생성하는 함수입니다.
-	 *
-	 * @param NiagaraPoolSettings NiagaraPool을 생성할 설정 값입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	void CreateNiagaraPool(const FPRNiagaraEffectPoolSettings& NiagaraPoolSettings);
+	/** 가벼운 이펙트로 대체하여 Spawn한 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 DowngradedCount;
 
-	/**
-	 * 주어진 NiagaraSystem의 ActivateNiagaraIndexList를 생성하는 함수입니다.
-	 *
-	 * @param NiagaraSystem ActivateNiagaraIndexList를 생성할 NiagaraSystem입니다. 
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	void CreateActivateNiagaraIndexList(UNiagaraSystem* NiagaraSystem);
+	/** Spawn을 지연한 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 DelayedCount;
 
-	/**
-	 * 주어진 NiagaraSystem의 UsedNiagaraIndexList를 생성하는 함수입니다.
-	 *
-	 * @param NiagaraSystem UsedNiagaraIndexList를 생성할 NiagaraSystem입니다. 
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	void CreateUsedNiagaraIndexList(UNiagaraSystem* NiagaraSystem);	
+	/** 지연한 후 시야에 들어와 Spawn한 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 DelayedSpawnedCount;
 
-	/**
-	 * 주어진 NiagaraSystem을 월드에 PRNiagaraEffect로 Spawn하는 함수입니다.
-	 *
-	 * @param NiagaraSystem 월드에 Spawn할 NiagaraSystem입니다.
-	 * @param PoolIndex 월드에 Spawn한 NiagaraSystem이 NiagaraPool에서 사용하는 Index 값입니다. 
-	 * @param Lifespan PRNiagaraEffect의 수명입니다.
-	 * @return 월드에 Spawn PRNiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	APRNiagaraEffect* SpawnNiagaraEffectInWorld(UNiagaraSystem* NiagaraSystem, int32 PoolIndex, float Lifespan);
+	/** Spawn하지 않은 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 CulledCount;
 
-	/**
-	 * 주어진 NiagaraSystem을 월드에 동적으로 Spawn하는 함수입니다.
-	 * 동적으로 Spawn한 NiagaraSystem은 비활성화된 후 일정시간이 지나면 제거됩니다.
-	 * 
-	 * @param NiagaraSystem 월드에 동적으로 Spawn할 NiagaraSystem입니다.
-	 * @return 월드에 동적으로 Spawn한 NiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	APRNiagaraEffect* SpawnDynamicNiagaraEffectInWorld(UNiagaraSystem* NiagaraSystem);	
+	/** 지연한 후 MaxDelayTime 안에 시야에 들어오지 않아 Spawn하지 않은 요청의 수입니다. CulledCount에 포함됩니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSignificanceStats")
+	int32 DelayExpiredCount;
+};
 
-	/**
-	 * 주어진 NiagaraSystem에 해당하는 NiagaraEffect를 초기화한 후 반환하는 함수입니다.
-	 * 
-	 * @param SpawnEffect 초기화할 NiagaraEffect의 NiagaraSystem입니다.
-	 * @return 초기화된 NiagaraEffect입니다.
-	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	APRNiagaraEffect* InitializeNiagaraEffect(UNiagaraSystem* SpawnEffect);
+/**
+ * 시야 밖에 있거나 Spawn 예산을 초과하여 지연한 이펙트 Spawn 요청을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDelayedEffectSpawnRequest
+{
+	GENERATED_BODY()
+
+public:
+	FPRDelayedEffectSpawnRequest()
+		: EffectAsset(nullptr)
+		, Location(FVector::ZeroVector)
+		, Rotation(FRotator::ZeroRotator)
+		, Scale(FVector(1.0f))
+		, bEffectAutoActivate(true)
+		, bReset(false)
+		, RemainingDelayTime(0.0f)
+		, Intensity(1.0f)
+		, Priority(EPREffectSpawnPriority::EffectSpawnPriority_Normal)
+		, RequestTime(0.0f)
+		, NiagaraParameters()
+		, RequestId(0)
+	{}
+
+public:
+	/** Spawn할 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	TObjectPtr<UFXSystemAsset> EffectAsset;
+
+	/** 이펙트를 Spawn할 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	FVector Location;
+
+	/** 이펙트에 적용할 회전 값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	FRotator Rotation;
+
+	/** 이펙트에 적용할 크기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	FVector Scale;
+
+	/** 이펙트를 Spawn하자마자 실행할지 여부입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	bool bEffectAutoActivate;
+
+	/** 처음부터 다시 재생할지 여부입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	bool bReset;
+
+	/** 시야에 들어오기를 기다리며 Spawn을 포기하기까지 남은 시간입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	float RemainingDelayTime;
+
+	/** 병합된 Spawn 요청의 수를 나타내는 이펙트의 세기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	float Intensity;
+
+	/** Spawn 예산을 초과했을 때의 처리 우선순위입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	EPREffectSpawnPriority Priority;
+
+	/** 요청이 Spawn 예산 대기 목록에 추가된 시간입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	float RequestTime;
+
+	/** Spawn한 NiagaraComponent를 활성화하기 전에 적용할 사용자 파라미터입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	FPRNiagaraParameterBlock NiagaraParameters;
+
+	/** 요청을 처리한 결과를 전달할 때 사용하는 요청의 번호입니다. 지연한 요청이 다시 미뤄져도 같은 번호를 유지합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDelayedEffectSpawnRequest")
+	int32 RequestId;
+};
+
+/**
+ * 이펙트의 프레임당 Spawn 예산과 병합의 설정 값을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectSpawnBudgetSettings
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectSpawnBudgetSettings()
+		: GlobalMaxSpawnsPerFrame(16)
+		, DefaultMaxSpawnsPerSystemPerFrame(4)
+		, CoalesceRadius(30.0f)
+		, CoalesceTimeWindow(0.05f)
+		, IntensityParameterName(TEXT("Intensity"))
+		, MaxQueuedTime(0.2f)
+		, MaxQueuedRequests(64)
+	{}
+
+public:
+	/** 모든 이펙트를 합쳐 프레임당 Spawn할 수 있는 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "1"))
+	int32 GlobalMaxSpawnsPerFrame;
+
+	/** 데이터 테이블에 설정되지 않은 이펙트가 프레임당 Spawn할 수 있는 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "1"))
+	int32 DefaultMaxSpawnsPerSystemPerFrame;
+
+	/** 같은 이펙트의 Spawn 요청을 하나로 병합하는 거리입니다. 0일 경우 병합하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "0.0"))
+	float CoalesceRadius;
+
+	/** 같은 이펙트의 Spawn 요청을 하나로 병합하는 시간입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "0.0"))
+	float CoalesceTimeWindow;
+
+	/** 병합된 Spawn 요청의 수를 전달하는 이펙트의 float 파라미터 이름입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings")
+	FName IntensityParameterName;
+
+	/** 예산을 초과하여 미룬 요청을 기다리는 최대 시간입니다. 시간이 지나면 Spawn하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "0.0"))
+	float MaxQueuedTime;
+
+	/** 예산을 초과하여 미룰 수 있는 요청의 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectSpawnBudgetSettings", meta = (ClampMin = "0"))
+	int32 MaxQueuedRequests;
+};
+
+/**
+ * 이펙트의 Spawn 예산과 병합의 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectSpawnBudgetStats
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectSpawnBudgetStats()
+		: CoalescedCount(0)
+		, QueuedCount(0)
+		, QueuedSpawnedCount(0)
+		, DroppedCount(0)
+	{}
+
+public:
+	/** 다른 Spawn 요청에 병합된 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnBudgetStats")
+	int32 CoalescedCount;
+
+	/** 예산을 초과하여 다음 프레임으로 미룬 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnBudgetStats")
+	int32 QueuedCount;
+
+	/** 미룬 후 Spawn한 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnBudgetStats")
+	int32 QueuedSpawnedCount;
 
+	/** 예산을 초과하여 Spawn하지 않은 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnBudgetStats")
+	int32 DroppedCount;
+};
+
+/**
+ * 이펙트의 Spawn 요청의 결과를 나타내는 구조체입니다.
+ * 바로 Spawn했을 경우 EffectComponent를, 시야 밖에 있거나 예산을 초과하여 지연했을 경우 RequestId를 가집니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectSpawnHandle
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectSpawnHandle()
+		: EffectComponent(nullptr)
+		, RequestId(0)
+	{}
+
+public:
+	/** 바로 Spawn한 이펙트의 FXSystemComponent입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnHandle")
+	TWeakObjectPtr<UFXSystemComponent> EffectComponent;
+
+	/** 지연한 Spawn 요청의 번호입니다. 지연하지 않았을 경우 0입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSpawnHandle")
+	int32 RequestId;
+};
+
+/**
+ * 이펙트 품질 단계별로 Pool의 크기와 Spawn 확률을 조정하는 설정 값을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectScalabilitySettings
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectScalabilitySettings()
+		: PoolSizeScale(1.0f)
+		, MaxPoolSize(32)
+		, SpawnProbability(1.0f)
+	{}
+
+	FPREffectScalabilitySettings(float NewPoolSizeScale, int32 NewMaxPoolSize, float NewSpawnProbability)
+		: PoolSizeScale(NewPoolSizeScale)
+		, MaxPoolSize(NewMaxPoolSize)
+		, SpawnProbability(NewSpawnProbability)
+	{}
+
+public:
+	/** 데이터 테이블의 PoolSize와 DynamicPoolSize에 곱하는 비율입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectScalabilitySettings", meta = (ClampMin = "0.0"))
+	float PoolSizeScale;
+
+	/** 이펙트 하나의 Pool이 가질 수 있는 최대 이펙트의 수입니다. Pool이 가득 차면 더 이상 동적으로 생성하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectScalabilitySettings", meta = (ClampMin = "1"))
+	int32 MaxPoolSize;
+
+	/** 위치에 Spawn하는 이펙트가 실제로 Spawn될 확률입니다. 우선순위가 High인 이펙트는 항상 Spawn합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PREffectScalabilitySettings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SpawnProbability;
+
+public:
 	/**
-	 * 주어진 동적으로 생성한 NiagaraEffect를 제거하는 함수입니다.
+	 * 주어진 EffectScalabilitySettings와 같은지 확인하는 ==연산자 오버로딩입니다.
 	 * 
-	 * @param TargetDynamicDestroyNiagaraEffectList 제거할 동적으로 생성한 NiagaraEffect의 목록입니다.
+	 * @param TargetEffectScalabilitySettings 비교하는 EffectScalabilitySettings와 같은지 확인할 EffectScalabilitySettings입니다.
+	 * @return 주어진 EffectScalabilitySettings와 같을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|NiagaraSystem")
-	void ClearDynamicDestroyNiagaraList(FPRDynamicDestroyNiagaraEffectList& TargetDynamicDestroyNiagaraEffectList);
+	FORCEINLINE bool operator==(const FPREffectScalabilitySettings& TargetEffectScalabilitySettings) const
+	{
+		return this->PoolSizeScale == TargetEffectScalabilitySettings.PoolSizeScale
+				&& this->MaxPoolSize == TargetEffectScalabilitySettings.MaxPoolSize
+				&& this->SpawnProbability == TargetEffectScalabilitySettings.SpawnProbability;
+	}
 
 	/**
-	 * 주어진 NiagaraSystem에 해당하는 NiagaraEffect의 설정 값을 데이터 테이블에서 가져오는 함수입니다.
+	 * 주어진 EffectScalabilitySettings와 같지 않은지 확인하는 !=연산자 오버로딩입니다.
+	 * 
+	 * @param TargetEffectScalabilitySettings 비교하는 EffectScalabilitySettings와 같지 않은지 확인할 EffectScalabilitySettings입니다.
+	 * @return 주어진 EffectScalabilitySettings와 같지 않을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	FORCEINLINE bool operator!=(const FPREffectScalabilitySettings& TargetEffectScalabilitySettings) const
+	{
+		return !(*this == TargetEffectScalabilitySettings);
+	}
+};
+
+/**
+ * Pool을 생성할 때 NiagaraSystem을 미리 실행한 결과와 처음 사용할 때의 히치를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRNiagaraWarmUpStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRNiagaraWarmUpStats()
+		: WarmedSystemCount(0)
+		, WarmUpTime(0.0f)
+		, FirstUseCount(0)
+		, FirstUseHitchCount(0)
+	{}
+
+public:
+	/** Pool을 생성할 때 미리 실행한 NiagaraSystem의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRNiagaraWarmUpStats")
+	int32 WarmedSystemCount;
+
+	/** NiagaraSystem을 미리 실행하는데 걸린 전체 시간(ms)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRNiagaraWarmUpStats")
+	float WarmUpTime;
+
+	/** 처음 활성화한 시간을 측정한 NiagaraSystem의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRNiagaraWarmUpStats")
+	int32 FirstUseCount;
+
+	/** 처음 활성화하는데 FirstUseHitchThreshold보다 오래 걸린 NiagaraSystem의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRNiagaraWarmUpStats")
+	int32 FirstUseHitchCount;
+};
+#pragma endregion
+
+/**
+ * Owner가 사용하는 이펙트를 관리하는 ActorComponent 클래스입니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPREffectSystemComponent : public UPRBaseObjectPoolSystemComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPREffectSystemComponent();
+
+public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+#pragma region PRBaseObjectPoolSystem
+public:
+	/** 기존의 ObjectPool을 제거하고, 새로 ObjectPool을 생성하여 초기화하는 함수입니다. */
+	virtual void InitializeObjectPool() override;
+
+	/** 모든 ObjectPool을 제거하는 함수입니다. */
+	virtual void ClearAllObjectPool() override;
+
+protected:
+	/** Pool이 생성된 후 스트리밍된 레벨의 미리 배치된 이펙트를 EffectPool에 추가하는 함수입니다. */
+	virtual void AdoptBakedPoolActors() override;
+
+	/** 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 Pool의 크기를 반환하는 함수입니다. */
+	virtual int32 GetPoolCapacity(UObject* PoolKey) const override;
+
+	/** 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 Pool에서 활성화된 이펙트의 수를 반환하는 함수입니다. */
+	virtual int32 GetActivatePoolObjectCount(UObject* PoolKey) const override;
+
+	/** 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 Pool에 비활성화된 이펙트를 하나 추가하는 함수입니다. */
+	virtual UObject* GrowPool(UObject* PoolKey) override;
+#pragma endregion
+
+#pragma region AttachedEffect
+public:
+	/**
+	 * 주어진 이펙트를 부착된 Component와 함께 등록하는 함수입니다.
+	 * 등록된 이펙트는 부착된 Component가 제거되거나 숨겨지면 자동으로 비활성화되어 Pool에 반환됩니다.
 	 *
-	 * @param NiagaraSystem 데이터 테이블에서 설정 값을 가져올 NiagaraSystem입니다.
-	 * @return 데이터 테이블에 해당하는 NiagaraEffect의 설정 값이 있으면 반환합니다. 그렇지 않으면 기본 값을 반환합니다.
+	 * @param AttachedEffect 등록할 이펙트입니다.
+	 * @param AttachParent 이펙트가 부착된 Component입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraEffect")
-	FPRNiagaraEffectPoolSettings GetNiagaraEffectPoolSettingsFromDataTable(UNiagaraSystem* NiagaraSystem) const; 
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|AttachedEffect")
+	void RegisterAttachedEffect(APREffect* AttachedEffect, USceneComponent* AttachParent);
 
 	/**
-	 * 주어진 NiagaraEffect가 비활성화될 때 실행하는 함수입니다.
+	 * 주어진 이펙트를 등록 해제하는 함수입니다.
 	 *
-	 * @param TargetEffect 비활성화되는 Effect입니다.
+	 * @param AttachedEffect 등록 해제할 이펙트입니다.
 	 */
-	UFUNCTION()
-	void OnNiagaraEffectDeactivate(APREffect* TargetEffect);
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|AttachedEffect")
+	void UnregisterAttachedEffect(APREffect* AttachedEffect);
 
+private:
 	/**
-	 * 주어진 동적으로 생성한 NiagaraEffect가 비활성화될 때 실행하는 함수입니다.
+	 * ComponentOnly와 NiagaraComponentPool 방식으로 Spawn한 FXSystemComponent를 부착된 Component와 함께 등록하는 함수입니다.
+	 * 등록된 FXSystemComponent는 부착된 Component가 제거되거나 숨겨지면 자동으로 비활성화되어 Pool에 반환됩니다.
 	 *
-	 * @param TargetEffect 비활성화되는 Effect입니다.
+	 * @param AttachedFXComponent 등록할 FXSystemComponent입니다.
+	 * @param AttachParent FXSystemComponent가 부착된 Component입니다.
+	 */
+	void RegisterAttachedFXComponent(UFXSystemComponent* AttachedFXComponent, USceneComponent* AttachParent);
+
+	/** 부착된 Component의 상태를 확인하는 타이머가 작동 중이지 않으면 타이머를 설정하는 함수입니다. */
+	void StartAttachParentCheckTimer();
+
+	/**
+	 * FXComponentPoolManager가 FXComponent를 Pool에 반환할 때 실행하는 함수입니다.
+	 *
+	 * @param FXComponent Pool에 반환된 FXComponent입니다.
 	 */
 	UFUNCTION()
-	void OnDynamicNiagaraEffectDeactivate(APREffect* TargetEffect);
+	void OnPooledFXComponentDeactivate(UFXSystemComponent* FXComponent);
+
+	/** 부착된 Component가 제거되거나 숨겨진 이펙트와 FXSystemComponent를 비활성화하여 Pool에 반환하는 함수입니다. */
+	void ReclaimOrphanedEffects();
+
+	/**
+	 * 주어진 Component가 이펙트를 부착하기에 유효한지 확인하는 함수입니다.
+	 *
+	 * @param AttachParent 확인할 Component입니다.
+	 * @return Component가 유효하고 제거 중이 아니며 보이는 상태일 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool IsValidAttachParent(const USceneComponent* AttachParent) const;
+
+private:
+	/** 부착된 Component의 상태를 확인하는 주기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|AttachedEffect", meta = (AllowPrivateAccess = "true", ClampMin = "0.01"))
+	float AttachParentCheckInterval;
+
+	/** 활성화된 부착 이펙트와 이펙트가 부착된 Component를 보관하는 Map입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<APREffect>, TWeakObjectPtr<USceneComponent>> AttachedEffects;
+
+	/** ComponentOnly와 NiagaraComponentPool 방식으로 Spawn한 부착 FXSystemComponent와 부착된 Component를 보관하는 Map입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UFXSystemComponent>, TWeakObjectPtr<USceneComponent>> AttachedFXComponents;
+
+	/** 부착된 Component의 상태를 주기적으로 확인하는 TimerHandle입니다. */
+	FTimerHandle AttachParentCheckTimerHandle;
+#pragma endregion
+
+#pragma region EffectSignificance
+public:
+	/**
+	 * 주어진 위치에 Spawn할 이펙트의 Significance를 카메라와의 거리, 시야, 부착할 Component의 렌더링 여부로 평가하는 함수입니다.
+	 *
+	 * @param Location 이펙트를 Spawn할 위치입니다.
+	 * @param AttachParent 이펙트를 부착할 Component입니다. 부착하지 않을 경우 nullptr입니다.
+	 * @param bCanDowngrade 대체할 가벼운 이펙트가 있는지 여부입니다.
+	 * @return Significance 평가 결과입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSignificance")
+	EPREffectSignificance EvaluateEffectSignificance(const FVector& Location, const USceneComponent* AttachParent, bool bCanDowngrade) const;
+
+	/** Significance 평가 결과의 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSignificance")
+	void ResetEffectSignificanceStats();
+
+private:
+	/**
+	 * 이펙트의 Spawn 요청에 Significance 평가 결과를 적용하는 함수입니다.
+	 * Downgrade일 경우 SpawnEffect를 데이터 테이블의 가벼운 이펙트로 바꾸고, Delay일 경우 요청을 지연 목록에 추가합니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param Location 이펙트를 생성할 위치입니다.
+	 * @param Rotation 이펙트에 적용할 회전 값입니다.
+	 * @param Scale 이펙트에 적용할 크기입니다.
+	 * @param AttachParent 이펙트를 부착할 Component입니다. 부착하지 않을 경우 nullptr입니다.
+	 * @param bEffectAutoActivate 이펙트를 Spawn하자마자 실행할지 여부입니다.
+	 * @param bReset 처음부터 다시 재생할지 여부입니다.
+	 * @return 지금 Spawn해야 할 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool ApplyEffectSignificance(UFXSystemAsset*& SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, const USceneComponent* AttachParent, bool bEffectAutoActivate, bool bReset);
+
+	/**
+	 * Significance 평가 결과를 집계하는 함수입니다.
+	 *
+	 * @param Significance 집계할 Significance 평가 결과입니다.
+	 */
+	void RecordEffectSignificance(EPREffectSignificance Significance);
+
+	/**
+	 * 지연한 Spawn 요청의 Significance를 다시 평가하여 Spawn하거나 제거하는 함수입니다.
+	 *
+	 * @param DeltaTime 이전에 실행한 후 지난 시간입니다.
+	 */
+	void ProcessDelayedEffectSpawnRequests(float DeltaTime);
+
+	/**
+	 * Significance 평가에 사용할 카메라의 위치와 회전 값, FOV를 가져오는 함수입니다.
+	 *
+	 * @param OutViewLocation 카메라의 위치입니다.
+	 * @param OutViewRotation 카메라의 회전 값입니다.
+	 * @param OutFOVAngle 카메라의 FOV입니다.
+	 * @return 카메라를 찾았을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool GetSignificanceViewPoint(FVector& OutViewLocation, FRotator& OutViewRotation, float& OutFOVAngle) const;
+
+private:
+	/** Spawn 요청의 Significance를 평가할지 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSignificance", meta = (AllowPrivateAccess = "true"))
+	bool bEnableEffectSignificance;
+
+	/** Significance 평가의 설정 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSignificance", meta = (AllowPrivateAccess = "true"))
+	FPREffectSignificanceSettings EffectSignificanceSettings;
+
+	/** Significance 평가 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSignificance", meta = (AllowPrivateAccess = "true"))
+	FPREffectSignificanceStats EffectSignificanceStats;
+
+	/** 시야 밖에 있어 Spawn을 지연한 요청의 목록입니다. */
+	UPROPERTY(Transient)
+	TArray<FPRDelayedEffectSpawnRequest> DelayedEffectSpawnRequests;
+
+	/** 지연한 요청을 Spawn하는 동안 Significance를 다시 평가하지 않도록 하는 변수입니다. */
+	bool bSkipEffectSignificance;
+
+public:
+	/** EffectSignificanceStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPREffectSignificanceStats& GetEffectSignificanceStats() const { return EffectSignificanceStats; }
+#pragma endregion
+
+#pragma region EffectSpawnBudget
+public:
+	/** Spawn 예산과 병합의 결과 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSpawnBudget")
+	void ResetEffectSpawnBudgetStats();
+
+private:
+	/**
+	 * 이펙트의 Spawn 요청에 프레임당 Spawn 예산과 병합을 적용하는 함수입니다.
+	 * 같은 이펙트가 가까운 위치와 시간에 Spawn되었으면 기존 이펙트의 세기를 높이고, 예산을 초과하면 우선순위에 따라 요청을 미루거나 버립니다.
+	 * 예산과 병합 대상은 월드의 모든 EffectSystem이 EffectSpawnBudgetSubsystem에서 공유합니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param Location 이펙트를 생성할 위치입니다.
+	 * @param Rotation 이펙트에 적용할 회전 값입니다.
+	 * @param Scale 이펙트에 적용할 크기입니다.
+	 * @param bAttached 이펙트를 Component에 부착하는지 여부입니다. 부착하는 이펙트는 병합하거나 미루지 않습니다.
+	 * @param bEffectAutoActivate 이펙트를 Spawn하자마자 실행할지 여부입니다.
+	 * @param bReset 처음부터 다시 재생할지 여부입니다.
+	 * @return 지금 Spawn해야 할 경우 true를 반환합니다. 병합되었거나 미루거나 버린 경우 false를 반환합니다.
+	 */
+	bool ApplyEffectSpawnBudget(UFXSystemAsset* SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAttached, bool bEffectAutoActivate, bool bReset);
+
+	/**
+	 * Spawn한 이펙트를 프레임당 Spawn 수에 더하고 병합 대상으로 등록하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn한 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param Location 이펙트를 Spawn한 위치입니다.
+	 * @param EffectComponent Spawn한 이펙트의 Component입니다.
+	 * @param bAttached 이펙트를 Component에 부착했는지 여부입니다. 부착한 이펙트는 병합 대상으로 등록하지 않습니다.
+	 */
+	void RecordEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, UFXSystemComponent* EffectComponent, bool bAttached);
 
 	/**
-	 * 동적으로 생성한 NiagaraEffect를 제거하는 함수입니다.
+	 * 주어진 이펙트가 이번 프레임에 월드의 예산 안에서 더 Spawn될 수 있는지 확인하는 함수입니다.
+	 *
+	 * @param SpawnEffect 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param MaxSpawnsPerFrame 이펙트가 프레임당 Spawn할 수 있는 최대 수입니다.
+	 * @return 예산이 남아있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool HasEffectSpawnBudget(UFXSystemAsset* SpawnEffect, int32 MaxSpawnsPerFrame) const;
+
+	/**
+	 * 주어진 이펙트의 데이터 테이블에 설정된 Spawn 우선순위와 프레임당 최대 Spawn 수를 가져오는 함수입니다.
+	 *
+	 * @param SpawnEffect 설정 값을 가져올 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param OutPriority Spawn 우선순위입니다.
+	 * @param OutMaxSpawnsPerFrame 프레임당 최대 Spawn 수입니다.
+	 */
+	void GetEffectSpawnBudgetSettings(UFXSystemAsset* SpawnEffect, EPREffectSpawnPriority& OutPriority, int32& OutMaxSpawnsPerFrame) const;
+
+	/**
+	 * 주어진 이펙트 Component에 병합된 요청의 수를 세기 파라미터로 전달하는 함수입니다.
+	 *
+	 * @param EffectComponent 세기를 전달할 이펙트의 Component입니다.
+	 * @param Intensity 전달할 세기입니다.
+	 */
+	void ApplyEffectIntensity(UFXSystemComponent* EffectComponent, float Intensity) const;
+
+	/** 예산을 초과하여 미룬 Spawn 요청을 우선순위 순서로 Spawn하는 함수입니다. */
+	void ProcessQueuedEffectSpawnRequests();
+
+private:
+	/** 프레임당 Spawn 예산과 병합을 적용할지 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSpawnBudget", meta = (AllowPrivateAccess = "true"))
+	bool bEnableEffectSpawnBudget;
+
+	/** 프레임당 Spawn 예산과 병합의 설정 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSpawnBudget", meta = (AllowPrivateAccess = "true"))
+	FPREffectSpawnBudgetSettings EffectSpawnBudgetSettings;
+
+	/** Spawn 예산과 병합의 결과 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectSpawnBudget", meta = (AllowPrivateAccess = "true"))
+	FPREffectSpawnBudgetStats EffectSpawnBudgetStats;
+
+	/** 예산을 초과하여 미룬 Spawn 요청의 목록입니다. */
+	UPROPERTY(Transient)
+	TArray<FPRDelayedEffectSpawnRequest> QueuedEffectSpawnRequests;
+
+	/** 미룬 요청을 Spawn하는 동안 다시 예산을 적용하지 않도록 하는 변수입니다. */
+	bool bSkipEffectSpawnBudget;
+
+	/** 미룬 요청을 Spawn하는 동안 Spawn한 이펙트에 전달할 세기입니다. */
+	float DispatchingEffectIntensity;
+
+public:
+	/** EffectSpawnBudgetStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPREffectSpawnBudgetStats& GetEffectSpawnBudgetStats() const { return EffectSpawnBudgetStats; }
+#pragma endregion
+
+#pragma region EffectSpawnRequest
+public:
+	/**
+	 * SpawnFXSystemAtLocation으로 이펙트를 Spawn하고, 지연했을 경우 나중에 결과를 받을 수 있는 요청의 번호를 반환하는 함수입니다.
+	 * 지연한 요청의 결과는 OnEffectSpawnRequestResolvedDelegate로 전달합니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Location 이펙트를 생성할 위치
+	 * @param Rotation 이펙트에 적용할 회전 값
+	 * @param Scale 이펙트에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 이펙트를 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 바로 Spawn했을 경우 FXSystemComponent를, 지연했을 경우 요청의 번호를 가진 Handle입니다. 둘 다 없을 경우 Spawn하지 않았거나 다른 요청에 병합된 것입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSpawnRequest")
+	FPREffectSpawnHandle RequestFXSystemAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * 주어진 번호의 요청이 아직 지연되어 Spawn을 기다리고 있는지 확인하는 함수입니다.
+	 *
+	 * @param RequestId 확인할 요청의 번호입니다.
+	 * @return 지연된 요청이 있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSpawnRequest")
+	bool IsEffectSpawnRequestPending(int32 RequestId) const;
+
+	/**
+	 * 주어진 번호의 지연한 요청을 Spawn하지 않고 제거하는 함수입니다. 취소한 요청의 결과는 전달하지 않습니다.
+	 *
+	 * @param RequestId 취소할 요청의 번호입니다.
+	 * @return 지연된 요청을 제거했을 경우 true를 반환합니다. 이미 처리되었을 경우 false를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectSpawnRequest")
+	bool CancelEffectSpawnRequest(int32 RequestId);
+
+private:
+	/**
+	 * 지연할 요청의 번호를 반환하는 함수입니다. 지연한 요청을 다시 Spawn하는 중일 경우 기존 번호를 반환합니다.
 	 *
-	 * @param TargetNiagaraEffect 제거하는 동적으로 생성된 NiagaraEffect입니다.
+	 * @return 요청의 번호입니다.
+	 */
+	int32 IssueEffectSpawnRequestId();
+
+	/**
+	 * 지연한 요청을 처리한 결과를 전달하는 함수입니다. 요청이 다시 지연되었을 경우 전달하지 않습니다.
+	 *
+	 * @param RequestId 처리한 요청의 번호입니다.
+	 * @param EffectComponent Spawn한 이펙트의 FXSystemComponent입니다. Spawn하지 않았을 경우 nullptr입니다.
+	 */
+	void ResolveEffectSpawnRequest(int32 RequestId, UFXSystemComponent* EffectComponent);
+
+private:
+	/** 다음에 발급할 요청의 번호입니다. */
+	int32 NextEffectSpawnRequestId;
+
+	/** 지연한 요청을 다시 Spawn하는 동안 사용하는 요청의 번호입니다. */
+	int32 DispatchingEffectSpawnRequestId;
+
+public:
+	/** 지연한 Spawn 요청을 Spawn하거나 Spawn하지 않고 제거했을 때 실행하는 델리게이트입니다. */
+	UPROPERTY(BlueprintAssignable, Category = "PREffectSystem|EffectSpawnRequest")
+	FOnEffectSpawnRequestResolved OnEffectSpawnRequestResolvedDelegate;
+#pragma endregion
+
+#pragma region NiagaraPoolingBackend
+public:
+	/**
+	 * NiagaraPoolingBackend에 따라 NiagaraSystem을 지정한 위치에 Spawn하는 함수입니다.
+	 * Actor일 경우 NiagaraPool의 NiagaraEffect를, NiagaraComponentPool일 경우 엔진의 NiagaraComponent Pool을,
+	 * ComponentOnly일 경우 FXComponentPoolManager의 NiagaraComponent를 사용합니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem
+	 * @param Location NiagaraSystem을 생성할 위치
+	 * @param Rotation NiagaraSystem에 적용할 회전 값
+	 * @param Scale NiagaraSystem에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 NiagaraSystem을 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 위치에 Spawn한 NiagaraComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraPoolingBackend")
+	UNiagaraComponent* SpawnNiagaraSystemAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * NiagaraSystem을 지정한 위치에 Spawn하고, 활성화하기 전에 주어진 사용자 파라미터를 적용하는 함수입니다.
+	 * 파라미터의 Offset은 NiagaraSystem별로 한 번만 찾으므로 Spawn할 때마다 이름으로 파라미터를 찾지 않습니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem
+	 * @param Parameters 활성화하기 전에 적용할 사용자 파라미터
+	 * @param Location NiagaraSystem을 생성할 위치
+	 * @param Rotation NiagaraSystem에 적용할 회전 값
+	 * @param Scale NiagaraSystem에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 NiagaraSystem을 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 위치에 Spawn한 NiagaraComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraPoolingBackend")
+	UNiagaraComponent* SpawnNiagaraSystemAtLocationWithParameters(UNiagaraSystem* SpawnEffect, const FPRNiagaraParameterBlock& Parameters, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * NiagaraPoolingBackend에 따라 NiagaraSystem을 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem
+	 * @param Parent NiagaraSystem을 부착할 Component
+	 * @param AttachSocketName 부착할 소켓의 이름
+	 * @param Location NiagaraSystem을 생성할 위치
+	 * @param Rotation NiagaraSystem에 적용할 회전 값
+	 * @param Scale NiagaraSystem에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 NiagaraSystem을 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 Component에 부착하여 Spawn한 NiagaraComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraPoolingBackend")
+	UNiagaraComponent* SpawnNiagaraSystemAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * SpawnNiagaraSystemAtLocation 또는 SpawnNiagaraSystemAttached로 Spawn한 NiagaraComponent를 비활성화하는 함수입니다.
+	 *
+	 * @param NiagaraComponent 비활성화할 NiagaraComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraPoolingBackend")
+	void DeactivateNiagaraSystem(UNiagaraComponent* NiagaraComponent);
+
+	/**
+	 * 두 NiagaraPoolingBackend로 주어진 NiagaraSystem을 Spawn하여 Spawn 비용, 메모리, GameThread 시간을 비교하는 함수입니다.
+	 * 결과는 로그로 출력합니다.
+	 *
+	 * @param NiagaraSystem 비교에 사용할 NiagaraSystem입니다.
+	 * @param SpawnCount 각 NiagaraPoolingBackend로 Spawn할 수입니다.
+	 */
+	void RunNiagaraPoolingBenchmark(UNiagaraSystem* NiagaraSystem, int32 SpawnCount);
+
+private:
+	/**
+	 * 엔진의 NiagaraComponent Pool에서 가져온 NiagaraComponent의 수명과 반환을 설정하는 함수입니다.
+	 *
+	 * @param NiagaraComponent 설정할 NiagaraComponent입니다.
+	 * @param bEffectAutoActivate NiagaraComponent가 Spawn하자마자 실행되었는지 여부입니다.
+	 */
+	void RegisterPooledNiagaraComponent(UNiagaraComponent* NiagaraComponent, bool bEffectAutoActivate);
+
+	/**
+	 * 엔진의 NiagaraComponent Pool에서 주어진 NiagaraSystem의 NiagaraComponent를 더 가져올 수 있는지 확인하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 확인할 NiagaraSystem입니다.
+	 * @return 사용 중인 NiagaraComponent가 이펙트 품질 단계의 MaxPoolSize보다 적을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool HasPooledNiagaraComponentCapacity(UNiagaraSystem* NiagaraSystem) const;
+
+	/** 엔진의 NiagaraComponent Pool에서 가져온 모든 NiagaraComponent를 비활성화하여 반환하는 함수입니다. */
+	void ReleaseAllPooledNiagaraComponents();
+
+	/**
+	 * 엔진의 NiagaraComponent Pool에서 가져온 NiagaraComponent의 실행이 끝날 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 NiagaraComponent입니다.
 	 */
 	UFUNCTION()
-	void OnDynamicNiagaraEffectDestroy(APRNiagaraEffect* TargetNiagaraEffect);
-	
+	void OnPooledNiagaraComponentFinished(UNiagaraComponent* FinishedComponent);
+
+	/**
+	 * 엔진의 NiagaraComponent Pool에서 가져온 NiagaraComponent의 수명이 끝날 때 실행하는 함수입니다.
+	 *
+	 * @param NiagaraComponent 수명이 끝난 NiagaraComponent입니다.
+	 */
+	void OnPooledNiagaraComponentLifespanEnd(UNiagaraComponent* NiagaraComponent);
+
+	/**
+	 * 비교에 사용한 NiagaraSystem의 GameThread 시간을 기록하고 다음 단계를 실행하는 함수입니다.
+	 *
+	 * @param NiagaraSystem 비교에 사용할 NiagaraSystem입니다.
+	 * @param SpawnCount 각 NiagaraPoolingBackend로 Spawn할 수입니다.
+	 * @param BenchmarkBackend 현재 단계의 NiagaraPoolingBackend입니다.
+	 * @param PreviousBackend 비교를 시작하기 전의 NiagaraPoolingBackend입니다.
+	 */
+	void RunNiagaraPoolingBenchmarkStep(UNiagaraSystem* NiagaraSystem, int32 SpawnCount, EPREffectPoolingBackend BenchmarkBackend, EPREffectPoolingBackend PreviousBackend);
+
+	/**
+	 * Spawn 중인 요청의 사용자 파라미터를 활성화하기 전의 FXSystemComponent에 적용하는 함수입니다.
+	 *
+	 * @param FXSystemComponent 파라미터를 적용할 FXSystemComponent입니다. NiagaraComponent가 아니면 적용하지 않습니다.
+	 */
+	void ApplyDispatchingNiagaraParameters(UFXSystemComponent* FXSystemComponent) const;
+
 private:
-	/** NiagaraObjectPool의 설정 값을 가진 데이터 테이블입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
-	TObjectPtr<UDataTable> NiagaraPoolSettingsDataTable;
-	
-	/** NiagaraSystem ObjectPool입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
-	FPRNiagaraEffectObjectPool NiagaraPool;
+	/** NiagaraSystem을 풀링하는 방식입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraPoolingBackend", meta = (AllowPrivateAccess = "true"))
+	EPREffectPoolingBackend NiagaraPoolingBackend;
+
+	/** 엔진의 NiagaraComponent Pool에서 가져와 사용 중인 NiagaraComponent와 수명 TimerHandle을 보관하는 Map입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UNiagaraComponent>, FTimerHandle> ActivePooledNiagaraComponents;
+
+	/** 엔진의 NiagaraComponent Pool에서 가져와 사용 중인 NiagaraComponent의 NiagaraSystem별 수입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UNiagaraSystem>, int32> ActivePooledNiagaraComponentCounts;
+
+	/** 비교 중에 Spawn한 NiagaraComponent의 목록입니다. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UNiagaraComponent>> BenchmarkNiagaraComponents;
+
+	/** 비교를 위해 Spawn하는 동안 Spawn 확률, Significance, Spawn 예산을 적용하지 않도록 하는 변수입니다. */
+	bool bSkipEffectSpawnGates;
+
+	/** Spawn 중인 요청이 활성화하기 전에 적용할 사용자 파라미터입니다. 파라미터가 없으면 nullptr입니다. */
+	const FPRNiagaraParameterBlock* DispatchingNiagaraParameters;
+
+public:
+	/** NiagaraPoolingBackend를 반환하는 함수입니다. */
+	FORCEINLINE EPREffectPoolingBackend GetNiagaraPoolingBackend() const { return NiagaraPoolingBackend; }
+
+	/**
+	 * NiagaraPoolingBackend를 설정하는 함수입니다.
+	 *
+	 * @param NewNiagaraPoolingBackend 설정할 NiagaraPoolingBackend입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraPoolingBackend")
+	void SetNiagaraPoolingBackend(EPREffectPoolingBackend NewNiagaraPoolingBackend);
+#pragma endregion
+
+#pragma region FXComponentPool
+public:
+	/**
+	 * 이펙트의 종류에 맞는 PoolingBackend에 따라 NiagaraSystem 또는 ParticleSystem을 지정한 위치에 Spawn하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Location 이펙트를 생성할 위치
+	 * @param Rotation 이펙트에 적용할 회전 값
+	 * @param Scale 이펙트에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 이펙트를 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 위치에 Spawn한 이펙트의 FXSystemComponent입니다. 요청이 다른 요청의 이펙트에 병합되었을 경우 그 이펙트는 다른 요청이 소유하므로 반환하지 않고 nullptr을 반환합니다.
+	 *		   요청을 지연했을 경우에도 nullptr을 반환하며, 지연한 요청의 결과가 필요할 경우 RequestFXSystemAtLocation을 사용합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	UFXSystemComponent* SpawnFXSystemAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * 이펙트의 종류에 맞는 PoolingBackend에 따라 NiagaraSystem 또는 ParticleSystem을 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Parent 이펙트를 부착할 Component
+	 * @param AttachSocketName 부착할 소켓의 이름
+	 * @param Location 이펙트를 생성할 위치
+	 * @param Rotation 이펙트에 적용할 회전 값
+	 * @param Scale 이펙트에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 이펙트를 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 Component에 부착하여 Spawn한 이펙트의 FXSystemComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	UFXSystemComponent* SpawnFXSystemAttached(UFXSystemAsset* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * SpawnFXSystemAtLocation 또는 SpawnFXSystemAttached로 Spawn한 FXSystemComponent를 비활성화하는 함수입니다.
+	 *
+	 * @param FXSystemComponent 비활성화할 FXSystemComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	void DeactivateFXSystem(UFXSystemComponent* FXSystemComponent);
+
+	/**
+	 * 주어진 이펙트에 사용할 PoolingBackend를 반환하는 함수입니다.
+	 *
+	 * @param EffectAsset PoolingBackend를 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return NiagaraSystem일 경우 NiagaraPoolingBackend를, ParticleSystem일 경우 ParticlePoolingBackend를 반환합니다.
+	 */
+	EPREffectPoolingBackend GetEffectPoolingBackend(const UFXSystemAsset* EffectAsset) const;
+
+	/**
+	 * ParticlePoolingBackend에 따라 ParticleSystem을 지정한 위치에 Spawn하는 함수입니다.
+	 * Actor일 경우 ParticlePool의 ParticleEffect를, ComponentOnly일 경우 FXComponentPoolManager의 ParticleSystemComponent를 사용합니다.
+	 *
+	 * @param SpawnEffect Spawn할 ParticleSystem
+	 * @param Location ParticleSystem을 생성할 위치
+	 * @param Rotation ParticleSystem에 적용할 회전 값
+	 * @param Scale ParticleSystem에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 ParticleSystem을 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 위치에 Spawn한 ParticleSystemComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	UParticleSystemComponent* SpawnParticleSystemAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * ParticlePoolingBackend에 따라 ParticleSystem을 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn할 ParticleSystem
+	 * @param Parent ParticleSystem을 부착할 Component
+	 * @param AttachSocketName 부착할 소켓의 이름
+	 * @param Location ParticleSystem을 생성할 위치
+	 * @param Rotation ParticleSystem에 적용할 회전 값
+	 * @param Scale ParticleSystem에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 ParticleSystem을 Spawn하자마자 실행합니다. false일 경우 실행하지 않습니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return 지정한 Component에 부착하여 Spawn한 ParticleSystemComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	UParticleSystemComponent* SpawnParticleSystemAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/**
+	 * SpawnParticleSystemAtLocation 또는 SpawnParticleSystemAttached로 Spawn한 ParticleSystemComponent를 비활성화하는 함수입니다.
+	 *
+	 * @param ParticleSystemComponent 비활성화할 ParticleSystemComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	void DeactivateParticleSystem(UParticleSystemComponent* ParticleSystemComponent);
+
+	/**
+	 * ParticlePoolingBackend를 설정하는 함수입니다. NiagaraComponentPool은 Actor로 처리합니다.
+	 *
+	 * @param NewParticlePoolingBackend 설정할 ParticlePoolingBackend입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|FXComponentPool")
+	void SetParticlePoolingBackend(EPREffectPoolingBackend NewParticlePoolingBackend);
+
+	/** 월드의 FXComponentPoolManager를 반환하는 함수입니다. */
+	APRFXComponentPoolManager* GetFXComponentPoolManager();
 
-	/** 활성화된 NiagaraSystem의 Index 목록입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
-	FPRActivateNiagaraEffectIndexList ActivateNiagaraIndexList;
+private:
+	/**
+	 * 주어진 NiagaraSystem 또는 ParticleSystem의 수명을 데이터 테이블에서 가져오는 함수입니다.
+	 *
+	 * @param EffectAsset 수명을 가져올 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 데이터 테이블에 설정 값이 있으면 EffectLifespan을, 그렇지 않으면 DynamicLifespan을 반환합니다.
+	 */
+	float GetEffectLifespanFromDataTable(UFXSystemAsset* EffectAsset) const;
+
+private:
+	/** ParticleSystem을 풀링하는 방식입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|FXComponentPool", meta = (AllowPrivateAccess = "true"))
+	EPREffectPoolingBackend ParticlePoolingBackend;
+
+	/** 월드의 FXComponentPoolManager입니다. */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<APRFXComponentPoolManager> FXComponentPoolManager;
+
+public:
+	/** ParticlePoolingBackend를 반환하는 함수입니다. */
+	FORCEINLINE EPREffectPoolingBackend GetParticlePoolingBackend() const { return ParticlePoolingBackend; }
+#pragma endregion
+
+#pragma region EffectScalability
+public:
+	/**
+	 * 현재 이펙트 품질 단계와 pr.FX 콘솔 변수로 설정 값을 다시 계산하고, 바뀌었을 경우 EffectPool의 크기를 조정하는 함수입니다.
+	 * sg.EffectsQuality 또는 pr.FX 콘솔 변수가 바뀌면 자동으로 호출됩니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectScalability")
+	void RefreshEffectScalability();
+
+	/**
+	 * 현재 이펙트 품질 단계에 해당하는 설정 값에 pr.FX 콘솔 변수를 적용하여 반환하는 함수입니다.
+	 *
+	 * @return 현재 적용해야 하는 설정 값입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectScalability")
+	FPREffectScalabilitySettings GetCurrentEffectScalabilitySettings() const;
+
+private:
+	/**
+	 * 주어진 PoolSize에 현재 설정 값의 비율과 최대 크기를 적용하여 반환하는 함수입니다.
+	 *
+	 * @param PoolSize 데이터 테이블 또는 DynamicPoolSize의 PoolSize입니다.
+	 * @return 조정한 PoolSize입니다.
+	 */
+	int32 GetScaledPoolSize(int32 PoolSize) const;
+
+	/**
+	 * 주어진 이펙트가 현재 설정 값의 Spawn 확률을 통과하는지 확인하는 함수입니다.
+	 *
+	 * @param SpawnEffect 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return Spawn해야 할 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool PassesEffectSpawnProbability(UFXSystemAsset* SpawnEffect) const;
+
+	/** 생성된 모든 EffectPool의 크기를 현재 설정 값에 맞게 늘리거나 줄이는 함수입니다. */
+	void ResizeEffectPools();
+
+	/**
+	 * 주어진 이펙트의 Pool에 비활성화된 이펙트를 하나 추가하는 함수입니다. 추가한 이펙트는 동적으로 생성한 이펙트와 달리 제거되지 않습니다.
+	 *
+	 * @param EffectAsset 이펙트를 추가할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 추가한 이펙트입니다.
+	 */
+	APREffect* AddPooledEffect(UFXSystemAsset* EffectAsset);
+
+private:
+	/** 이펙트 품질 단계(sg.EffectsQuality)별 설정 값입니다. 0은 Low, 4는 Cinematic이며 범위를 벗어나면 마지막 값을 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectScalability", meta = (AllowPrivateAccess = "true"))
+	TArray<FPREffectScalabilitySettings> EffectScalabilitySettings;
+
+	/** 현재 EffectPool에 적용된 설정 값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectScalability", meta = (AllowPrivateAccess = "true"))
+	FPREffectScalabilitySettings AppliedEffectScalabilitySettings;
+
+	/** 지연하거나 미룬 요청을 Spawn하는 동안 Spawn 확률을 다시 적용하지 않도록 하는 변수입니다. */
+	bool bSkipEffectSpawnProbability;
+
+public:
+	/** AppliedEffectScalabilitySettings를 반환하는 함수입니다. */
+	FORCEINLINE const FPREffectScalabilitySettings& GetAppliedEffectScalabilitySettings() const { return AppliedEffectScalabilitySettings; }
+#pragma endregion
+
+#pragma region NiagaraWarmUp
+public:
+	/** 미리 실행한 결과와 처음 사용할 때의 히치 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraWarmUp")
+	void ResetNiagaraWarmUpStats();
+
+	/** 처음 활성화할 때 히치가 발생한 NiagaraSystem과 시간을 로그로 출력하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|NiagaraWarmUp")
+	void ReportNiagaraFirstUseHitches() const;
+
+private:
+	/**
+	 * Pool에 보관된 숨겨진 NiagaraEffect로 NiagaraSystem을 한 번 활성화하고, 시뮬레이션을 진행한 후 초기화하는 함수입니다.
+	 * SystemInstance와 DataInterface의 초기화 비용을 처음 사용할 때가 아닌 Pool을 생성할 때 지불합니다.
+	 *
+	 * @param NiagaraEffect 미리 실행할 Pool의 NiagaraEffect입니다.
+	 */
+	void WarmUpNiagaraEffect(APRNiagaraEffect* NiagaraEffect);
+
+	/**
+	 * NiagaraSystem을 처음 활성화하는데 걸린 시간을 기록하는 함수입니다. 이미 기록한 NiagaraSystem은 무시합니다.
+	 *
+	 * @param EffectAsset 활성화한 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param ActivateStartTime 활성화를 시작한 시간입니다.
+	 */
+	void RecordNiagaraFirstUse(UFXSystemAsset* EffectAsset, double ActivateStartTime);
+
+private:
+	/** Pool을 생성할 때 NiagaraSystem을 미리 실행할지 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true"))
+	bool bWarmUpNiagaraEffectPool;
+
+	/** 미리 실행할 때 시뮬레이션을 진행할 Tick의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true", ClampMin = "1"))
+	int32 WarmUpTickCount;
+
+	/** 미리 실행할 때 시뮬레이션을 진행할 Tick의 간격입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true", ClampMin = "0.001"))
+	float WarmUpTickDelta;
+
+	/** 처음 활성화하는데 걸린 시간이 이 값(ms)보다 클 경우 히치로 판단합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true", ClampMin = "0.0"))
+	float FirstUseHitchThreshold;
+
+	/** 미리 실행한 결과와 처음 사용할 때의 히치 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true"))
+	FPRNiagaraWarmUpStats NiagaraWarmUpStats;
+
+	/** NiagaraSystem별로 처음 활성화하는데 걸린 시간(ms)입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|NiagaraWarmUp", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UNiagaraSystem>, float> NiagaraFirstUseTimes;
+
+	/** 미리 실행한 NiagaraSystem의 목록입니다. */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<UNiagaraSystem>> WarmedNiagaraSystems;
 
+public:
+	/** NiagaraWarmUpStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRNiagaraWarmUpStats& GetNiagaraWarmUpStats() const { return NiagaraWarmUpStats; }
+#pragma endregion
+
+#pragma region CompositeEffect
+public:
+	/**
+	 * 이펙트 프리셋의 Pool을 PoolSize만큼 미리 생성하는 함수입니다.
+	 * 프리셋의 모든 에셋과 FXSystemComponent를 함께 준비하여 처음 Spawn할 때 로드하거나 생성하지 않도록 합니다.
+	 *
+	 * @param EffectPreset Pool을 생성할 이펙트 프리셋입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|CompositeEffect")
+	void PreloadEffectPreset(UPREffectPresetDataAsset* EffectPreset);
+
+	/**
+	 * 이펙트 프리셋을 하나의 CompositeEffect로 지정한 위치에 Spawn하는 함수입니다.
+	 * 프리셋의 이펙트, 사운드, 데칼, 카메라 셰이크를 한 번의 Pool 검색과 하나의 Transform, 하나의 수명으로 실행합니다.
+	 * 프리셋의 첫 번째 이펙트로 Spawn 확률, Significance, Spawn 예산을 적용하며, 지연하거나 미뤄야 하는 프리셋은 Spawn하지 않습니다.
+	 *
+	 * @param EffectPreset Spawn할 이펙트 프리셋
+	 * @param Location 프리셋을 Spawn할 위치
+	 * @param Rotation 프리셋에 적용할 회전 값
+	 * @param Scale 프리셋에 적용할 크기
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @return Spawn한 CompositeEffect입니다. Spawn 조건을 통과하지 못했거나 Pool이 최대 크기에 도달했을 경우 nullptr을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|CompositeEffect")
+	APRCompositeEffect* SpawnEffectPresetAtLocation(UPREffectPresetDataAsset* EffectPreset, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bReset = true);
+
+	/** 모든 CompositeEffect의 Pool을 제거하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|CompositeEffect")
+	void ClearAllCompositeEffectPool();
+
+private:
 	/**
-	 * 이전에 사용된 NiagaraSystem들의 Index 목록입니다.
-	 * 동적으로 생성하는 NiagaraSystem의 Index에 오류가 생기지 않도록 합니다.
+	 * 주어진 이펙트 프리셋의 Pool에서 활성화되지 않은 CompositeEffect를 반환하는 함수입니다.
+	 * 모두 활성화되었을 경우 이펙트 품질 단계의 최대 크기까지 새로 생성합니다.
+	 *
+	 * @param EffectPreset CompositeEffect를 가져올 이펙트 프리셋입니다.
+	 * @return 활성화할 CompositeEffect입니다. Pool이 최대 크기에 도달했을 경우 nullptr을 반환합니다.
+	 */
+	APRCompositeEffect* GetActivateableCompositeEffect(UPREffectPresetDataAsset* EffectPreset);
+
+	/**
+	 * 주어진 이펙트 프리셋으로 초기화한 CompositeEffect를 월드에 생성하는 함수입니다.
+	 *
+	 * @param EffectPreset CompositeEffect를 초기화할 이펙트 프리셋입니다.
+	 * @param PoolIndex CompositeEffect의 Pool의 Index입니다.
+	 * @return 생성한 CompositeEffect입니다.
 	 */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
-	FPRUsedNiagaraEffectIndexList UsedNiagaraIndexList;
+	APRCompositeEffect* SpawnCompositeEffectInWorld(UPREffectPresetDataAsset* EffectPreset, int32 PoolIndex);
 
-	/** 동적으로 제거할 NiagaraSystem의 목록입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|NiagaraSystem", meta = (AllowPrivateAccess = "true"))
-	FPRDynamicDestroyNiagaraEffectList DynamicDestroyNiagaraList;
+	/**
+	 * 주어진 이펙트 프리셋의 Spawn 조건을 평가할 이펙트를 반환하는 함수입니다.
+	 *
+	 * @param EffectPreset 이펙트를 찾을 이펙트 프리셋입니다.
+	 * @return 프리셋의 첫 번째 NiagaraSystem 또는 ParticleSystem입니다. 없을 경우 nullptr을 반환합니다.
+	 */
+	UFXSystemAsset* GetEffectPresetGateEffect(const UPREffectPresetDataAsset* EffectPreset) const;
+
+private:
+	/** 이펙트 프리셋별 CompositeEffect의 Pool입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffectSystem|CompositeEffect", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UPREffectPresetDataAsset>, FPRCompositeEffectPool> CompositeEffectPool;
+
+	/**
+	 * 이펙트 프리셋의 Spawn 조건을 평가하는 동안 지연, 병합, 미루기 대신 Spawn하지 않도록 하는 변수입니다.
+	 * 지연하거나 미룬 요청은 하나의 이펙트로 다시 Spawn되므로 프리셋의 사운드, 데칼, 카메라 셰이크를 잃게 됩니다.
+	 */
+	bool bDispatchingEffectPreset;
 #pragma endregion
 
-#pragma region ParticleSystem
+#pragma region EffectPool
 public:
-	/** 기존의 ParticlePool을 제거하고, 새로 ParticlePool을 생성하여 초기화하는 함수입니다. */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	void InitializeParticlePool();
+	/** 기존의 EffectPool을 제거하고, 데이터 테이블의 설정 값으로 EffectPool을 생성하여 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	void InitializeEffectPool();
 
-	/** 모든 ParticlePool을 제거하는 함수입니다. */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	void ClearAllParticlePool();
+	/** 모든 EffectPool을 제거하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	void ClearAllEffectPool();
 
 	/**
-	 * ParticleEffect를 지정한 위치에 Spawn하는 함수입니다.
+	 * 이펙트를 지정한 위치에 Spawn하는 함수입니다.
 	 *
-	 * @param SpawnEffect Spawn할 ParticleEffect
-	 * @param Location ParticleEffect를 생성할 위치
-	 * @param Rotation ParticleEffect에 적용한 회전 값
-	 * @param Scale ParticleEffect에 적용할 크기
-	 * @param bEffectAutoActivate true일 경우 ParticleEffect를 Spawn하자마다 ParticleEffect를 실행합니다. false일 경우 ParticleEffect를 실행하지 않습니다.
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Location 이펙트를 생성할 위치
+	 * @param Rotation 이펙트에 적용한 회전 값
+	 * @param Scale 이펙트에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 이펙트를 Spawn하자마다 이펙트를 실행합니다. false일 경우 이펙트를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
-	 * @return 지정한 위치에 Spawn한 ParticleEffect입니다.
+	 * @return 지정한 위치에 Spawn한 이펙트입니다. 요청이 다른 요청의 이펙트에 병합되었을 경우 그 이펙트는 다른 요청이 소유하므로 반환하지 않고 nullptr을 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	APRParticleEffect* SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APREffect* SpawnEffectAtLocation(UFXSystemAsset* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
 	
 	/**
-	 * ParticleEffect를 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 * 이펙트를 지정한 Component에 부착하여 Spawn하는 함수입니다.
 	 *
-	 * @param SpawnEffect Spawn할 ParticleEffect
-	 * @param Parent ParticleEffect를 부착할 Component
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Parent 이펙트를 부착할 Component
 	 * @param AttachSocketName 부착할 소켓의 이름
-	 * @param Location ParticleEffect를 생성할 위치
-	 * @param Rotation ParticleEffect에 적용한 회전 값
-	 * @param Scale ParticleEffect에 적용할 크기
-	 * @param bEffectAutoActivate true일 경우 ParticleEffect를 Spawn하자마다 ParticleEffect를 실행합니다. false일 경우 ParticleEffect를 실행하지 않습니다.
+	 * @param Location 이펙트를 생성할 위치
+	 * @param Rotation 이펙트에 적용한 회전 값
+	 * @param Scale 이펙트에 적용할 크기
+	 * @param bEffectAutoActivate true일 경우 이펙트를 Spawn하자마다 이펙트를 실행합니다. false일 경우 이펙트를 실행하지 않습니다.
 	 * @param bReset 처음부터 다시 재생할지 여부
-	 * @return 지정한 Component에 부착하여 Spawn한 ParticleEffect입니다.
+	 * @return 지정한 Component에 부착하여 Spawn한 이펙트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APREffect* SpawnEffectAttached(UFXSystemAsset* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/** NiagaraSystem을 SpawnEffectAtLocation으로 Spawn하여 NiagaraEffect로 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APRNiagaraEffect* SpawnNiagaraEffectAtLocation(UNiagaraSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/** NiagaraSystem을 SpawnEffectAttached로 Spawn하여 NiagaraEffect로 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APRNiagaraEffect* SpawnNiagaraEffectAttached(UNiagaraSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/** ParticleSystem을 SpawnEffectAtLocation으로 Spawn하여 ParticleEffect로 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APRParticleEffect* SpawnParticleEffectAtLocation(UParticleSystem* SpawnEffect, FVector Location, FRotator Rotation = FRotator::ZeroRotator, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
+
+	/** ParticleSystem을 SpawnEffectAttached로 Spawn하여 ParticleEffect로 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
 	APRParticleEffect* SpawnParticleEffectAttached(UParticleSystem* SpawnEffect, USceneComponent* Parent, FName AttachSocketName, FVector Location, FRotator Rotation, FVector Scale = FVector(1.0f), bool bEffectAutoActivate = true, bool bReset = false);
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 활성화할 수 있는 ParticleEffect를 반환하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 활성화할 수 있는 이펙트를 반환하는 함수입니다.
 	 *
-	 * @param ParticleSystem 활성화할 수 있는 ParticleEffect를 찾을 ParticleSystem입니다.
-	 * @return 활성화할 수 있는 ParticleEffect입니다.
+	 * @param EffectAsset 활성화할 수 있는 이펙트를 찾을 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 활성화할 수 있는 이펙트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	APRParticleEffect* GetActivateableParticleEffect(UParticleSystem* ParticleSystem);
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	APREffect* GetActivateableEffect(UFXSystemAsset* EffectAsset);
 	
 	/**
-	 * 주어진 ParticleEffect가 활성화되어 있는지 확인하는 함수입니다.
+	 * 주어진 이펙트가 활성화되어 있는지 확인하는 함수입니다.
 	 * 
-	 * @param ParticleEffect 확인할 ParticleEffect입니다.
-	 * @return ParticleEffect가 활성화되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다. 
+	 * @param Effect 확인할 이펙트입니다.
+	 * @return 이펙트가 활성화되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다. 
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	bool IsActivateParticleEffect(APRParticleEffect* ParticleEffect) const;
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	bool IsActivateEffect(APREffect* Effect) const;
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 ParticlePool이 생성되어 있는지 확인하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 EffectPool이 생성되어 있는지 확인하는 함수입니다.
 	 * 
-	 * @param ParticleSystem 확인할 ParticleSystem입니다.
-	 * @return ParticlePool이 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
+	 * @param EffectAsset 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return EffectPool이 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	bool IsCreateParticlePool(UParticleSystem* ParticleSystem) const;	
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	bool IsCreateEffectPool(UFXSystemAsset* EffectAsset) const;	
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 ActivateParticleIndexList가 생성되어 있는지 확인하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 ActivateEffectIndexList가 생성되어 있는지 확인하는 함수입니다.
 	 * 
-	 * @param ParticleSystem 확인할 ParticleSystem입니다.
-	 * @return ActivateParticleIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
+	 * @param EffectAsset 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return ActivateEffectIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	bool IsCreateActivateParticleIndexList(UParticleSystem* ParticleSystem) const;
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	bool IsCreateActivateEffectIndexList(UFXSystemAsset* EffectAsset) const;
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 UsedParticleIndexList가 생성되어 있는지 확인하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 UsedEffectIndexList가 생성되어 있는지 확인하는 함수입니다.
 	 * 
-	 * @param ParticleSystem 확인할 ParticleSystem입니다.
-	 * @return UsedParticleIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
+	 * @param EffectAsset 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return UsedEffectIndexList가 생성되어 있으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	bool IsCreateUsedParticleIndexList(UParticleSystem* ParticleSystem) const;
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	bool IsCreateUsedEffectIndexList(UFXSystemAsset* EffectAsset) const;
 
 	/**
-	 * 주어진 ParticleEffect가 동적으로 생성되었는지 확인하는 함수입니다.
+	 * 주어진 이펙트가 동적으로 생성되었는지 확인하는 함수입니다.
 	 * 
-	 * @param ParticleEffect 확인할 ParticleEffect입니다.
-	 * @return ParticleEffect가 동적으로 생성되었으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
+	 * @param Effect 확인할 이펙트입니다.
+	 * @return 이펙트가 동적으로 생성되었으면 true를 반환합니다. 그렇지 않으면 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleSystem")
-	bool IsDynamicParticleEffect(APRParticleEffect* ParticleEffect) const;
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	bool IsDynamicEffect(APREffect* Effect) const;
+
+	/**
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 이펙트의 설정 값을 데이터 테이블에서 가져오는 함수입니다.
+	 *
+	 * @param EffectAsset 데이터 테이블에서 설정 값을 가져올 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 데이터 테이블에 해당하는 이펙트의 설정 값이 있으면 반환합니다. 그렇지 않으면 기본 값을 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|EffectPool")
+	FPREffectPoolSettings GetEffectPoolSettingsFromDataTable(UFXSystemAsset* EffectAsset) const; 
 
 private:
 	/**
-	 * 주어진 ParticlePool을 제거하는 함수입니다.
+	 * 주어진 EffectPool을 제거하는 함수입니다.
 	 * 
-	 * @param TargetParticlePool 제거할 ParticlePool입니다.
+	 * @param TargetEffectPool 제거할 EffectPool입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	void ClearParticlePool(FPRParticleEffectObjectPool& TargetParticlePool);
+	void ClearEffectPool(FPREffectObjectPool& TargetEffectPool);
 	
 	/**
-	 * 주어진 ParticlePool의 설정 값을 바탕으로 ParticlePool을 생성하는 함수입니다.
+	 * 주어진 EffectPool의 설정 값을 바탕으로 EffectPool을 생성하는 함수입니다.
 	 *
-	 * @param ParticlePoolSettings ParticlePool을 생성할 설정 값입니다.
+	 * @param EffectPoolSettings EffectPool을 생성할 설정 값입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	void CreateParticlePool(const FPRParticleEffectPoolSettings& ParticlePoolSettings);
+	void CreateEffectPool(const FPREffectPoolSettings& EffectPoolSettings);
 
 	/**
-	 * 주어진 ParticleSystem의 ActivateParticleIndexList를 생성하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem의 ActivateEffectIndexList를 생성하는 함수입니다.
 	 *
-	 * @param ParticleSystem ActivateParticleIndexList를 생성할 ParticleSystem입니다. 
+	 * @param EffectAsset ActivateEffectIndexList를 생성할 NiagaraSystem 또는 ParticleSystem입니다. 
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	void CreateActivateParticleIndexList(UParticleSystem* ParticleSystem);
+	void CreateActivateEffectIndexList(UFXSystemAsset* EffectAsset);
 
 	/**
-	 * 주어진 ParticleSystem의 UsedParticleIndexList를 생성하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem의 UsedEffectIndexList를 생성하는 함수입니다.
 	 *
-	 * @param ParticleSystem UsedParticleIndexList를 생성할 ParticleSystem입니다. 
+	 * @param EffectAsset UsedEffectIndexList를 생성할 NiagaraSystem 또는 ParticleSystem입니다. 
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	void CreateUsedParticleIndexList(UParticleSystem* ParticleSystem);	
+	void CreateUsedEffectIndexList(UFXSystemAsset* EffectAsset);	
 
 	/**
-	 * 주어진 ParticleSystem을 월드에 PRParticleEffect로 Spawn하는 함수입니다.
+	 * 주어진 NiagaraSystem은 PRNiagaraEffect로, ParticleSystem은 PRParticleEffect로 월드에 Spawn하는 함수입니다.
 	 *
-	 * @param ParticleSystem 월드에 Spawn할 ParticleSystem입니다.
-	 * @param PoolIndex 월드에 Spawn한 ParticleSystem이 ParticlePool에서 사용하는 Index 값입니다. 
-	 * @param Lifespan PRParticleEffect의 수명입니다.
-	 * @return 월드에 Spawn PRParticleEffect입니다.
+	 * @param EffectAsset 월드에 Spawn할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param PoolIndex 월드에 Spawn한 이펙트가 EffectPool에서 사용하는 Index 값입니다. 
+	 * @param Lifespan 이펙트의 수명입니다.
+	 * @return 월드에 Spawn한 이펙트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	APRParticleEffect* SpawnParticleEffectInWorld(UParticleSystem* ParticleSystem, int32 PoolIndex, float Lifespan);
+	APREffect* SpawnEffectInWorld(UFXSystemAsset* EffectAsset, int32 PoolIndex, float Lifespan);
 
 	/**
-	 * 주어진 ParticleSystem을 월드에 동적으로 Spawn하는 함수입니다.
-	 * 동적으로 Spawn한 ParticleSystem은 비활성화된 후 일정시간이 지나면 제거됩니다.
-	 * 
-	 * @param ParticleSystem 월드에 동적으로 Spawn할 ParticleSystem입니다.
-	 * @return 월드에 동적으로 Spawn한 ParticleEffect입니다.
+	 * 주어진 이펙트를 NiagaraSystem 또는 ParticleSystem으로 초기화하고 비활성화 델리게이트를 바인딩하는 함수입니다.
+	 *
+	 * @param Effect 초기화할 이펙트입니다.
+	 * @param EffectAsset 이펙트가 사용할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param PoolIndex 이펙트가 EffectPool에서 사용하는 Index 값입니다.
+	 * @param Lifespan 이펙트의 수명입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	APRParticleEffect* SpawnDynamicParticleEffectInWorld(UParticleSystem* ParticleSystem);	
+	void InitializePooledEffect(APREffect* Effect, UFXSystemAsset* EffectAsset, int32 PoolIndex, float Lifespan);
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 ParticleEffect를 초기화한 후 반환하는 함수입니다.
+	 * 레벨에 미리 배치된 이펙트를 다시 초기화하지 않고 소유자와 Index를 설정한 후 비활성화 델리게이트를 바인딩하는 함수입니다.
+	 *
+	 * @param BakedEffect Pool에 추가할 미리 배치된 이펙트입니다.
+	 * @param PoolIndex 이펙트가 EffectPool에서 사용하는 Index 값입니다.
+	 */
+	void AdoptBakedEffect(APREffect* BakedEffect, int32 PoolIndex);
+
+	/**
+	 * 주어진 NiagaraSystem 또는 ParticleSystem을 월드에 동적으로 Spawn하는 함수입니다.
+	 * 동적으로 Spawn한 이펙트는 비활성화된 후 일정시간이 지나면 제거됩니다.
 	 * 
-	 * @param SpawnEffect 초기화할 ParticleEffect의 ParticleSystem입니다.
-	 * @return 초기화된 ParticleEffect입니다.
+	 * @param EffectAsset 월드에 동적으로 Spawn할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 월드에 동적으로 Spawn한 이펙트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	APRParticleEffect* InitializeParticleEffect(UParticleSystem* SpawnEffect);
+	APREffect* SpawnDynamicEffectInWorld(UFXSystemAsset* EffectAsset);	
 
 	/**
-	 * 주어진 동적으로 생성한 ParticleEffect를 제거하는 함수입니다.
+	 * 주어진 NiagaraSystem 또는 ParticleSystem에 해당하는 이펙트를 초기화한 후 반환하는 함수입니다.
 	 * 
-	 * @param TargetDynamicDestroyParticleEffectList 제거할 동적으로 생성한 ParticleEffect의 목록입니다.
+	 * @param SpawnEffect 초기화할 이펙트의 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 초기화된 이펙트입니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PRObjectPoolSystem|ParticleSystem")
-	void ClearDynamicDestroyParticleList(FPRDynamicDestroyParticleEffectList& TargetDynamicDestroyParticleEffectList);
+	APREffect* InitializeEffect(UFXSystemAsset* SpawnEffect);
 
 	/**
-	 * 주어진 ParticleSystem에 해당하는 ParticleEffect의 설정 값을 데이터 테이블에서 가져오는 함수입니다.
+	 * 모든 Spawn 요청이 거치는 단일 진입점으로, Spawn 확률과 Significance, 프레임당 Spawn 예산을 순서대로 적용하는 함수입니다.
+	 * Spawn 확률은 부착하지 않는 이펙트에만, 요청할 때 한 번만 적용합니다.
 	 *
-	 * @param ParticleSystem 데이터 테이블에서 설정 값을 가져올 ParticleSystem입니다.
-	 * @return 데이터 테이블에 해당하는 ParticleEffect의 설정 값이 있으면 반환합니다. 그렇지 않으면 기본 값을 반환합니다.
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem입니다. Downgrade일 경우 가벼운 이펙트로 바뀝니다.
+	 * @param Location 이펙트를 생성할 위치입니다.
+	 * @param Rotation 이펙트에 적용할 회전 값입니다.
+	 * @param Scale 이펙트에 적용할 크기입니다.
+	 * @param AttachParent 이펙트를 부착할 Component입니다. 부착하지 않을 경우 nullptr입니다.
+	 * @param bEffectAutoActivate 이펙트를 Spawn하자마자 실행할지 여부입니다.
+	 * @param bReset 처음부터 다시 재생할지 여부입니다.
+	 * @return 지금 Spawn해야 할 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
 	 */
-	UFUNCTION(BlueprintCallable, Category = "PREffectSystem|ParticleEffect")
-	FPRParticleEffectPoolSettings GetParticleEffectPoolSettingsFromDataTable(UParticleSystem* ParticleSystem) const; 
+	bool CanDispatchEffectSpawn(UFXSystemAsset*& SpawnEffect, const FVector& Location, const FRotator& Rotation, const FVector& Scale, const USceneComponent* AttachParent, bool bEffectAutoActivate, bool bReset);
 
 	/**
-	 * 주어진 ParticleEffect가 비활성화될 때 실행하는 함수입니다.
+	 * 주어진 동적으로 생성한 이펙트를 제거하는 함수입니다.
+	 * 
+	 * @param TargetDynamicDestroyEffectList 제거할 동적으로 생성한 이펙트의 목록입니다.
+	 */
+	void ClearDynamicDestroyEffectList(FPRDynamicDestroyEffectList& TargetDynamicDestroyEffectList);
+
+	/** NiagaraPoolSettingsDataTable과 ParticlePoolSettingsDataTable의 설정 값을 이펙트를 키로 하는 Map에 다시 저장하는 함수입니다. */
+	void RefreshEffectPoolSettingsIndex();
+
+	/**
+	 * 주어진 이펙트가 비활성화될 때 실행하는 함수입니다.
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
 	UFUNCTION()
-	void OnParticleEffectDeactivate(APREffect* TargetEffect);
+	void OnEffectDeactivate(APREffect* TargetEffect);
 
 	/**
-	 * 주어진 동적으로 생성한 ParticleEffect가 비활성화될 때 실행하는 함수입니다.
+	 * 주어진 동적으로 생성한 이펙트가 비활성화될 때 실행하는 함수입니다.
 	 *
 	 * @param TargetEffect 비활성화되는 Effect입니다.
 	 */
 	UFUNCTION()
-	void OnDynamicParticleEffectDeactivate(APREffect* TargetEffect);
+	void OnDynamicEffectDeactivate(APREffect* TargetEffect);
 
 	/**
-	 * 동적으로 생성한 ParticleEffect를 제거하는 함수입니다.
+	 * 동적으로 생성한 이펙트를 제거하는 함수입니다.
 	 *
-	 * @param TargetParticleEffect 제거하는 동적으로 생성된 ParticleEffect입니다.
+	 * @param TargetEffect 제거하는 동적으로 생성된 이펙트입니다.
 	 */
 	UFUNCTION()
-	void OnDynamicParticleEffectDestroy(APRParticleEffect* TargetParticleEffect);
+	void OnDynamicEffectDestroy(APREffect* TargetEffect);
 	
 private:
-	/** ParticleObjectPool의 설정 값을 가진 데이터 테이블입니다. */
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
+	/** NiagaraEffect Pool의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UDataTable> NiagaraPoolSettingsDataTable;
+
+	/** ParticleEffect Pool의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UDataTable> ParticlePoolSettingsDataTable;
+
+	/** 두 데이터 테이블의 설정 값을 NiagaraSystem과 ParticleSystem별로 보관하는 Map입니다. 데이터 테이블을 매번 검색하지 않도록 합니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UFXSystemAsset>, FPREffectPoolSettings> EffectPoolSettingsIndex;
+
+	/** NiagaraPoolSettingsDataTable이 변경될 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle NiagaraPoolSettingsChangedHandle;
+
+	/** ParticlePoolSettingsDataTable이 변경될 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle ParticlePoolSettingsChangedHandle;
 	
-	/** ParticleSystem ObjectPool입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
-	FPRParticleEffectObjectPool ParticlePool;
+	/** NiagaraEffect와 ParticleEffect를 함께 보관하는 ObjectPool입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
+	FPREffectObjectPool EffectPool;
 
-	/** 활성화된 ParticleSystem의 Index 목록입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
-	FPRActivateParticleEffectIndexList ActivateParticleIndexList;
+	/** 활성화된 이펙트의 Index 목록입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
+	FPRActivateEffectIndexList ActivateEffectIndexList;
 
 	/**
-	 * 이전에 사용된 ParticleSystem들의 Index 목록입니다.
-	 * 동적으로 생성하는 ParticleSystem의 Index에 오류가 생기지 않도록 합니다.
+	 * 이전에 사용된 이펙트들의 Index 목록입니다.
+	 * 동적으로 생성하는 이펙트의 Index에 오류가 생기지 않도록 합니다.
 	 */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
-	FPRUsedParticleEffectIndexList UsedParticleIndexList;
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
+	FPRUsedEffectIndexList UsedEffectIndexList;
+
+	/** 동적으로 제거할 이펙트의 목록입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|EffectPool", meta = (AllowPrivateAccess = "true"))
+	FPRDynamicDestroyEffectList DynamicDestroyEffectList;
+
+public:
+	/** NiagaraPoolSettingsDataTable을 반환하는 함수입니다. */
+	FORCEINLINE UDataTable* GetNiagaraPoolSettingsDataTable() const { return NiagaraPoolSettingsDataTable; }
 
-	/** 동적으로 제거할 ParticleSystem의 목록입니다. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffectSystem|ParticleSystem", meta = (AllowPrivateAccess = "true"))
-	FPRDynamicDestroyParticleEffectList DynamicDestroyParticleList;
+	/** ParticlePoolSettingsDataTable을 반환하는 함수입니다. */
+	FORCEINLINE UDataTable* GetParticlePoolSettingsDataTable() const { return ParticlePoolSettingsDataTable; }
 #pragma endregion 
 };
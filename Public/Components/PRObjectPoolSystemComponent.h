@@ -103,6 +103,19 @@ public:
 
 	/** 모든 ObjectPool을 제거하는 함수입니다. */
 	virtual void ClearAllObjectPool() override;
+
+protected:
+	/** Pool이 생성된 후 스트리밍된 레벨의 미리 배치된 오브젝트를 ObjectPool에 추가하는 함수입니다. */
+	virtual void AdoptBakedPoolActors() override;
+
+	/** 주어진 오브젝트 클래스에 해당하는 ObjectPool의 크기를 반환하는 함수입니다. */
+	virtual int32 GetPoolCapacity(UObject* PoolKey) const override;
+
+	/** 주어진 오브젝트 클래스에 해당하는 ObjectPool에서 활성화된 오브젝트의 수를 반환하는 함수입니다. */
+	virtual int32 GetActivatePoolObjectCount(UObject* PoolKey) const override;
+
+	/** 주어진 오브젝트 클래스에 해당하는 ObjectPool에 비활성화된 오브젝트를 하나 추가하는 함수입니다. */
+	virtual UObject* GrowPool(UObject* PoolKey) override;
 #pragma endregion
 
 public:
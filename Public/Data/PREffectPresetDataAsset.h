@@ -0,0 +1,202 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Engine/DataAsset.h"
+#include "Effects/PRNiagaraParameterBlock.h"
+#include "PREffectPresetDataAsset.generated.h"
+
+class UFXSystemAsset;
+class USoundBase;
+class UMaterialInterface;
+class UCameraShakeBase;
+
+/**
+ * 이펙트 프리셋에 포함된 NiagaraSystem 또는 ParticleSystem을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPresetFXEntry
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPresetFXEntry()
+		: FXSystem(nullptr)
+		, LocationOffset(FVector::ZeroVector)
+		, RotationOffset(FRotator::ZeroRotator)
+		, Scale(FVector(1.0f))
+		, NiagaraParameters()
+	{}
+
+public:
+	/** Spawn할 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetFXEntry")
+	TObjectPtr<UFXSystemAsset> FXSystem;
+
+	/** 프리셋의 Transform을 기준으로 한 위치입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetFXEntry")
+	FVector LocationOffset;
+
+	/** 프리셋의 Transform을 기준으로 한 회전 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetFXEntry")
+	FRotator RotationOffset;
+
+	/** 프리셋의 Transform을 기준으로 한 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetFXEntry")
+	FVector Scale;
+
+	/** NiagaraSystem일 경우 활성화하기 전에 적용할 사용자 파라미터입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetFXEntry")
+	FPRNiagaraParameterBlock NiagaraParameters;
+};
+
+/**
+ * 이펙트 프리셋에 포함된 사운드를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPresetSoundEntry
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPresetSoundEntry()
+		: Sound(nullptr)
+		, LocationOffset(FVector::ZeroVector)
+		, VolumeMultiplier(1.0f)
+		, PitchMultiplier(1.0f)
+	{}
+
+public:
+	/** 재생할 사운드입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetSoundEntry")
+	TObjectPtr<USoundBase> Sound;
+
+	/** 프리셋의 Transform을 기준으로 한 위치입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetSoundEntry")
+	FVector LocationOffset;
+
+	/** 볼륨의 배율입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetSoundEntry", meta = (ClampMin = "0.0"))
+	float VolumeMultiplier;
+
+	/** 피치의 배율입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetSoundEntry", meta = (ClampMin = "0.0"))
+	float PitchMultiplier;
+};
+
+/**
+ * 이펙트 프리셋에 포함된 데칼을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPresetDecalEntry
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPresetDecalEntry()
+		: DecalMaterial(nullptr)
+		, LocationOffset(FVector::ZeroVector)
+		, RotationOffset(FRotator(-90.0f, 0.0f, 0.0f))
+		, DecalSize(FVector(10.0f, 50.0f, 50.0f))
+	{}
+
+public:
+	/** 배치할 데칼의 머티리얼입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetDecalEntry")
+	TObjectPtr<UMaterialInterface> DecalMaterial;
+
+	/** 프리셋의 Transform을 기준으로 한 위치입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetDecalEntry")
+	FVector LocationOffset;
+
+	/** 프리셋의 Transform을 기준으로 한 회전 값입니다. 데칼은 X축 방향으로 투영되므로 기본값은 아래 방향입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetDecalEntry")
+	FRotator RotationOffset;
+
+	/** 데칼의 크기입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetDecalEntry")
+	FVector DecalSize;
+};
+
+/**
+ * 이펙트 프리셋에 포함된 카메라 셰이크를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPREffectPresetCameraShakeEntry
+{
+	GENERATED_BODY()
+
+public:
+	FPREffectPresetCameraShakeEntry()
+		: CameraShake(nullptr)
+		, LocationOffset(FVector::ZeroVector)
+		, InnerRadius(0.0f)
+		, OuterRadius(1000.0f)
+		, Falloff(1.0f)
+	{}
+
+public:
+	/** 재생할 카메라 셰이크입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetCameraShakeEntry")
+	TSubclassOf<UCameraShakeBase> CameraShake;
+
+	/** 프리셋의 Transform을 기준으로 한 카메라 셰이크의 중심입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetCameraShakeEntry")
+	FVector LocationOffset;
+
+	/** 카메라 셰이크가 최대 강도로 적용되는 반경입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetCameraShakeEntry", meta = (ClampMin = "0.0"))
+	float InnerRadius;
+
+	/** 카메라 셰이크가 적용되는 최대 반경입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetCameraShakeEntry", meta = (ClampMin = "0.0"))
+	float OuterRadius;
+
+	/** InnerRadius부터 OuterRadius까지 강도가 줄어드는 지수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PREffectPresetCameraShakeEntry", meta = (ClampMin = "0.0"))
+	float Falloff;
+};
+
+/**
+ * 함께 Spawn하는 이펙트, 사운드, 데칼, 카메라 셰이크를 하나로 묶은 DataAsset 클래스입니다.
+ * 모든 에셋을 직접 참조하므로 DataAsset을 로드할 때 함께 로드되며, EffectSystem은 프리셋을 하나의 단위로 Pool에 보관합니다.
+ */
+UCLASS(BlueprintType)
+class PROJECTREPLICA_API UPREffectPresetDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPREffectPresetDataAsset();
+
+public:
+	/** 프리셋에 이펙트, 사운드, 데칼, 카메라 셰이크 중 하나라도 있는지 확인하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffectPreset")
+	bool IsEmpty() const;
+
+public:
+	/** 함께 Spawn할 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset")
+	TArray<FPREffectPresetFXEntry> FXEntries;
+
+	/** 함께 재생할 사운드입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset")
+	TArray<FPREffectPresetSoundEntry> SoundEntries;
+
+	/** 함께 배치할 데칼입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset")
+	TArray<FPREffectPresetDecalEntry> DecalEntries;
+
+	/** 함께 재생할 카메라 셰이크입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset")
+	TArray<FPREffectPresetCameraShakeEntry> CameraShakeEntries;
+
+	/** 프리셋 전체의 수명입니다. 모든 이펙트의 실행이 끝나거나 수명이 다하면 Pool에 반환합니다. 0일 경우 이펙트의 실행이 끝날 때까지 유지합니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset", meta = (ClampMin = "0.0"))
+	float Lifespan;
+
+	/** 미리 생성하여 Pool에 보관할 프리셋의 수입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "PREffectPreset", meta = (ClampMin = "1"))
+	int32 PoolSize;
+};
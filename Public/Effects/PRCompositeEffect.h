@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Effects/PREffect.h"
+#include "PRCompositeEffect.generated.h"
+
+class UPREffectPresetDataAsset;
+class UNiagaraComponent;
+class UParticleSystemComponent;
+
+/**
+ * 이펙트 프리셋의 이펙트, 사운드, 데칼, 카메라 셰이크를 하나의 Transform과 수명으로 실행하는 이펙트 클래스입니다.
+ * 프리셋의 FXSystemComponent들을 초기화할 때 한 번만 생성하고, EffectSystem의 Pool에서 하나의 단위로 재사용합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API APRCompositeEffect : public APREffect
+{
+	GENERATED_BODY()
+
+public:
+	APRCompositeEffect();
+
+public:
+	/**
+	 * 인자로 받은 이펙트 프리셋을 기반으로 CompositeEffect를 초기화하는 함수입니다.
+	 * 프리셋의 NiagaraSystem과 ParticleSystem마다 FXSystemComponent를 생성합니다.
+	 *
+	 * @param NewEffectPreset 사용할 이펙트 프리셋
+	 * @param NewEffectOwner 이펙트의 소유자
+	 * @param NewPoolIndex 이펙트 풀의 Index
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRCompositeEffect")
+	void InitializeCompositeEffect(UPREffectPresetDataAsset* NewEffectPreset, AActor* NewEffectOwner = nullptr, int32 NewPoolIndex = -1);
+
+	/**
+	 * 프리셋의 모든 이펙트를 활성화하고 사운드, 데칼, 카메라 셰이크를 실행하는 함수입니다.
+	 *
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 */
+	virtual void ActivateEffect(bool bReset = false) override;
+
+	/** 프리셋의 모든 이펙트를 비활성화하는 함수입니다. */
+	virtual void DeactivateEffect() override;
+
+	/** 프리셋의 첫 번째 FXSystemComponent를 반환하는 함수입니다. */
+	virtual UFXSystemComponent* GetFXSystemComponent() const override;
+
+private:
+	/** 이펙트 프리셋의 FXSystemComponent들을 생성하는 함수입니다. */
+	void CreateFXSystemComponents();
+
+	/** 이펙트 프리셋의 사운드를 재생하는 함수입니다. */
+	void PlayPresetSounds() const;
+
+	/** 이펙트 프리셋의 데칼을 배치하는 함수입니다. */
+	void PlacePresetDecals() const;
+
+	/** 이펙트 프리셋의 카메라 셰이크를 재생하는 함수입니다. */
+	void PlayPresetCameraShakes() const;
+
+	/**
+	 * NiagaraComponent의 실행이 끝났을 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 NiagaraComponent입니다.
+	 */
+	UFUNCTION()
+	void OnNiagaraSystemFinished(UNiagaraComponent* FinishedComponent);
+
+	/**
+	 * ParticleSystemComponent의 실행이 끝났을 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 ParticleSystemComponent입니다.
+	 */
+	UFUNCTION()
+	void OnParticleSystemFinished(UParticleSystemComponent* FinishedComponent);
+
+	/** FXSystemComponent 하나의 실행이 끝났을 때 실행하는 함수입니다. 모든 실행이 끝나면 Pool에 반환합니다. */
+	void OnFXSystemComponentFinished();
+
+private:
+	/** 프리셋의 FXSystemComponent들을 부착하는 Root입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRCompositeEffect", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<USceneComponent> EffectRoot;
+
+	/** 사용하는 이펙트 프리셋입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRCompositeEffect", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UPREffectPresetDataAsset> EffectPreset;
+
+	/** 프리셋의 FXEntries와 같은 순서로 생성한 FXSystemComponent들입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRCompositeEffect", meta = (AllowPrivateAccess = "true"))
+	TArray<TObjectPtr<UFXSystemComponent>> FXSystemComponents;
+
+	/** 실행 중인 FXSystemComponent의 수입니다. */
+	int32 ActiveFXSystemCount;
+
+public:
+	/** EffectPreset을 반환하는 함수입니다. */
+	FORCEINLINE UPREffectPresetDataAsset* GetEffectPreset() const { return EffectPreset; }
+};
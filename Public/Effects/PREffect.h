@@ -8,6 +8,7 @@
 #include "PREffect.generated.h"
 
 class UFXSystemComponent;
+class UFXSystemAsset;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEffectDeactivate, APREffect*, Effect);
 
@@ -39,6 +40,9 @@ protected:
 	/** 오브젝트의 PoolIndex를 반환하는 함수입니다. */
 	virtual int32 GetPoolIndex_Implementation() const override;
 
+	/** 오브젝트가 활성화된 횟수를 반환하는 함수입니다. */
+	virtual int32 GetActivationCount_Implementation() const override;
+
 	/** 수명을 반환하는 함수입니다. */
 	virtual float GetLifespan_Implementation() const override;
 
@@ -92,6 +96,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PREffect")
 	virtual UFXSystemComponent* GetFXSystemComponent() const; 
 
+	/** FXSystemComponent가 사용하는 NiagaraSystem 또는 ParticleSystem을 반환하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PREffect")
+	UFXSystemAsset* GetEffectAsset() const;
+
+	/**
+	 * 레벨에 미리 배치된 이펙트를 Pool에 추가할 때 다시 초기화하지 않고 소유자와 풀의 Index만 설정하는 함수입니다.
+	 *
+	 * @param NewEffectOwner 이펙트의 소유자
+	 * @param NewPoolIndex 이펙트 풀의 Index
+	 */
+	void SetEffectPoolOwner(AActor* NewEffectOwner, int32 NewPoolIndex);
+
 protected:
 	/**
 	 * 이펙트를 초기화하는 함수입니다.
@@ -110,6 +126,12 @@ protected:
 	UFUNCTION()
 	void OnDeactivate();
 
+	/**
+	 * FXSystemComponent의 실행이 끝났을 때 실행하는 함수입니다.
+	 * 수명이 남아 있어도 이펙트를 비활성화하여 Pool에 반환합니다. 수명은 실행이 끝나지 않는 이펙트의 최대 시간으로 사용됩니다.
+	 */
+	void OnFXSystemFinished();
+
 protected:
 	/** 이펙트의 활성화를 나타내는 변수입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "PREffect")
@@ -131,6 +153,13 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffect")
 	int32 PoolIndex;
 
+	/** 이펙트가 활성화된 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PREffect")
+	int32 ActivationCount;
+
+	/** FXSystemComponent를 활성화하는 중인지 나타내는 변수입니다. 활성화하면서 이전 실행이 끝나 호출되는 OnFXSystemFinished를 무시합니다. */
+	bool bActivatingEffect;
+
 public:
 	/** EffectLifespan을 반환하는 함수입니다. */
 	float GetEffectLifespan() const;
@@ -0,0 +1,218 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "GameFramework/Actor.h"
+#include "PRFXComponentPoolManager.generated.h"
+
+class UFXSystemAsset;
+class UFXSystemComponent;
+class UNiagaraComponent;
+class UParticleSystemComponent;
+struct FPRNiagaraParameterBlock;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnFXComponentDeactivate, UFXSystemComponent*, FXComponent);
+
+/**
+ * FXComponentPool에 보관된 비활성화된 FXComponent의 목록을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRFXComponentPool
+{
+	GENERATED_BODY()
+
+public:
+	FPRFXComponentPool()
+		: FreeComponents()
+		, ComponentCount(0)
+	{}
+
+public:
+	/** 사용할 수 있는 비활성화된 FXComponent들의 Array입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFXComponentPool")
+	TArray<TObjectPtr<UFXSystemComponent>> FreeComponents;
+
+	/** 이펙트를 위해 생성한 사용 중이거나 비활성화된 모든 FXComponent의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFXComponentPool")
+	int32 ComponentCount;
+};
+
+/**
+ * 사용 중인 FXComponent의 정보를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRActiveFXComponent
+{
+	GENERATED_BODY()
+
+public:
+	FPRActiveFXComponent()
+		: EffectAsset(nullptr)
+		, LifespanTimerHandle()
+	{}
+
+public:
+	/** FXComponent가 사용하는 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRActiveFXComponent")
+	TObjectPtr<UFXSystemAsset> EffectAsset;
+
+	/** FXComponent의 수명을 관리하는 TimerHandle입니다. */
+	UPROPERTY(BlueprintReadOnly, Category = "PRActiveFXComponent")
+	FTimerHandle LifespanTimerHandle;
+};
+
+/**
+ * 이펙트마다 액터를 생성하지 않고 NiagaraComponent와 ParticleSystemComponent를 직접 풀링하는 Actor 클래스입니다.
+ * 월드마다 하나만 존재하며, 모든 FXComponent를 소유하고 위치 지정, 부착, 활성화와 수명을 관리합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API APRFXComponentPoolManager : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APRFXComponentPoolManager();
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	/**
+	 * 주어진 월드의 FXComponentPoolManager를 반환하는 함수입니다. 월드에 없을 경우 생성합니다.
+	 *
+	 * @param WorldContextObject FXComponentPoolManager를 찾을 월드의 오브젝트입니다.
+	 * @return 월드의 FXComponentPoolManager입니다.
+	 */
+	static APRFXComponentPoolManager* GetFXComponentPoolManager(const UObject* WorldContextObject);
+
+	/**
+	 * 주어진 이펙트의 FXComponent를 지정한 위치에 Spawn하는 함수입니다.
+	 *
+	 * @param EffectAsset Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Location FXComponent를 생성할 위치
+	 * @param Rotation FXComponent에 적용할 회전 값
+	 * @param Scale FXComponent에 적용할 크기
+	 * @param bAutoActivate true일 경우 FXComponent를 Spawn하자마자 실행합니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param Lifespan FXComponent의 수명입니다. 0보다 작거나 같을 경우 실행이 끝날 때까지 유지합니다.
+	 * @param MaxPoolSize 이펙트 하나가 가질 수 있는 최대 FXComponent의 수입니다. 0보다 작거나 같을 경우 제한하지 않습니다.
+	 * @param Parameters 실행하기 전에 NiagaraComponent에 적용할 사용자 파라미터입니다.
+	 * @return 지정한 위치에 Spawn한 FXComponent입니다. 최대 수만큼 사용 중일 경우 nullptr을 반환합니다.
+	 */
+	UFXSystemComponent* SpawnFXComponentAtLocation(UFXSystemAsset* EffectAsset, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAutoActivate, bool bReset, float Lifespan, int32 MaxPoolSize = 0, const FPRNiagaraParameterBlock* Parameters = nullptr);
+
+	/**
+	 * 주어진 이펙트의 FXComponent를 지정한 Component에 부착하여 Spawn하는 함수입니다.
+	 *
+	 * @param EffectAsset Spawn할 NiagaraSystem 또는 ParticleSystem
+	 * @param Parent FXComponent를 부착할 Component
+	 * @param AttachSocketName 부착할 소켓의 이름
+	 * @param Location 소켓의 위치에 더할 위치
+	 * @param Rotation 소켓의 회전 값에 합성할 회전 값
+	 * @param Scale FXComponent에 적용할 크기
+	 * @param bAutoActivate true일 경우 FXComponent를 Spawn하자마자 실행합니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param Lifespan FXComponent의 수명입니다. 0보다 작거나 같을 경우 실행이 끝날 때까지 유지합니다.
+	 * @param MaxPoolSize 이펙트 하나가 가질 수 있는 최대 FXComponent의 수입니다. 0보다 작거나 같을 경우 제한하지 않습니다.
+	 * @param Parameters 실행하기 전에 NiagaraComponent에 적용할 사용자 파라미터입니다.
+	 * @return 지정한 Component에 부착하여 Spawn한 FXComponent입니다. 최대 수만큼 사용 중일 경우 nullptr을 반환합니다.
+	 */
+	UFXSystemComponent* SpawnFXComponentAttached(UFXSystemAsset* EffectAsset, USceneComponent* Parent, FName AttachSocketName, const FVector& Location, const FRotator& Rotation, const FVector& Scale, bool bAutoActivate, bool bReset, float Lifespan, int32 MaxPoolSize = 0, const FPRNiagaraParameterBlock* Parameters = nullptr);
+
+	/**
+	 * 주어진 FXComponent를 즉시 비활성화하여 Pool에 반환하는 함수입니다.
+	 *
+	 * @param FXComponent 반환할 FXComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRFXComponentPoolManager")
+	void ReleaseFXComponent(UFXSystemComponent* FXComponent);
+
+	/**
+	 * 주어진 이펙트의 비활성화된 FXComponent를 미리 생성하는 함수입니다.
+	 *
+	 * @param EffectAsset FXComponent를 생성할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param PoolSize Pool에 보관할 FXComponent의 수입니다.
+	 */
+	void PrewarmFXComponents(UFXSystemAsset* EffectAsset, int32 PoolSize);
+
+	/**
+	 * 주어진 FXComponent가 이 Manager에서 사용 중인지 확인하는 함수입니다.
+	 *
+	 * @param FXComponent 확인할 FXComponent입니다.
+	 * @return 사용 중일 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRFXComponentPoolManager")
+	bool IsActiveFXComponent(UFXSystemComponent* FXComponent) const;
+
+	/** 사용 중인 FXComponent를 모두 반환하고 Pool을 제거하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRFXComponentPoolManager")
+	void ClearAllFXComponentPool();
+
+private:
+	/**
+	 * 주어진 이펙트의 비활성화된 FXComponent를 Pool에서 가져오는 함수입니다. Pool이 비어있을 경우 최대 수까지 새로 생성합니다.
+	 *
+	 * @param EffectAsset 가져올 FXComponent의 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param MaxPoolSize 이펙트 하나가 가질 수 있는 최대 FXComponent의 수입니다. 0보다 작거나 같을 경우 제한하지 않습니다.
+	 * @return 비활성화된 FXComponent입니다. 최대 수만큼 사용 중일 경우 nullptr을 반환합니다.
+	 */
+	UFXSystemComponent* AcquireFXComponent(UFXSystemAsset* EffectAsset, int32 MaxPoolSize);
+
+	/**
+	 * 주어진 이펙트를 사용하는 비활성화된 FXComponent를 생성하는 함수입니다.
+	 *
+	 * @param EffectAsset FXComponent가 사용할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @return 생성한 FXComponent입니다.
+	 */
+	UFXSystemComponent* CreateFXComponent(UFXSystemAsset* EffectAsset);
+
+	/**
+	 * 위치를 지정한 FXComponent를 사용 중으로 등록하고 실행하는 함수입니다.
+	 *
+	 * @param FXComponent 실행할 FXComponent
+	 * @param EffectAsset FXComponent가 사용하는 NiagaraSystem 또는 ParticleSystem
+	 * @param bAutoActivate true일 경우 FXComponent를 실행합니다.
+	 * @param bReset 처음부터 다시 재생할지 여부
+	 * @param Lifespan FXComponent의 수명
+	 * @param Parameters 실행하기 전에 NiagaraComponent에 적용할 사용자 파라미터
+	 */
+	void ActivateFXComponent(UFXSystemComponent* FXComponent, UFXSystemAsset* EffectAsset, bool bAutoActivate, bool bReset, float Lifespan, const FPRNiagaraParameterBlock* Parameters);
+
+	/**
+	 * FXComponent의 수명이 끝날 때 실행하는 함수입니다. 남은 파티클이 사라진 후 Pool에 반환됩니다.
+	 *
+	 * @param FXComponent 수명이 끝난 FXComponent입니다.
+	 */
+	void OnFXComponentLifespanEnd(UFXSystemComponent* FXComponent);
+
+	/**
+	 * NiagaraComponent의 실행이 끝날 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 NiagaraComponent입니다.
+	 */
+	UFUNCTION()
+	void OnNiagaraComponentFinished(UNiagaraComponent* FinishedComponent);
+
+	/**
+	 * ParticleSystemComponent의 실행이 끝날 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 ParticleSystemComponent입니다.
+	 */
+	UFUNCTION()
+	void OnParticleSystemComponentFinished(UParticleSystemComponent* FinishedComponent);
+
+private:
+	/** 이펙트별로 비활성화된 FXComponent를 보관하는 Map입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFXComponentPoolManager", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UFXSystemAsset>, FPRFXComponentPool> FXComponentPool;
+
+	/** 사용 중인 FXComponent와 정보를 보관하는 Map입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFXComponentPoolManager", meta = (AllowPrivateAccess = "true"))
+	TMap<TObjectPtr<UFXSystemComponent>, FPRActiveFXComponent> ActiveFXComponents;
+
+public:
+	/** FXComponent가 비활성화되어 Pool에 반환될 때 실행하는 델리게이트입니다. */
+	UPROPERTY(BlueprintAssignable, Category = "PRFXComponentPoolManager")
+	FOnFXComponentDeactivate OnFXComponentDeactivateDelegate;
+};
@@ -20,6 +20,9 @@ class PROJECTREPLICA_API APRNiagaraEffect : public APREffect
 public:
 	APRNiagaraEffect();
 
+protected:
+	virtual void PostInitializeComponents() override;
+
 public:
 	/**
 	 * 인자로 받은 NiagaraSystem을 기반으로 NiagaraEffect를 초기화하는 함수입니다.
@@ -49,6 +52,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PRNiagaraEffect")
 	UNiagaraSystem* GetNiagaraEffectAsset() const;
 	
+private:
+	/**
+	 * NiagaraEffect의 실행이 끝났을 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 NiagaraEffect입니다.
+	 */
+	UFUNCTION()
+	void OnNiagaraSystemFinished(UNiagaraComponent* FinishedComponent);
+
 private:
 	/** Spawn한 NiagaraEffect입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRNiagaraEffect", meta = (AllowPrivateAccess = "true"))
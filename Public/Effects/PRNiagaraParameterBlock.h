@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Common/PRCommonEnum.h"
+#include "PRNiagaraParameterBlock.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
+struct FNiagaraUserRedirectionParameterStore;
+
+/**
+ * NiagaraSystem의 사용자 파라미터 하나의 이름과 값을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRNiagaraParameter
+{
+	GENERATED_BODY()
+
+public:
+	FPRNiagaraParameter()
+		: ParameterName(NAME_None)
+		, ParameterType(EPRNiagaraParameterType::NiagaraParameterType_Float)
+		, FloatValue(0.0f)
+		, VectorValue(FVector::ZeroVector)
+		, LinearColorValue(FLinearColor::White)
+		, ObjectValue(nullptr)
+	{}
+
+	FPRNiagaraParameter(FName NewParameterName, EPRNiagaraParameterType NewParameterType)
+		: ParameterName(NewParameterName)
+		, ParameterType(NewParameterType)
+		, FloatValue(0.0f)
+		, VectorValue(FVector::ZeroVector)
+		, LinearColorValue(FLinearColor::White)
+		, ObjectValue(nullptr)
+	{}
+
+public:
+	/** 사용자 파라미터의 이름입니다. User. 접두사는 생략할 수 있습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	FName ParameterName;
+
+	/** 사용자 파라미터의 타입입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	EPRNiagaraParameterType ParameterType;
+
+	/** Float 타입일 경우 전달할 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	float FloatValue;
+
+	/** Vector 타입일 경우 전달할 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	FVector VectorValue;
+
+	/** LinearColor 타입일 경우 전달할 값입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	FLinearColor LinearColorValue;
+
+	/** StaticMesh 또는 StaticMeshComponent 타입일 경우 전달할 오브젝트입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameter")
+	TObjectPtr<UObject> ObjectValue;
+};
+
+/**
+ * NiagaraSystem별로 미리 찾아 둔 사용자 파라미터의 Offset을 나타내는 구조체입니다.
+ */
+struct FPRNiagaraParameterBindings
+{
+public:
+	FPRNiagaraParameterBindings()
+		: Offsets()
+		, LayoutVariableCount(INDEX_NONE)
+		, LayoutDataSize(INDEX_NONE)
+	{}
+
+public:
+	/** 파라미터 블록의 순서대로 저장한 OverrideParameters의 Offset입니다. 찾지 못한 파라미터는 INDEX_NONE입니다. */
+	TArray<int32> Offsets;
+
+	/** Offset을 찾을 때 OverrideParameters의 변수 수입니다. 달라지면 Offset을 다시 찾습니다. */
+	int32 LayoutVariableCount;
+
+	/** Offset을 찾을 때 OverrideParameters의 데이터 크기입니다. 달라지면 Offset을 다시 찾습니다. */
+	int32 LayoutDataSize;
+};
+
+/**
+ * NiagaraComponent를 활성화하기 전에 한 번에 적용할 사용자 파라미터의 목록을 나타내는 구조체입니다.
+ * 파라미터의 Offset을 NiagaraSystem별로 한 번만 찾아 저장하므로 Spawn하거나 Tick마다 이름으로 파라미터를 찾지 않습니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct PROJECTREPLICA_API FPRNiagaraParameterBlock
+{
+	GENERATED_BODY()
+
+public:
+	FPRNiagaraParameterBlock()
+		: Parameters()
+	{}
+
+public:
+	/** 주어진 이름의 Float 파라미터의 값을 설정하는 함수입니다. */
+	void SetFloatParameter(FName ParameterName, float Value);
+
+	/** 주어진 이름의 Vector 파라미터의 값을 설정하는 함수입니다. */
+	void SetVectorParameter(FName ParameterName, const FVector& Value);
+
+	/** 주어진 이름의 LinearColor 파라미터의 값을 설정하는 함수입니다. */
+	void SetLinearColorParameter(FName ParameterName, const FLinearColor& Value);
+
+	/** 주어진 이름의 StaticMesh 오브젝트 파라미터의 값을 설정하는 함수입니다. */
+	void SetStaticMeshParameter(FName ParameterName, UStaticMesh* Value);
+
+	/** 주어진 이름의 StaticMesh DataInterface가 사용할 StaticMeshComponent를 설정하는 함수입니다. */
+	void SetStaticMeshComponentParameter(FName ParameterName, UStaticMeshComponent* Value);
+
+	/**
+	 * 파라미터 블록을 주어진 NiagaraComponent의 OverrideParameters에 적용하는 함수입니다.
+	 * 값이 바뀌지 않은 파라미터는 다시 쓰지 않습니다.
+	 *
+	 * @param NiagaraComponent 파라미터를 적용할 NiagaraComponent입니다.
+	 */
+	void ApplyToComponent(UNiagaraComponent* NiagaraComponent) const;
+
+	/** 파라미터가 없는지 확인하는 함수입니다. */
+	bool IsEmpty() const;
+
+private:
+	/**
+	 * 주어진 이름과 타입의 파라미터를 찾고, 없으면 추가하는 함수입니다.
+	 *
+	 * @param ParameterName 찾을 파라미터의 이름
+	 * @param ParameterType 찾을 파라미터의 타입
+	 * @return 찾거나 추가한 파라미터입니다.
+	 */
+	FPRNiagaraParameter& FindOrAddParameter(FName ParameterName, EPRNiagaraParameterType ParameterType);
+
+	/**
+	 * 주어진 NiagaraSystem의 파라미터 Offset을 반환하는 함수입니다. 저장된 Offset이 없거나 OverrideParameters의 구성이 바뀌었으면 다시 찾습니다.
+	 *
+	 * @param NiagaraSystem Offset을 찾을 NiagaraSystem
+	 * @param OverrideParameters Offset을 찾을 NiagaraComponent의 OverrideParameters
+	 * @return 파라미터 블록의 순서대로 저장한 Offset입니다.
+	 */
+	const FPRNiagaraParameterBindings& ResolveBindings(const UNiagaraSystem* NiagaraSystem, const FNiagaraUserRedirectionParameterStore& OverrideParameters) const;
+
+public:
+	/** 적용할 사용자 파라미터의 목록입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRNiagaraParameterBlock")
+	TArray<FPRNiagaraParameter> Parameters;
+
+private:
+	/** NiagaraSystem별로 미리 찾아 둔 파라미터의 Offset입니다. */
+	mutable TMap<TWeakObjectPtr<const UNiagaraSystem>, FPRNiagaraParameterBindings> CachedBindings;
+};
@@ -20,6 +20,9 @@ class PROJECTREPLICA_API APRParticleEffect : public APREffect
 public:
 	APRParticleEffect();
 
+protected:
+	virtual void PostInitializeComponents() override;
+
 public:
 	/**
 	 * 인자로 받은 ParticleSystem을 기반으로 ParticleEffect를 초기화하는 함수입니다.
@@ -49,6 +52,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PRParticleEffect")
 	UParticleSystem* GetParticleEffectAsset() const;
 	
+private:
+	/**
+	 * ParticleEffect의 실행이 끝났을 때 실행하는 함수입니다.
+	 *
+	 * @param FinishedComponent 실행이 끝난 ParticleEffect입니다.
+	 */
+	UFUNCTION()
+	void OnParticleSystemFinished(UParticleSystemComponent* FinishedComponent);
+
 private:
 	/** Spawn한 ParticleEffect입니다. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRParticleEffect", meta = (AllowPrivateAccess = "true"))
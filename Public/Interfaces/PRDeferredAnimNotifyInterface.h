@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Common/PRCommonEnum.h"
+#include "PRDeferredAnimNotifyInterface.generated.h"
+
+class USkeletalMeshComponent;
+class UAnimSequenceBase;
+
+/**
+ * AnimNotify를 실행하기 전에 캐릭터의 Significance로 실행 여부를 결정하는 설정을 나타내는 구조체입니다.
+ * Significance는 캐릭터가 카메라에 가깝고 렌더링되었을수록 1에 가까우며, 멀거나 화면 밖일수록 0에 가깝습니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAnimNotifySignificanceSettings
+{
+	GENERATED_BODY()
+
+public:
+	FPRAnimNotifySignificanceSettings()
+		: bAlwaysExecute(false)
+		, MinSignificance(0.0f)
+		, ReducedRateSignificance(0.0f)
+		, ReducedRateInterval(1)
+	{}
+
+	FPRAnimNotifySignificanceSettings(bool bNewAlwaysExecute, float NewMinSignificance, float NewReducedRateSignificance, int32 NewReducedRateInterval)
+		: bAlwaysExecute(bNewAlwaysExecute)
+		, MinSignificance(NewMinSignificance)
+		, ReducedRateSignificance(NewReducedRateSignificance)
+		, ReducedRateInterval(NewReducedRateInterval)
+	{}
+
+public:
+	/** true일 경우 Significance와 관계없이 항상 실행합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAnimNotifySignificanceSettings")
+	bool bAlwaysExecute;
+
+	/** 캐릭터의 Significance가 이 값보다 낮을 경우 실행하지 않습니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAnimNotifySignificanceSettings", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "!bAlwaysExecute"))
+	float MinSignificance;
+
+	/** 캐릭터의 Significance가 이 값보다 낮을 경우 ReducedRateInterval번 중 한 번만 실행합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAnimNotifySignificanceSettings", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "!bAlwaysExecute"))
+	float ReducedRateSignificance;
+
+	/** Significance가 ReducedRateSignificance보다 낮을 때 실행하는 간격입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAnimNotifySignificanceSettings", meta = (ClampMin = "1", EditCondition = "!bAlwaysExecute"))
+	int32 ReducedRateInterval;
+};
+
+/**
+ * AnimNotifyDispatchSubsystem의 큐에 저장하는 AnimNotify 명령을 나타내는 구조체입니다.
+ */
+struct FPRAnimNotifyCommand
+{
+public:
+	FPRAnimNotifyCommand()
+		: CommandType(EPRAnimNotifyCommandType::AnimNotifyCommandType_MAX)
+		, Phase(EPRAnimNotifyPhase::AnimNotifyPhase_Notify)
+		, NotifyObject(nullptr)
+		, MeshComp(nullptr)
+		, Animation(nullptr)
+		, EventReference()
+		, TotalDuration(0.0f)
+	{}
+
+public:
+	/** 명령의 타입입니다. 큐는 이 타입의 순서대로 정렬하여 실행합니다. */
+	EPRAnimNotifyCommandType CommandType;
+
+	/** 명령을 실행할 노티파이의 단계입니다. */
+	EPRAnimNotifyPhase Phase;
+
+	/** 명령을 실행할 노티파이입니다. */
+	TWeakObjectPtr<UObject> NotifyObject;
+
+	/** 노티파이를 실행한 SkeletalMeshComponent입니다. */
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComp;
+
+	/** 노티파이를 실행한 애니메이션입니다. */
+	TWeakObjectPtr<UAnimSequenceBase> Animation;
+
+	/** 실행한 노티파이 이벤트의 참조입니다. */
+	FAnimNotifyEventReference EventReference;
+
+	/** AnimNotifyState의 전체 길이입니다. NotifyBegin에서만 사용합니다. */
+	float TotalDuration;
+};
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPRDeferredAnimNotifyInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * AnimNotifyDispatchSubsystem의 큐에서 지연하여 실행하는 AnimNotify의 Interface 클래스입니다.
+ */
+class PROJECTREPLICA_API IPRDeferredAnimNotifyInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * 큐에 저장한 명령을 실행하는 함수입니다. 애니메이션의 업데이트가 끝난 후 게임 스레드에서 실행합니다.
+	 *
+	 * @param Command 실행할 명령입니다.
+	 */
+	virtual void ExecuteDeferredAnimNotify(const FPRAnimNotifyCommand& Command) = 0;
+
+	/**
+	 * 명령을 실행하기 전에 확인하는 Significance 설정을 반환하는 함수입니다.
+	 * 재정의하지 않은 노티파이는 게임플레이에 필요한 노티파이로 취급하여 Significance와 관계없이 항상 실행합니다.
+	 *
+	 * @return 노티파이의 Significance 설정입니다.
+	 */
+	virtual const FPRAnimNotifySignificanceSettings& GetAnimNotifySignificanceSettings() const;
+};
@@ -41,6 +41,14 @@ public:
 	int32 GetPoolIndex() const;
 	virtual int32 GetPoolIndex_Implementation() const = 0;
 
+	/**
+	 * 활성화된 횟수를 반환하는 함수입니다.
+	 * 풀에 반환된 후 다시 활성화되어 재사용 중인지 판별할 때 사용합니다.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Poolable")
+	int32 GetActivationCount() const;
+	virtual int32 GetActivationCount_Implementation() const = 0;
+
 	/** 수명을 반환하는 함수입니다. */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = "Poolable")
 	float GetLifespan() const;
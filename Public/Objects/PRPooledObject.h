@@ -38,6 +38,9 @@ protected:
 	/** 오브젝트의 PoolIndex를 반환하는 함수입니다. */
 	virtual int32 GetPoolIndex_Implementation() const override;
 
+	/** 오브젝트가 활성화된 횟수를 반환하는 함수입니다. */
+	virtual int32 GetActivationCount_Implementation() const override;
+
 	/** 수명을 반환하는 함수입니다. */
 	virtual float GetLifespan_Implementation() const override;
 
@@ -55,6 +58,14 @@ public:
 	void InitializeObject(AActor* NewObjectOwner = nullptr, int32 NewPoolIndex = -1);
 	virtual void InitializeObject_Implementation(AActor* NewObjectOwner = nullptr, int32 NewPoolIndex = -1);
 
+	/**
+	 * 레벨에 미리 배치된 오브젝트를 Pool에 추가할 때 다시 초기화하지 않고 소유자와 Pool의 Index만 설정하는 함수입니다.
+	 *
+	 * @param NewObjectOwner 오브젝트의 소유자입니다.
+	 * @param NewPoolIndex 오브젝트의 Pool의 Index입니다.
+	 */
+	void SetObjectPoolOwner(AActor* NewObjectOwner, int32 NewPoolIndex);
+
 	/** 오브젝트를 활성화하고 오브젝트의 위치를 설정하는 함수입니다. */
 	UFUNCTION(BlueprintCallable, Category = "PRPooledObject")
 	void ActivateAndSetLocation(const FVector& NewLocation);
@@ -90,6 +101,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRPooledObject")
 	int32 PoolIndex;
 
+	/** 오브젝트가 활성화된 횟수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRPooledObject")
+	int32 ActivationCount;
+
 public:
 	/** ObjectOwner를 반환하는 함수입니다. */
 	FORCEINLINE AActor* GetObjectOwner() const { return ObjectOwner; }
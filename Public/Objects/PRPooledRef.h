@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "Interfaces/PRPoolableInterface.h"
+
+/**
+ * 오브젝트 풀에서 가져와 활성화된 오브젝트를 참조하는 핸들 클래스입니다.
+ * Release 함수를 호출하거나 핸들이 범위를 벗어나면 참조하던 오브젝트를 비활성화하여 풀에 반환합니다.
+ * 핸들은 복사할 수 없으며 이동만 할 수 있습니다.
+ *
+ * ex) TPRPooledRef<APRNiagaraEffect> EffectRef(EffectSystem->SpawnNiagaraEffectAttached(...));
+ *     ...
+ *     EffectRef.Release();
+ */
+template <typename T>
+class TPRPooledRef
+{
+public:
+	TPRPooledRef()
+		: PooledObject(nullptr)
+		, ActivationCount(INDEX_NONE)
+	{}
+
+	explicit TPRPooledRef(T* NewPooledObject)
+		: PooledObject(nullptr)
+		, ActivationCount(INDEX_NONE)
+	{
+		Acquire(NewPooledObject);
+	}
+
+	TPRPooledRef(TPRPooledRef&& Other)
+		: PooledObject(Other.PooledObject)
+		, ActivationCount(Other.ActivationCount)
+	{
+		Other.PooledObject.Reset();
+		Other.ActivationCount = INDEX_NONE;
+	}
+
+	TPRPooledRef& operator=(TPRPooledRef&& Other)
+	{
+		if(this != &Other)
+		{
+			// 기존에 참조하던 오브젝트를 풀에 반환합니다.
+			Release();
+
+			PooledObject = Other.PooledObject;
+			ActivationCount = Other.ActivationCount;
+			Other.PooledObject.Reset();
+			Other.ActivationCount = INDEX_NONE;
+		}
+
+		return *this;
+	}
+
+	TPRPooledRef(const TPRPooledRef&) = delete;
+	TPRPooledRef& operator=(const TPRPooledRef&) = delete;
+
+	~TPRPooledRef()
+	{
+		Release();
+	}
+
+public:
+	/**
+	 * 기존에 참조하던 오브젝트를 풀에 반환하고 주어진 오브젝트를 참조하는 함수입니다.
+	 *
+	 * @param NewPooledObject 새로 참조할 풀링된 오브젝트입니다.
+	 */
+	void Reset(T* NewPooledObject = nullptr)
+	{
+		Release();
+		Acquire(NewPooledObject);
+	}
+
+	/**
+	 * 참조하던 오브젝트를 비활성화하여 풀에 반환하는 함수입니다.
+	 * 참조하던 오브젝트가 이미 풀에 반환된 후 다른 곳에서 다시 활성화되었을 경우 비활성화하지 않습니다.
+	 */
+	void Release()
+	{
+		UObject* ReleaseObject = PooledObject.Get();
+		const int32 ReleaseActivationCount = ActivationCount;
+		PooledObject.Reset();
+		ActivationCount = INDEX_NONE;
+
+		if(!::IsValid(ReleaseObject)
+			|| !ReleaseObject->GetClass()->ImplementsInterface(UPRPoolableInterface::StaticClass()))
+		{
+			return;
+		}
+
+		// 핸들이 참조한 이후에 다시 활성화된 오브젝트는 다른 곳에서 사용 중이므로 반환하지 않습니다.
+		if(IPRPoolableInterface::Execute_IsActivate(ReleaseObject)
+			&& IPRPoolableInterface::Execute_GetActivationCount(ReleaseObject) == ReleaseActivationCount)
+		{
+			IPRPoolableInterface::Execute_Deactivate(ReleaseObject);
+		}
+	}
+
+	/**
+	 * 오브젝트를 풀에 반환하지 않고 참조만 해제하는 함수입니다.
+	 *
+	 * @return 참조하던 오브젝트입니다.
+	 */
+	T* Detach()
+	{
+		T* DetachObject = PooledObject.Get();
+		PooledObject.Reset();
+		ActivationCount = INDEX_NONE;
+
+		return DetachObject;
+	}
+
+	/** 참조하는 오브젝트를 반환하는 함수입니다. */
+	T* Get() const
+	{
+		return PooledObject.Get();
+	}
+
+	/** 참조하는 오브젝트가 유효한지 확인하는 함수입니다. */
+	bool IsValid() const
+	{
+		return PooledObject.IsValid();
+	}
+
+	explicit operator bool() const
+	{
+		return IsValid();
+	}
+
+	T* operator->() const
+	{
+		return Get();
+	}
+
+private:
+	/**
+	 * 주어진 오브젝트를 참조하고 현재 활성화 횟수를 기록하는 함수입니다.
+	 *
+	 * @param NewPooledObject 참조할 풀링된 오브젝트입니다.
+	 */
+	void Acquire(T* NewPooledObject)
+	{
+		UObject* AcquireObject = NewPooledObject;
+		if(!::IsValid(AcquireObject)
+			|| !AcquireObject->GetClass()->ImplementsInterface(UPRPoolableInterface::StaticClass()))
+		{
+			return;
+		}
+
+		PooledObject = NewPooledObject;
+		ActivationCount = IPRPoolableInterface::Execute_GetActivationCount(AcquireObject);
+	}
+
+private:
+	/** 참조하는 풀링된 오브젝트입니다. */
+	TWeakObjectPtr<T> PooledObject;
+
+	/** 오브젝트를 참조할 때의 활성화 횟수입니다. 오브젝트가 재사용되었는지 판별할 때 사용합니다. */
+	int32 ActivationCount;
+};
@@ -9,6 +9,7 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Common/PRCommonEnum.h"
 #include "Common/PRCommonStruct.h"
+#include "Common/PRDebugDraw.h"
 
 /** 로그 카테고리를 정의합니다. */
 DECLARE_LOG_CATEGORY_EXTERN(ProjectReplica, Log, All);
@@ -93,4 +93,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "CharacterStat")
 	TMap<TSubclassOf<class APRBaseCharacter>, FPRLevelToCharacterStat> GetCharacterStatSettings() const;
 #pragma endregion 
+
+#pragma region AudioPool
+private:
+	/** AudioSubsystem이 사용하는 AudioPool의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "AudioPool", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UDataTable> AudioPoolSettingsDataTable;
+
+public:
+	/** AudioPoolSettingsDataTable을 반환하는 함수입니다. */
+	FORCEINLINE UDataTable* GetAudioPoolSettingsDataTable() const { return AudioPoolSettingsDataTable; }
+#pragma endregion
 };
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "GameFramework/Actor.h"
+#include "PRPoolBaker.generated.h"
+
+class UDataTable;
+
+/**
+ * Pool 오브젝트를 비활성화 상태로 미리 생성하여 레벨에 저장하는 Actor 클래스입니다.
+ * 맵과 함께 스트리밍되는 전용 서브레벨에 배치한 후 에디터에서 BakePooledActors를 실행합니다.
+ * 런타임에는 ObjectPoolSystem이 SpawnActor 대신 미리 저장된 액터를 가져와 Pool에 추가합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API APRPoolBaker : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APRPoolBaker();
+
+protected:
+	virtual void PostInitializeComponents() override;
+
+public:
+	/** 데이터 테이블의 설정 값을 바탕으로 Pool 오브젝트를 생성하여 이 액터의 레벨에 저장하는 함수입니다. */
+	UFUNCTION(CallInEditor, Category = "PoolBaker")
+	void BakePooledActors();
+
+	/** 이 액터가 레벨에 저장한 모든 Pool 오브젝트를 제거하는 함수입니다. */
+	UFUNCTION(CallInEditor, Category = "PoolBaker")
+	void ClearBakedActors();
+
+private:
+	/**
+	 * 주어진 클래스의 액터를 이 액터의 레벨에 생성하는 함수입니다.
+	 *
+	 * @param ActorClass 생성할 액터의 클래스입니다.
+	 * @return 생성한 액터입니다.
+	 */
+	AActor* SpawnBakedActor(UClass* ActorClass);
+
+protected:
+	/** 미리 생성할 PooledObject의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PoolBaker")
+	TObjectPtr<UDataTable> ObjectPoolSettingsDataTable;
+
+	/** 미리 생성할 NiagaraEffect의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PoolBaker")
+	TObjectPtr<UDataTable> NiagaraPoolSettingsDataTable;
+
+	/** 미리 생성할 ParticleEffect의 설정 값을 가진 데이터 테이블입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PoolBaker")
+	TObjectPtr<UDataTable> ParticlePoolSettingsDataTable;
+
+	/** 레벨에 저장된 Pool 오브젝트의 목록입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PoolBaker")
+	TArray<TObjectPtr<AActor>> BakedActors;
+
+public:
+	/** BakedActors를 반환하는 함수입니다. */
+	FORCEINLINE const TArray<TObjectPtr<AActor>>& GetBakedActors() const { return BakedActors; }
+};
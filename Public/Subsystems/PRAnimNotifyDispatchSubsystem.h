@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Interfaces/PRDeferredAnimNotifyInterface.h"
+#include "AnimNotifies/PRNotifyInstanceStorage.h"
+#include "PRAnimNotifyDispatchSubsystem.generated.h"
+
+/**
+ * AnimNotify 명령의 처리 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAnimNotifyDispatchStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRAnimNotifyDispatchStats()
+		: QueuedCount(0)
+		, ExecutedCount(0)
+		, DiscardedCount(0)
+		, MaxCommandsPerFrame(0)
+		, SignificanceSkippedCount(0)
+		, ReducedRateSkippedCount(0)
+		, SkippedCountsByType()
+	{}
+
+public:
+	/** 큐에 저장한 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 QueuedCount;
+
+	/** 실행한 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 ExecutedCount;
+
+	/** 실행하기 전에 노티파이나 SkeletalMeshComponent가 제거되어 버린 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 DiscardedCount;
+
+	/** 한 프레임에 실행한 명령의 최대 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 MaxCommandsPerFrame;
+
+	/** 캐릭터의 Significance가 MinSignificance보다 낮아 실행하지 않은 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 SignificanceSkippedCount;
+
+	/** 캐릭터의 Significance가 ReducedRateSignificance보다 낮아 실행 간격에 의해 실행하지 않은 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	int32 ReducedRateSkippedCount;
+
+	/** 명령의 타입별로 Significance에 의해 실행하지 않은 명령의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchStats")
+	TMap<EPRAnimNotifyCommandType, int32> SkippedCountsByType;
+};
+
+/**
+ * PR AnimNotify의 실행을 명령으로 모아 애니메이션의 업데이트가 끝난 후 한 번에 실행하는 WorldSubsystem 클래스입니다.
+ * 노티파이는 캐릭터의 컴포넌트를 직접 호출하지 않고 명령을 큐에 저장하며, 큐는 모든 액터의 Tick이 끝난 후 명령의 타입 순서대로 정렬하여 실행합니다.
+ * 같은 타입의 명령은 저장한 순서를 유지하므로 AnimNotifyState의 NotifyBegin과 NotifyEnd의 순서는 바뀌지 않습니다.
+ * 큐에 저장하는 함수는 병렬 애니메이션 업데이트의 워커 스레드에서 호출해도 안전합니다.
+ * 명령을 실행하기 전에 노티파이의 Significance 설정으로 캐릭터의 Significance를 확인하여, 멀거나 화면 밖의 캐릭터의 명령은 실행하지 않거나 간격을 두고 실행합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRAnimNotifyDispatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRAnimNotifyDispatchSubsystem();
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * AnimNotify의 명령을 SkeletalMeshComponent의 월드의 큐에 저장하는 함수입니다.
+	 * 지연 실행이 비활성화되었거나 게임 월드가 아닐 경우 저장하지 않으며, 노티파이는 바로 실행해야 합니다.
+	 * 지연 실행이 비활성화된 게임 월드에서는 바로 실행하기 전에 Significance를 확인합니다.
+	 *
+	 * @param NotifyObject 명령을 실행할 노티파이입니다. IPRDeferredAnimNotifyInterface를 구현해야 합니다.
+	 * @param CommandType 명령의 타입입니다.
+	 * @param Phase 명령을 실행할 노티파이의 단계입니다.
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param Animation 노티파이를 실행한 애니메이션입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @param TotalDuration AnimNotifyState의 전체 길이입니다.
+	 * @return 큐에 저장했거나 Significance에 의해 실행하지 않을 경우 true를 반환합니다. 노티파이를 바로 실행해야 할 경우 false를 반환합니다.
+	 */
+	static bool DeferAnimNotify(UObject* NotifyObject, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase, USkeletalMeshComponent* MeshComp,
+								UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference, float TotalDuration = 0.0f);
+
+	/**
+	 * 큐에 저장하지 않고 바로 실행하는 AnimNotify의 Significance를 확인하는 함수입니다. 게임 스레드에서 실행합니다.
+	 * 게임 월드가 아니거나 Subsystem이 없을 경우 항상 실행합니다.
+	 *
+	 * @param NotifyObject 실행할 노티파이입니다. IPRDeferredAnimNotifyInterface를 구현하지 않았을 경우 항상 실행합니다.
+	 * @param CommandType 명령의 타입입니다.
+	 * @param Phase 실행할 노티파이의 단계입니다.
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @return 노티파이를 실행해야 할 경우 true를 반환합니다.
+	 */
+	static bool PassesAnimNotifySignificance(UObject* NotifyObject, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase, USkeletalMeshComponent* MeshComp,
+											const FAnimNotifyEventReference& EventReference);
+
+	/** 처리 결과의 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAnimNotifyDispatchSubsystem")
+	void ResetAnimNotifyDispatchStats();
+
+private:
+	/**
+	 * 명령을 큐에 저장하는 함수입니다.
+	 *
+	 * @param Command 저장할 명령입니다.
+	 */
+	void EnqueueCommand(FPRAnimNotifyCommand&& Command);
+
+	/**
+	 * 모든 액터의 Tick이 끝났을 때 실행하는 함수입니다. 큐에 저장한 명령을 실행합니다.
+	 *
+	 * @param World Tick이 끝난 월드입니다.
+	 * @param TickType Tick의 타입입니다.
+	 * @param DeltaSeconds 이전 프레임부터 지난 시간입니다.
+	 */
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** 큐에 저장한 명령을 타입 순서대로 정렬하여 실행하는 함수입니다. */
+	void DispatchQueuedCommands();
+
+	/**
+	 * 노티파이의 Significance 설정으로 명령을 실행할지 확인하는 함수입니다. 게임 스레드에서 실행합니다.
+	 * NotifyEnd는 NotifyBegin에서 시작한 작업을 정리하므로 항상 실행합니다.
+	 *
+	 * @param DeferredAnimNotify 명령을 실행할 노티파이입니다.
+	 * @param CommandType 명령의 타입입니다.
+	 * @param Phase 명령을 실행할 노티파이의 단계입니다.
+	 * @param MeshComp 노티파이를 실행한 SkeletalMeshComponent입니다.
+	 * @param EventReference 실행한 노티파이 이벤트의 참조입니다.
+	 * @return 명령을 실행해야 할 경우 true를 반환합니다.
+	 */
+	bool PassesSignificanceFilter(const IPRDeferredAnimNotifyInterface* DeferredAnimNotify, EPRAnimNotifyCommandType CommandType, EPRAnimNotifyPhase Phase,
+									const USkeletalMeshComponent* MeshComp, const FAnimNotifyEventReference& EventReference);
+
+	/**
+	 * 캐릭터의 Significance를 계산하는 함수입니다.
+	 * 카메라와의 거리가 SignificanceNearDistance 이하일 경우 1, SignificanceFarDistance 이상일 경우 0이며, 최근에 렌더링되지 않았을 경우 NotRenderedSignificanceScale을 곱합니다.
+	 *
+	 * @param MeshComp 캐릭터의 SkeletalMeshComponent입니다.
+	 * @return 0부터 1 사이의 Significance입니다.
+	 */
+	float EvaluateCharacterSignificance(const USkeletalMeshComponent* MeshComp);
+
+	/**
+	 * Significance를 계산하는 카메라의 위치를 프레임마다 한 번 갱신하는 함수입니다.
+	 *
+	 * @return 카메라의 위치가 유효할 경우 true를 반환합니다.
+	 */
+	bool UpdateSignificanceViewLocation();
+
+	/**
+	 * Significance에 의해 실행하지 않은 명령을 집계하는 함수입니다.
+	 *
+	 * @param CommandType 명령의 타입입니다.
+	 * @param bReducedRate 실행 간격에 의해 실행하지 않았는지 여부입니다.
+	 */
+	void RecordSkippedCommand(EPRAnimNotifyCommandType CommandType, bool bReducedRate);
+
+private:
+	/** 다음 실행까지 저장한 명령입니다. */
+	TArray<FPRAnimNotifyCommand> QueuedCommands;
+
+	/** 실행 중인 명령입니다. 실행 중에 저장된 명령은 QueuedCommands에 저장하여 다음 실행에서 처리합니다. */
+	TArray<FPRAnimNotifyCommand> DispatchingCommands;
+
+	/** QueuedCommands를 보호하는 CriticalSection입니다. */
+	FCriticalSection QueuedCommandsLock;
+
+	/** 처리 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAnimNotifyDispatchSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRAnimNotifyDispatchStats DispatchStats;
+
+	/** 모든 액터의 Tick이 끝났을 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle PostActorTickHandle;
+
+	/** Significance가 ReducedRateSignificance보다 낮은 노티파이의 SkeletalMeshComponent와 노티파이 이벤트별 실행 횟수입니다. */
+	TMap<FPRNotifyInstanceKey, int32> ReducedRateCounters;
+
+	/** 저장할 수 있는 실행 횟수의 최대 수입니다. 초과할 경우 제거된 SkeletalMeshComponent의 실행 횟수를 정리합니다. */
+	int32 MaxReducedRateCounters;
+
+	/** Significance를 계산하는 카메라의 위치입니다. */
+	FVector SignificanceViewLocation;
+
+	/** SignificanceViewLocation을 갱신한 프레임입니다. */
+	uint64 SignificanceViewFrame;
+
+	/** SignificanceViewLocation이 유효한지 나타내는 변수입니다. */
+	bool bHasSignificanceViewLocation;
+
+	/** Significance가 1인 카메라와의 최대 거리입니다. */
+	float SignificanceNearDistance;
+
+	/** Significance가 0인 카메라와의 최소 거리입니다. */
+	float SignificanceFarDistance;
+
+	/** 최근에 렌더링되지 않은 캐릭터의 Significance에 곱하는 값입니다. 화면 밖이어도 가까운 캐릭터의 발소리는 들리도록 0으로 설정하지 않습니다. */
+	float NotRenderedSignificanceScale;
+
+	/** 렌더링 여부를 판단하는 시간입니다. */
+	float RecentlyRenderedTime;
+
+public:
+	/** DispatchStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRAnimNotifyDispatchStats& GetAnimNotifyDispatchStats() const { return DispatchStats; }
+};
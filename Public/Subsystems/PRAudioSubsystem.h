@@ -0,0 +1,275 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/DataTable.h"
+#include "AudioParameter.h"
+#include "PRAudioSubsystem.generated.h"
+
+class USoundBase;
+class UAudioComponent;
+
+/**
+ * AudioPool의 설정 값을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAudioPoolSettings : public FTableRowBase
+{
+	GENERATED_BODY()
+
+public:
+	FPRAudioPoolSettings()
+		: Sound(nullptr)
+		, PoolSize(0)
+		, MaxConcurrentCount(0)
+		, MaxConcurrentInArea(0)
+		, AreaRadius(0.0f)
+		, MaxAudibleDistance(0.0f)
+	{}
+
+	FPRAudioPoolSettings(TObjectPtr<USoundBase> NewSound, int32 NewPoolSize, int32 NewMaxConcurrentCount, int32 NewMaxConcurrentInArea, float NewAreaRadius, float NewMaxAudibleDistance)
+		: Sound(NewSound)
+		, PoolSize(NewPoolSize)
+		, MaxConcurrentCount(NewMaxConcurrentCount)
+		, MaxConcurrentInArea(NewMaxConcurrentInArea)
+		, AreaRadius(NewAreaRadius)
+		, MaxAudibleDistance(NewMaxAudibleDistance)
+	{}
+
+public:
+	/** Pool에 넣을 사운드입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings")
+	TObjectPtr<USoundBase> Sound;
+
+	/** 미리 생성할 AudioComponent의 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings", meta = (ClampMin = "0"))
+	int32 PoolSize;
+
+	/** 월드에서 동시에 재생할 수 있는 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings", meta = (ClampMin = "1"))
+	int32 MaxConcurrentCount;
+
+	/** AreaRadius 안에서 동시에 재생할 수 있는 최대 수입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings", meta = (ClampMin = "1"))
+	int32 MaxConcurrentInArea;
+
+	/** MaxConcurrentInArea를 적용하는 반경입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings", meta = (ClampMin = "0.0"))
+	float AreaRadius;
+
+	/** 리스너로부터 이 거리보다 멀리 있으면 재생하지 않습니다. 0일 경우 사운드의 감쇠 거리를 사용합니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PRAudioPoolSettings", meta = (ClampMin = "0.0"))
+	float MaxAudibleDistance;
+};
+
+/**
+ * 재생 중인 AudioComponent를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRActiveAudio
+{
+	GENERATED_BODY()
+
+public:
+	FPRActiveAudio()
+		: Sound(nullptr)
+		, Location(FVector::ZeroVector)
+	{}
+
+	FPRActiveAudio(TObjectPtr<USoundBase> NewSound, const FVector& NewLocation)
+		: Sound(NewSound)
+		, Location(NewLocation)
+	{}
+
+public:
+	/** 재생 중인 사운드입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRActiveAudio")
+	TObjectPtr<USoundBase> Sound;
+
+	/** 사운드를 재생한 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRActiveAudio")
+	FVector Location;
+};
+
+/**
+ * 사운드별로 재생하지 않은 AudioComponent를 보관하는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAudioPool
+{
+	GENERATED_BODY()
+
+public:
+	FPRAudioPool()
+		: FreeComponents()
+		, ActiveCount(0)
+	{}
+
+public:
+	/** 재생하지 않은 AudioComponent들의 Array입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPool")
+	TArray<TObjectPtr<UAudioComponent>> FreeComponents;
+
+	/** 재생 중인 AudioComponent의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPool")
+	int32 ActiveCount;
+};
+
+/**
+ * AudioPool의 재생과 거부 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRAudioPoolStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRAudioPoolStats()
+		: PlayedCount(0)
+		, DistanceRejectedCount(0)
+		, ConcurrencyRejectedCount(0)
+		, AreaRejectedCount(0)
+		, CreatedComponentCount(0)
+	{}
+
+public:
+	/** 재생한 사운드의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPoolStats")
+	int32 PlayedCount;
+
+	/** 리스너로부터 멀어 재생하지 않은 사운드의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPoolStats")
+	int32 DistanceRejectedCount;
+
+	/** 사운드별 최대 동시 재생 수를 초과하여 재생하지 않은 사운드의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPoolStats")
+	int32 ConcurrencyRejectedCount;
+
+	/** 영역별 최대 동시 재생 수를 초과하여 재생하지 않은 사운드의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPoolStats")
+	int32 AreaRejectedCount;
+
+	/** 생성한 AudioComponent의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioPoolStats")
+	int32 CreatedComponentCount;
+};
+
+/**
+ * 발소리와 전투 사운드의 AudioComponent를 사운드별로 Pool에 보관하여 재사용하는 WorldSubsystem 클래스입니다.
+ * 거리와 동시 재생 수를 먼저 확인하여 재생하지 않을 사운드는 AudioComponent를 가져오지 않습니다.
+ * Pool의 설정 값은 GameInstance의 AudioPoolSettingsDataTable에서 가져옵니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRAudioSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRAudioSubsystem();
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * 주어진 위치에서 사운드를 Pool의 AudioComponent로 재생하는 함수입니다.
+	 *
+	 * @param Sound 재생할 사운드입니다.
+	 * @param Location 사운드를 재생할 위치입니다.
+	 * @param Parameters 재생하기 전에 AudioComponent에 적용할 파라미터입니다.
+	 * @param VolumeMultiplier 볼륨의 배율입니다.
+	 * @param PitchMultiplier 피치의 배율입니다.
+	 * @return 재생한 AudioComponent입니다. 재생하지 않았을 경우 nullptr을 반환합니다.
+	 */
+	UAudioComponent* PlaySoundAtLocation(USoundBase* Sound, const FVector& Location, const TArray<FAudioParameter>& Parameters, float VolumeMultiplier = 1.0f, float PitchMultiplier = 1.0f);
+
+	/** 재생과 거부 결과의 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRAudioSubsystem")
+	void ResetAudioPoolStats();
+
+private:
+	/** 데이터 테이블의 설정 값을 사운드별로 저장하고 AudioComponent를 미리 생성하는 함수입니다. */
+	void InitializeAudioPool();
+
+	/** 모든 AudioComponent를 제거하는 함수입니다. */
+	void ClearAllAudioPool();
+
+	/**
+	 * 주어진 사운드의 설정 값을 반환하는 함수입니다.
+	 *
+	 * @param Sound 설정 값을 찾을 사운드입니다.
+	 * @return 데이터 테이블에 설정 값이 있을 경우 설정 값을, 그렇지 않을 경우 기본 설정 값을 반환합니다.
+	 */
+	FPRAudioPoolSettings GetAudioPoolSettings(USoundBase* Sound) const;
+
+	/**
+	 * 주어진 위치가 리스너로부터 들을 수 있는 거리 안에 있는지 확인하는 함수입니다.
+	 *
+	 * @param Sound 재생할 사운드입니다.
+	 * @param Location 사운드를 재생할 위치입니다.
+	 * @param AudioPoolSettings 사운드의 설정 값입니다.
+	 * @return 들을 수 있는 거리 안에 있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool IsAudible(USoundBase* Sound, const FVector& Location, const FPRAudioPoolSettings& AudioPoolSettings) const;
+
+	/**
+	 * 주어진 위치의 영역 안에서 같은 사운드를 재생하는 수를 반환하는 함수입니다.
+	 *
+	 * @param Sound 확인할 사운드입니다.
+	 * @param Location 영역의 중심입니다.
+	 * @param AreaRadius 영역의 반경입니다.
+	 * @return 영역 안에서 재생 중인 수입니다.
+	 */
+	int32 GetActiveCountInArea(USoundBase* Sound, const FVector& Location, float AreaRadius) const;
+
+	/**
+	 * 주어진 사운드의 Pool에서 재생하지 않은 AudioComponent를 가져오는 함수입니다. 없을 경우 새로 생성합니다.
+	 *
+	 * @param Sound AudioComponent를 가져올 사운드입니다.
+	 * @return 재생하지 않은 AudioComponent입니다.
+	 */
+	UAudioComponent* AcquireAudioComponent(USoundBase* Sound);
+
+	/**
+	 * 주어진 사운드의 AudioComponent를 생성하는 함수입니다.
+	 *
+	 * @param Sound AudioComponent에 설정할 사운드입니다.
+	 * @return 생성한 AudioComponent입니다.
+	 */
+	UAudioComponent* CreateAudioComponent(USoundBase* Sound);
+
+	/**
+	 * 재생이 끝난 AudioComponent를 Pool에 반환하는 함수입니다.
+	 *
+	 * @param AudioComponent 재생이 끝난 AudioComponent입니다.
+	 */
+	void OnAudioComponentFinished(UAudioComponent* AudioComponent);
+
+private:
+	/** 데이터 테이블에 설정되지 않은 사운드의 기본 설정 값입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRAudioPoolSettings DefaultAudioPoolSettings;
+
+	/** 데이터 테이블의 설정 값을 사운드별로 보관한 Map입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<USoundBase>, FPRAudioPoolSettings> AudioPoolSettingsIndex;
+
+	/** 사운드별 AudioComponent의 Pool입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<USoundBase>, FPRAudioPool> AudioPool;
+
+	/** 재생 중인 AudioComponent의 목록입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UAudioComponent>, FPRActiveAudio> ActiveAudios;
+
+	/** 재생과 거부 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRAudioSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRAudioPoolStats AudioPoolStats;
+
+public:
+	/** AudioPoolStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRAudioPoolStats& GetAudioPoolStats() const { return AudioPoolStats; }
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRBakedPoolSubsystem.generated.h"
+
+class APRPoolBaker;
+
+DECLARE_MULTICAST_DELEGATE(FOnBakedPoolActorsRegistered);
+
+/**
+ * 레벨에 미리 배치된 Pool 오브젝트의 목록을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRBakedPoolActors
+{
+	GENERATED_BODY()
+
+public:
+	FPRBakedPoolActors()
+		: Actors()
+	{}
+
+public:
+	/** 아직 Pool에 추가되지 않은 미리 배치된 액터들의 Array입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRBakedPoolActors")
+	TArray<TObjectPtr<AActor>> Actors;
+};
+
+/**
+ * 레벨에 미리 배치된 Pool 오브젝트를 ObjectPoolSystem에 넘겨주는 WorldSubsystem 클래스입니다.
+ * ObjectPoolSystem은 Pool 오브젝트를 SpawnActor로 생성하기 전에 이 Subsystem에서 미리 배치된 오브젝트를 가져옵니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRBakedPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRBakedPoolSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * PoolBaker가 가진 미리 배치된 액터들을 등록하는 함수입니다.
+	 *
+	 * @param PoolBaker 등록할 PoolBaker입니다.
+	 */
+	void RegisterPoolBaker(APRPoolBaker* PoolBaker);
+
+	/**
+	 * 주어진 키에 해당하는 미리 배치된 액터를 하나 가져오는 함수입니다.
+	 * 가져온 액터는 목록에서 제거됩니다.
+	 *
+	 * @param PoolKey 액터를 가져올 Pool의 키입니다. PooledObject는 클래스, 이펙트는 에셋을 키로 사용합니다.
+	 * @return 미리 배치된 액터가 있을 경우 액터를 반환합니다. 그렇지 않을 경우 nullptr을 반환합니다.
+	 */
+	AActor* ClaimBakedActor(UObject* PoolKey);
+
+	/**
+	 * 주어진 키에 해당하는 미리 배치된 액터가 남아있는지 확인하는 함수입니다.
+	 *
+	 * @param PoolKey 확인할 Pool의 키입니다.
+	 * @return 미리 배치된 액터가 남아있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool HasBakedActor(UObject* PoolKey) const;
+
+	/**
+	 * 주어진 Pool 액터가 사용하는 Pool의 키를 반환하는 함수입니다.
+	 *
+	 * @param PoolActor Pool의 키를 구할 액터입니다.
+	 * @return PooledObject는 클래스, 이펙트는 에셋을 반환합니다.
+	 */
+	static UObject* GetPoolKeyForActor(const AActor* PoolActor);
+
+private:
+	/** 월드에 이미 로드된 PoolBaker를 찾아 등록하는 함수입니다. */
+	void RegisterLoadedPoolBakers();
+
+private:
+	/** Pool의 키와 미리 배치된 액터의 목록을 보관하는 Map입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UObject>, FPRBakedPoolActors> BakedPoolActors;
+
+	/** 등록된 PoolBaker의 목록입니다. */
+	UPROPERTY(Transient)
+	TSet<TObjectPtr<APRPoolBaker>> RegisteredPoolBakers;
+
+	/** 월드에 이미 로드된 PoolBaker를 찾았는지 여부입니다. */
+	bool bLoadedPoolBakersRegistered;
+
+public:
+	/** 새로운 미리 배치된 액터가 등록될 때 실행하는 델리게이트입니다. */
+	FOnBakedPoolActorsRegistered OnBakedPoolActorsRegisteredDelegate;
+};
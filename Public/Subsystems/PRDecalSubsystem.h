@@ -0,0 +1,247 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRDecalSubsystem.generated.h"
+
+class UMaterialInterface;
+class UDecalComponent;
+
+/**
+ * 다음 Tick에 배치할 데칼의 요청을 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDecalRequest
+{
+	GENERATED_BODY()
+
+public:
+	FPRDecalRequest()
+		: DecalMaterial(nullptr)
+		, Location(FVector::ZeroVector)
+		, Rotation(FRotator::ZeroRotator)
+		, DecalSize(FVector::ZeroVector)
+	{}
+
+	FPRDecalRequest(TObjectPtr<UMaterialInterface> NewDecalMaterial, const FVector& NewLocation, const FRotator& NewRotation, const FVector& NewDecalSize)
+		: DecalMaterial(NewDecalMaterial)
+		, Location(NewLocation)
+		, Rotation(NewRotation)
+		, DecalSize(NewDecalSize)
+	{}
+
+public:
+	/** 데칼의 머티리얼입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRequest")
+	TObjectPtr<UMaterialInterface> DecalMaterial;
+
+	/** 데칼을 배치할 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRequest")
+	FVector Location;
+
+	/** 데칼의 회전 값입니다. 데칼은 X축 방향으로 투영됩니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRequest")
+	FRotator Rotation;
+
+	/** 데칼의 크기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRequest")
+	FVector DecalSize;
+};
+
+/**
+ * 하나의 데칼 머티리얼이 사용하는 고정된 크기의 DecalComponent 링 버퍼를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDecalRingBuffer
+{
+	GENERATED_BODY()
+
+public:
+	FPRDecalRingBuffer()
+		: Decals()
+		, FadeOutStartTimes()
+		, Capacity(0)
+		, NextIndex(0)
+		, LastPlacedTime(0.0f)
+	{}
+
+public:
+	/** 링 버퍼의 DecalComponent들입니다. 처음 사용할 때 Capacity까지 생성하고, 그 후에는 가장 오래된 데칼을 재사용합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRingBuffer")
+	TArray<TObjectPtr<UDecalComponent>> Decals;
+
+	/** Decals와 같은 Index의 데칼이 페이드 아웃을 시작하는 월드 시간입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRingBuffer")
+	TArray<float> FadeOutStartTimes;
+
+	/** 링 버퍼의 고정된 크기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRingBuffer")
+	int32 Capacity;
+
+	/** 다음에 배치할 DecalComponent의 Index입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRingBuffer")
+	int32 NextIndex;
+
+	/** 마지막으로 데칼을 배치한 월드 시간입니다. 남은 데칼 수가 없을 때 가장 오래 사용하지 않은 링 버퍼를 찾기 위해 사용합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalRingBuffer")
+	float LastPlacedTime;
+};
+
+/**
+ * 데칼의 배치 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRDecalStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRDecalStats()
+		: PlacedCount(0)
+		, RecycledCount(0)
+		, DroppedCount(0)
+		, EvictedRingBufferCount(0)
+		, LiveDecalCount(0)
+	{}
+
+public:
+	/** 배치한 데칼의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalStats")
+	int32 PlacedCount;
+
+	/** 가장 오래된 데칼을 재사용하여 배치한 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalStats")
+	int32 RecycledCount;
+
+	/** 최대 수를 초과하여 배치하지 않은 요청의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalStats")
+	int32 DroppedCount;
+
+	/** 새 머티리얼에 DecalComponent를 넘겨주기 위해 제거한 링 버퍼의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalStats")
+	int32 EvictedRingBufferCount;
+
+	/** 화면에 보이는 데칼의 수입니다. 페이드 아웃이 끝나거나 링 버퍼가 제거되어 숨긴 데칼은 포함하지 않으며, MaxLiveDecals를 넘지 않습니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalStats")
+	int32 LiveDecalCount;
+};
+
+/**
+ * 발자국과 히트 자국 같은 데칼을 머티리얼별 고정된 크기의 링 버퍼로 재사용하는 WorldSubsystem 클래스입니다.
+ * 노티파이와 대미지 이벤트의 요청을 모아 Tick에서 한 번에 배치하며, 전투가 길어져도 월드의 데칼 수는 MaxLiveDecals를 넘지 않습니다.
+ * 다음에 재사용할 데칼은 미리 페이드 아웃하여 갑자기 사라지지 않도록 합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRDecalSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRDecalSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 다음 Tick에 배치할 데칼을 요청하는 함수입니다.
+	 *
+	 * @param DecalMaterial 데칼의 머티리얼입니다.
+	 * @param Location 데칼을 배치할 위치입니다.
+	 * @param Rotation 데칼의 회전 값입니다.
+	 * @param DecalSize 데칼의 크기입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDecalSubsystem")
+	void AddDecal(UMaterialInterface* DecalMaterial, const FVector& Location, const FRotator& Rotation, const FVector& DecalSize);
+
+	/**
+	 * 표면의 노멀 방향으로 투영하는 데칼을 요청하는 함수입니다.
+	 *
+	 * @param DecalMaterial 데칼의 머티리얼입니다.
+	 * @param Location 데칼을 배치할 위치입니다.
+	 * @param Normal 표면의 노멀입니다.
+	 * @param DecalSize 데칼의 크기입니다.
+	 * @param Roll 투영 방향을 축으로 하는 데칼의 회전 값입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRDecalSubsystem")
+	void AddDecalOnSurface(UMaterialInterface* DecalMaterial, const FVector& Location, const FVector& Normal, const FVector& DecalSize, float Roll = 0.0f);
+
+	/** 배치 결과의 집계를 초기화하는 함수입니다. LiveDecalCount는 유지합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRDecalSubsystem")
+	void ResetDecalStats();
+
+private:
+	/**
+	 * 요청한 데칼을 머티리얼의 링 버퍼에 배치하는 함수입니다.
+	 *
+	 * @param DecalRequest 배치할 데칼의 요청입니다.
+	 * @return 배치했을 경우 true를 반환합니다. 최대 수를 초과하여 배치하지 못했을 경우 false를 반환합니다.
+	 */
+	bool PlaceDecal(const FPRDecalRequest& DecalRequest);
+
+	/**
+	 * 주어진 머티리얼의 링 버퍼를 반환하는 함수입니다. 없을 경우 남은 데칼 수 안에서 생성합니다.
+	 * 남은 데칼 수가 없을 경우 가장 오래 사용하지 않은 링 버퍼를 제거하고 DecalComponent를 넘겨받습니다.
+	 *
+	 * @param DecalMaterial 링 버퍼를 가져올 머티리얼입니다.
+	 * @return 머티리얼의 링 버퍼입니다. 모든 링 버퍼가 이번 프레임에 사용되어 제거할 수 없을 경우 nullptr을 반환합니다.
+	 */
+	FPRDecalRingBuffer* GetOrCreateDecalRingBuffer(UMaterialInterface* DecalMaterial);
+
+	/**
+	 * 이번 프레임에 사용하지 않은 링 버퍼 중 가장 오래 사용하지 않은 링 버퍼를 제거하는 함수입니다.
+	 * 제거한 링 버퍼의 DecalComponent는 파괴하지 않고 숨겨서 반환합니다.
+	 *
+	 * @param OutDecals 제거한 링 버퍼의 DecalComponent들입니다.
+	 * @return 링 버퍼를 제거했을 경우 true를 반환합니다.
+	 */
+	bool EvictLeastRecentlyUsedDecalRingBuffer(TArray<TObjectPtr<UDecalComponent>>& OutDecals);
+
+	/**
+	 * 페이드 아웃이 끝난 데칼을 숨기는 함수입니다.
+	 * SetFadeOut이 설정하는 수명은 DecalComponent를 파괴하므로 수명 대신 FadeOutStartTimes로 직접 만료를 확인합니다.
+	 */
+	void HideFadedOutDecals();
+
+private:
+	/** 머티리얼별 데칼의 링 버퍼입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UMaterialInterface>, FPRDecalRingBuffer> DecalRingBuffers;
+
+	/** 다음 Tick에 배치할 데칼의 요청입니다. */
+	UPROPERTY(Transient)
+	TArray<FPRDecalRequest> PendingDecalRequests;
+
+	/** 배치 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRDecalSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRDecalStats DecalStats;
+
+	/** 모든 링 버퍼의 Capacity의 합입니다. */
+	int32 ReservedDecalCount;
+
+	/** 머티리얼 하나의 링 버퍼 크기입니다. */
+	int32 DecalsPerMaterial;
+
+	/** 월드에 생성할 수 있는 DecalComponent의 최대 수입니다. 모든 링 버퍼의 크기의 합은 이 값을 넘지 않습니다. */
+	int32 MaxLiveDecals;
+
+	/** 한 Tick에 배치할 수 있는 최대 요청의 수입니다. 초과한 요청은 버립니다. */
+	int32 MaxDecalsPerTick;
+
+	/** 배치한 데칼이 페이드 아웃을 시작하기 전까지 유지되는 시간입니다. */
+	float DecalLifespan;
+
+	/** 데칼이 페이드 아웃되는 시간입니다. 재사용하기 전에 미리 페이드 아웃할 때도 사용합니다. */
+	float FadeOutDuration;
+
+	/** 데칼이 화면에서 작아졌을 때 사라지는 크기의 비율입니다. */
+	float FadeScreenSize;
+
+public:
+	/** DecalStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRDecalStats& GetDecalStats() const { return DecalStats; }
+};
@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PREffectSpawnBudgetSubsystem.generated.h"
+
+class UFXSystemAsset;
+class UFXSystemComponent;
+
+/**
+ * 병합 대상을 찾기 위해 최근에 Spawn한 이펙트를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRRecentEffectSpawn
+{
+	GENERATED_BODY()
+
+public:
+	FPRRecentEffectSpawn()
+		: EffectAsset(nullptr)
+		, Location(FVector::ZeroVector)
+		, ExpireTime(0.0f)
+		, EffectComponent(nullptr)
+		, SpawnSerial(0)
+		, Intensity(1.0f)
+	{}
+
+public:
+	/** Spawn한 NiagaraSystem 또는 ParticleSystem입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	TObjectPtr<UFXSystemAsset> EffectAsset;
+
+	/** 이펙트를 Spawn한 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	FVector Location;
+
+	/** 다른 요청을 병합할 수 있는 마지막 시간입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	float ExpireTime;
+
+	/** Spawn한 이펙트의 Component입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	TWeakObjectPtr<UFXSystemComponent> EffectComponent;
+
+	/** Spawn할 때 Component에 발급한 번호입니다. Pool에서 재사용된 Component를 구분하기 위해 사용합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	int32 SpawnSerial;
+
+	/** 병합된 Spawn 요청의 수를 나타내는 이펙트의 세기입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRRecentEffectSpawn")
+	float Intensity;
+};
+
+/**
+ * 월드의 모든 EffectSystem이 공유하는 프레임당 이펙트 Spawn 예산과 병합 대상을 관리하는 WorldSubsystem 클래스입니다.
+ * 프레임당 Spawn 수는 월드의 Tick마다 한 번 초기화되므로 여러 캐릭터가 같은 프레임에 Spawn해도 하나의 예산을 나눠 사용합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPREffectSpawnBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPREffectSpawnBudgetSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 주어진 이펙트가 이번 프레임에 더 Spawn될 수 있는지 확인하는 함수입니다.
+	 *
+	 * @param SpawnEffect 확인할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param GlobalMaxSpawnsPerFrame 월드에서 프레임당 Spawn할 수 있는 모든 이펙트의 최대 수입니다.
+	 * @param SystemMaxSpawnsPerFrame 이펙트가 프레임당 Spawn할 수 있는 최대 수입니다.
+	 * @return 예산이 남아있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool HasEffectSpawnBudget(UFXSystemAsset* SpawnEffect, int32 GlobalMaxSpawnsPerFrame, int32 SystemMaxSpawnsPerFrame) const;
+
+	/**
+	 * 주어진 위치 근처에 최근 Spawn되어 아직 실행 중인 같은 이펙트를 찾아 세기를 높이는 함수입니다.
+	 * Pool에 반환되었거나 다른 요청에 재사용된 Component는 Spawn 번호가 달라지므로 병합하지 않습니다.
+	 *
+	 * @param SpawnEffect Spawn할 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param Location 이펙트를 Spawn할 위치입니다.
+	 * @param CoalesceRadius 병합할 수 있는 거리입니다.
+	 * @param OutIntensity 병합한 후의 이펙트의 세기입니다.
+	 * @return 요청을 병합한 이펙트의 Component입니다. 병합할 이펙트가 없을 경우 nullptr을 반환합니다.
+	 */
+	UFXSystemComponent* CoalesceEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, float CoalesceRadius, float& OutIntensity);
+
+	/**
+	 * Spawn한 이펙트를 프레임당 Spawn 수에 더하고, Component에 새 Spawn 번호를 발급하는 함수입니다.
+	 *
+	 * @param SpawnEffect Spawn한 NiagaraSystem 또는 ParticleSystem입니다.
+	 * @param Location 이펙트를 Spawn한 위치입니다.
+	 * @param EffectComponent Spawn한 이펙트의 Component입니다.
+	 * @param Intensity Spawn한 이펙트의 세기입니다.
+	 * @param CoalesceTimeWindow 다른 요청을 병합할 수 있는 시간입니다. 0보다 작거나 같을 경우 병합 대상으로 등록하지 않습니다.
+	 */
+	void RecordEffectSpawn(UFXSystemAsset* SpawnEffect, const FVector& Location, UFXSystemComponent* EffectComponent, float Intensity, float CoalesceTimeWindow);
+
+private:
+	/**
+	 * 주어진 병합 대상이 아직 Spawn한 요청에 사용 중인지 확인하는 함수입니다.
+	 *
+	 * @param RecentEffectSpawn 확인할 병합 대상입니다.
+	 * @param CurrentTime 현재 월드의 시간입니다.
+	 * @return Component가 실행 중이고 Spawn 번호가 같으며 병합할 시간이 남아있을 경우 true를 반환합니다. 그렇지 않을 경우 false를 반환합니다.
+	 */
+	bool IsRecentEffectSpawnValid(const FPRRecentEffectSpawn& RecentEffectSpawn, float CurrentTime) const;
+
+private:
+	/** 병합 대상을 찾기 위해 최근에 Spawn한 이펙트의 목록입니다. */
+	UPROPERTY(Transient)
+	TArray<FPRRecentEffectSpawn> RecentEffectSpawns;
+
+	/** 이번 프레임에 이펙트별로 Spawn한 수입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UFXSystemAsset>, int32> FrameEffectSpawnCounts;
+
+	/** 이번 프레임에 Spawn한 모든 이펙트의 수입니다. */
+	int32 FrameTotalEffectSpawnCount;
+
+	/** Component별로 마지막에 발급한 Spawn 번호입니다. */
+	TMap<TWeakObjectPtr<UFXSystemComponent>, int32> EffectSpawnSerials;
+
+	/** 다음에 발급할 Spawn 번호입니다. */
+	int32 NextEffectSpawnSerial;
+
+	/** 제거된 Component의 Spawn 번호를 정리하는 주기입니다. */
+	float SpawnSerialCleanupInterval;
+
+	/** 마지막으로 Spawn 번호를 정리한 후 지난 시간입니다. */
+	float SpawnSerialCleanupElapsedTime;
+};
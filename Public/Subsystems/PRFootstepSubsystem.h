@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRFootstepSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+class USoundBase;
+class UMaterialInterface;
+
+/**
+ * 발소리와 발자국 데칼을 실행하기 위해 바닥을 탐색하는 요청을 나타내는 구조체입니다.
+ */
+struct FPRFootstepRequest
+{
+public:
+	FPRFootstepRequest()
+		: MeshComp(nullptr)
+		, Sound(nullptr)
+		, FootprintDecalMaterial(nullptr)
+		, TraceStart(FVector::ZeroVector)
+		, TraceEnd(FVector::ZeroVector)
+		, FootprintDecalSize(FVector::ZeroVector)
+		, FootprintDecalRotationOffset(FRotator::ZeroRotator)
+		, Gender(INDEX_NONE)
+		, bUseSurfaceCache(false)
+		, bDebug(false)
+	{}
+
+public:
+	/** 발걸음을 요청한 SkeletalMeshComponent입니다. */
+	TWeakObjectPtr<USkeletalMeshComponent> MeshComp;
+
+	/** 바닥에 닿았을 때 재생할 발소리입니다. */
+	TWeakObjectPtr<USoundBase> Sound;
+
+	/** 바닥에 닿았을 때 배치할 발자국 데칼의 머티리얼입니다. */
+	TWeakObjectPtr<UMaterialInterface> FootprintDecalMaterial;
+
+	/** 바닥을 탐색하는 시작 위치입니다. */
+	FVector TraceStart;
+
+	/** 바닥을 탐색하는 끝 위치입니다. */
+	FVector TraceEnd;
+
+	/** 발자국 데칼의 크기입니다. */
+	FVector FootprintDecalSize;
+
+	/** 발자국 데칼의 회전 오프셋입니다. */
+	FRotator FootprintDecalRotationOffset;
+
+	/** 발소리에 Gender 파라미터로 전달할 값입니다. INDEX_NONE일 경우 전달하지 않습니다. */
+	int32 Gender;
+
+	/** true일 경우 SurfaceCacheSubsystem에 저장한 표면이 있으면 Trace를 생략하고, Trace의 결과를 저장합니다. */
+	bool bUseSurfaceCache;
+
+	/** 디버그 실행을 나타내는 변수입니다. */
+	bool bDebug;
+};
+
+/**
+ * 비동기 Trace가 완료된 발걸음을 나타내는 구조체입니다.
+ */
+struct FPRFootstepTraceResult
+{
+public:
+	FPRFootstepTraceResult()
+		: RequestIndex(INDEX_NONE)
+		, bIsHit(false)
+		, HitResult()
+	{}
+
+	FPRFootstepTraceResult(int32 NewRequestIndex, bool bNewIsHit, const FHitResult& NewHitResult)
+		: RequestIndex(NewRequestIndex)
+		, bIsHit(bNewIsHit)
+		, HitResult(NewHitResult)
+	{}
+
+public:
+	/** Trace 중인 요청의 Index입니다. */
+	int32 RequestIndex;
+
+	/** 바닥에 닿았는지 나타내는 변수입니다. */
+	bool bIsHit;
+
+	/** Trace의 결과입니다. */
+	FHitResult HitResult;
+};
+
+/**
+ * 발걸음의 처리 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRFootstepStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRFootstepStats()
+		: RequestedCount(0)
+		, TracedCount(0)
+		, SkippedTraceCount(0)
+		, CachedCount(0)
+		, DroppedCount(0)
+		, CompletedCount(0)
+	{}
+
+public:
+	/** 요청한 발걸음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 RequestedCount;
+
+	/** 비동기 Trace를 실행한 발걸음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 TracedCount;
+
+	/** 렌더링되지 않은 캐릭터라서 Trace 없이 처리한 발걸음의 수입니다. 바닥 위에 있지 않아 재생하지 않은 발걸음도 포함합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 SkippedTraceCount;
+
+	/** SurfaceCacheSubsystem에 저장한 표면으로 Trace 없이 처리한 발걸음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 CachedCount;
+
+	/** 한 Tick의 최대 Trace 수를 초과하여 처리하지 않은 발걸음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 DroppedCount;
+
+	/** Trace가 완료되어 발소리와 데칼을 실행한 발걸음의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepStats")
+	int32 CompletedCount;
+};
+
+/**
+ * 발걸음 AnimNotify의 바닥 탐색을 비동기 Trace로 모아 실행하는 WorldSubsystem 클래스입니다.
+ * 한 프레임의 요청을 Tick에서 한 번에 비동기 Trace로 실행하고, 완료된 결과를 다음 Tick에서 모아 발소리와 발자국 데칼을 실행합니다.
+ * SurfaceCacheSubsystem에 같은 위치의 표면이 저장되어 있으면 Trace를 생략하고, 렌더링되지 않은 캐릭터는 Trace를 생략하고 기본 표면으로 발소리만 재생합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRFootstepSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRFootstepSubsystem();
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 발걸음을 요청하는 함수입니다. 바닥의 탐색은 다음 Tick에 비동기 Trace로 실행합니다.
+	 *
+	 * @param FootstepRequest 요청할 발걸음입니다.
+	 * @param bSkipTraceWhenNotRendered true일 경우 렌더링되지 않은 캐릭터는 Trace를 생략하고 CharacterMovement가 바닥 위에 있을 때만 발소리를 재생합니다.
+	 */
+	void RequestFootstep(const FPRFootstepRequest& FootstepRequest, bool bSkipTraceWhenNotRendered = true);
+
+	/** 처리 결과의 집계를 초기화하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRFootstepSubsystem")
+	void ResetFootstepStats();
+
+private:
+	/** 이번 프레임에 모은 요청을 비동기 Trace로 실행하는 함수입니다. */
+	void StartFootstepTraces();
+
+	/** 완료된 비동기 Trace의 결과로 발소리와 발자국 데칼을 실행하는 함수입니다. */
+	void ProcessCompletedFootsteps();
+
+	/**
+	 * 비동기 Trace가 완료되었을 때 실행하는 함수입니다. 결과는 Tick에서 모아 처리합니다.
+	 *
+	 * @param TraceHandle 완료된 Trace의 Handle입니다.
+	 * @param TraceDatum 완료된 Trace의 결과입니다.
+	 */
+	void OnFootstepTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	/**
+	 * 발소리와 발자국 데칼을 실행하는 함수입니다.
+	 *
+	 * @param FootstepRequest 실행할 발걸음입니다.
+	 * @param bIsHit 바닥에 닿았는지 여부입니다. false일 경우 Trace를 생략한 발걸음으로 기본 표면의 발소리만 재생합니다.
+	 * @param HitResult Trace의 결과입니다.
+	 * @param SurfaceType 바닥의 표면 타입입니다.
+	 */
+	void ExecuteFootstep(const FPRFootstepRequest& FootstepRequest, bool bIsHit, const FHitResult& HitResult, EPhysicalSurface SurfaceType) const;
+
+private:
+	/** 다음 Tick에 Trace를 실행할 요청입니다. */
+	TArray<FPRFootstepRequest> QueuedFootstepRequests;
+
+	/** 비동기 Trace 중인 요청입니다. Index를 Trace의 UserData로 전달합니다. */
+	TSparseArray<FPRFootstepRequest> PendingFootstepRequests;
+
+	/** 완료되어 다음 Tick에 처리할 Trace의 결과입니다. */
+	TArray<FPRFootstepTraceResult> CompletedFootstepTraces;
+
+	/** 비동기 Trace가 완료되었을 때 실행하는 델리게이트입니다. */
+	FTraceDelegate FootstepTraceDelegate;
+
+	/** 처리 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRFootstepSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRFootstepStats FootstepStats;
+
+	/** 한 Tick에 실행할 수 있는 최대 Trace의 수입니다. 초과한 요청은 버립니다. */
+	int32 MaxTracesPerTick;
+
+	/** 이 시간(초) 안에 렌더링되지 않은 캐릭터는 렌더링되지 않은 것으로 판단합니다. */
+	float RecentlyRenderedTolerance;
+
+public:
+	/** FootstepStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRFootstepStats& GetFootstepStats() const { return FootstepStats; }
+};
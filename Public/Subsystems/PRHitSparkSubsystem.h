@@ -0,0 +1,115 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PRHitSparkSubsystem.generated.h"
+
+class UNiagaraSystem;
+class UNiagaraComponent;
+
+/**
+ * 하나의 히트 스파크 NiagaraSystem에 한 프레임 동안 모은 히트 정보를 나타내는 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRHitSparkBatch
+{
+	GENERATED_BODY()
+
+public:
+	FPRHitSparkBatch()
+		: NiagaraComponent(nullptr)
+		, HitPositions()
+		, HitNormals()
+		, HitColors()
+		, bHasSubmittedHits(false)
+	{}
+
+public:
+	/** 월드에 하나만 유지하는 히트 스파크 NiagaraComponent입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRHitSparkBatch")
+	TObjectPtr<UNiagaraComponent> NiagaraComponent;
+
+	/** 이번 프레임에 모은 히트 위치입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRHitSparkBatch")
+	TArray<FVector> HitPositions;
+
+	/** 이번 프레임에 모은 히트 표면의 노멀입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRHitSparkBatch")
+	TArray<FVector> HitNormals;
+
+	/** 이번 프레임에 모은 히트의 속성 색상입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRHitSparkBatch")
+	TArray<FLinearColor> HitColors;
+
+	/** 이전 프레임에 히트 정보를 전달했는지 나타내는 변수입니다. 다음 프레임에 배열을 비우기 위해 사용합니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRHitSparkBatch")
+	bool bHasSubmittedHits;
+};
+
+/**
+ * 히트 스파크를 NiagaraSystem별로 월드에 하나의 NiagaraComponent로 모아 렌더링하는 WorldSubsystem 클래스입니다.
+ * 한 프레임 동안 모은 히트의 위치, 노멀, 색상을 배열 DataInterface로 전달하므로 히트 수와 관계없이 NiagaraSystem 인스턴스는 하나만 갱신됩니다.
+ * NiagaraSystem은 User 파라미터의 Position, Vector, Color 배열을 읽어 배열의 원소마다 파티클을 Spawn해야 합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRHitSparkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRHitSparkSubsystem();
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/**
+	 * 이번 프레임에 렌더링할 히트 스파크를 추가하는 함수입니다.
+	 *
+	 * @param HitSparkSystem 히트 정보를 배열로 읽는 히트 스파크 NiagaraSystem입니다.
+	 * @param Location 히트 위치입니다.
+	 * @param Normal 히트 표면의 노멀입니다.
+	 * @param Color 히트 스파크의 색상입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRHitSparkSubsystem")
+	void AddHitSpark(UNiagaraSystem* HitSparkSystem, const FVector& Location, const FVector& Normal, const FLinearColor& Color);
+
+private:
+	/**
+	 * 주어진 NiagaraSystem의 NiagaraComponent를 반환하는 함수입니다. 없을 경우 월드에 생성합니다.
+	 *
+	 * @param HitSparkSystem NiagaraComponent를 가져올 NiagaraSystem입니다.
+	 * @param HitSparkBatch NiagaraComponent를 보관하는 히트 정보입니다.
+	 * @return NiagaraSystem의 NiagaraComponent입니다.
+	 */
+	UNiagaraComponent* GetOrCreateHitSparkComponent(UNiagaraSystem* HitSparkSystem, FPRHitSparkBatch& HitSparkBatch);
+
+	/**
+	 * 모은 히트 정보를 NiagaraComponent의 배열 파라미터에 전달하는 함수입니다.
+	 *
+	 * @param NiagaraComponent 히트 정보를 전달할 NiagaraComponent입니다.
+	 * @param HitSparkBatch 전달할 히트 정보입니다.
+	 */
+	void SubmitHitSparkBatch(UNiagaraComponent* NiagaraComponent, const FPRHitSparkBatch& HitSparkBatch) const;
+
+private:
+	/** NiagaraSystem별로 이번 프레임에 모은 히트 정보입니다. */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UNiagaraSystem>, FPRHitSparkBatch> HitSparkBatches;
+
+	/** 한 프레임에 NiagaraSystem 하나가 받을 수 있는 최대 히트 수입니다. 초과한 히트는 버립니다. */
+	int32 MaxHitSparksPerFrame;
+
+	/** 히트 위치 배열을 전달할 User 파라미터의 이름입니다. */
+	FName HitPositionsParameterName;
+
+	/** 히트 노멀 배열을 전달할 User 파라미터의 이름입니다. */
+	FName HitNormalsParameterName;
+
+	/** 히트 색상 배열을 전달할 User 파라미터의 이름입니다. */
+	FName HitColorsParameterName;
+};
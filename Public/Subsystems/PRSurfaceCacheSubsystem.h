@@ -0,0 +1,270 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "ProjectReplica.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "PRSurfaceCacheSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 격자의 한 칸에 저장한 바닥의 표면 정보를 나타내는 구조체입니다.
+ */
+struct FPRSurfaceCacheEntry
+{
+public:
+	FPRSurfaceCacheEntry()
+		: SurfaceType(SurfaceType_Default)
+		, GroundHeight(0.0f)
+		, ImpactNormal(FVector::UpVector)
+		, HitComponent(nullptr)
+		, HitComponentTransform(FTransform::Identity)
+		, CachedTime(0.0f)
+	{}
+
+public:
+	/** 바닥의 표면 타입입니다. */
+	TEnumAsByte<EPhysicalSurface> SurfaceType;
+
+	/** 바닥의 높이입니다. */
+	float GroundHeight;
+
+	/** 바닥의 노멀입니다. */
+	FVector ImpactNormal;
+
+	/** 바닥의 PrimitiveComponent입니다. */
+	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
+
+	/** 저장할 때 바닥의 PrimitiveComponent의 Transform입니다. 달라졌을 경우 바닥이 움직인 것으로 판단합니다. */
+	FTransform HitComponentTransform;
+
+	/** 저장한 월드 시간입니다. */
+	float CachedTime;
+};
+
+/**
+ * 표면 캐시에 등록한 움직이는 충돌의 추적 정보를 나타내는 구조체입니다.
+ */
+struct FPRMovingCollisionRegistration
+{
+public:
+	FPRMovingCollisionRegistration()
+		: TransformUpdatedHandle()
+		, LastBounds(ForceInit)
+	{}
+
+public:
+	/** Transform이 갱신될 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle TransformUpdatedHandle;
+
+	/** 마지막으로 칸을 제거한 충돌의 영역입니다. 움직인 뒤 이전 영역의 칸도 제거하기 위해 사용합니다. */
+	FBox LastBounds;
+};
+
+/**
+ * 표면 캐시의 사용 결과를 집계한 구조체입니다.
+ */
+USTRUCT(Atomic, BlueprintType)
+struct FPRSurfaceCacheStats
+{
+	GENERATED_BODY()
+
+public:
+	FPRSurfaceCacheStats()
+		: HitCount(0)
+		, MissCount(0)
+		, InvalidatedCount(0)
+		, CachedCellCount(0)
+	{}
+
+public:
+	/** 캐시에서 표면을 찾은 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSurfaceCacheStats")
+	int32 HitCount;
+
+	/** 캐시에서 표면을 찾지 못한 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSurfaceCacheStats")
+	int32 MissCount;
+
+	/** 바닥이 움직이거나 오래되어 제거한 칸의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSurfaceCacheStats")
+	int32 InvalidatedCount;
+
+	/** 저장한 칸의 수입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSurfaceCacheStats")
+	int32 CachedCellCount;
+};
+
+/**
+ * 발걸음의 바닥 탐색 결과를 XY 위치와 높이 구간으로 양자화한 희소 격자에 저장하는 WorldSubsystem 클래스입니다.
+ * 같은 바닥을 걷는 캐릭터들이 발걸음마다 바닥을 다시 탐색하지 않도록 표면 타입을 재사용합니다.
+ * 레벨이 스트리밍되면 캐시를 비우고, 바닥의 PrimitiveComponent가 제거된 칸은 찾을 때 제거합니다.
+ * Static이 아닌 바닥은 Transform이 갱신될 때 해당 바닥의 칸과 이동한 위치의 칸을 제거합니다.
+ * 저장한 바닥이 아닌 충돌은 RegisterMovingCollisionComponent로 등록하면 움직일 때마다 이전 영역과 이동한 영역의 칸을 제거합니다.
+ */
+UCLASS()
+class PROJECTREPLICA_API UPRSurfaceCacheSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPRSurfaceCacheSubsystem();
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+public:
+	/**
+	 * 주어진 위치의 칸에 저장한 표면을 찾는 함수입니다.
+	 *
+	 * @param TraceStart 바닥을 탐색하는 시작 위치입니다.
+	 * @param OutEntry 찾은 표면입니다.
+	 * @return 유효한 표면을 찾았을 경우 true를 반환합니다.
+	 */
+	bool FindSurface(const FVector& TraceStart, FPRSurfaceCacheEntry& OutEntry);
+
+	/**
+	 * 바닥 탐색의 결과를 주어진 위치의 칸에 저장하는 함수입니다.
+	 *
+	 * @param TraceStart 바닥을 탐색한 시작 위치입니다.
+	 * @param HitResult 바닥 탐색의 결과입니다.
+	 * @param SurfaceType 바닥의 표면 타입입니다.
+	 */
+	void AddSurface(const FVector& TraceStart, const FHitResult& HitResult, EPhysicalSurface SurfaceType);
+
+	/**
+	 * 주어진 영역과 겹치는 칸을 제거하는 함수입니다.
+	 * 저장한 바닥과 등록한 충돌이 움직인 경우는 자동으로 제거하므로, 등록하지 않은 충돌을 가진 액터를 바닥 위로 옮겼을 때 사용합니다.
+	 *
+	 * @param Bounds 제거할 영역입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSurfaceCacheSubsystem")
+	void InvalidateSurfaceCacheInBounds(const FBox& Bounds);
+
+	/**
+	 * 주어진 충돌이 움직일 때마다 이전 영역과 이동한 영역의 칸을 제거하도록 등록하는 함수입니다.
+	 * 문이나 엘리베이터, 밀 수 있는 오브젝트처럼 바닥 위로 움직이는 충돌에 사용합니다.
+	 * 등록은 캐시를 비워도 유지하며 UnregisterMovingCollisionComponent를 호출하거나 서브시스템이 해제될 때까지 유지합니다.
+	 *
+	 * @param CollisionComponent 등록할 충돌의 PrimitiveComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSurfaceCacheSubsystem")
+	void RegisterMovingCollisionComponent(UPrimitiveComponent* CollisionComponent);
+
+	/**
+	 * 등록한 충돌의 추적을 중단하는 함수입니다.
+	 *
+	 * @param CollisionComponent 등록을 해제할 충돌의 PrimitiveComponent입니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "PRSurfaceCacheSubsystem")
+	void UnregisterMovingCollisionComponent(UPrimitiveComponent* CollisionComponent);
+
+	/** 저장한 모든 칸을 제거하는 함수입니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRSurfaceCacheSubsystem")
+	void ClearSurfaceCache();
+
+	/** 사용 결과의 집계를 초기화하는 함수입니다. CachedCellCount는 유지합니다. */
+	UFUNCTION(BlueprintCallable, Category = "PRSurfaceCacheSubsystem")
+	void ResetSurfaceCacheStats();
+
+private:
+	/**
+	 * 주어진 위치를 격자의 칸으로 양자화하는 함수입니다.
+	 *
+	 * @param Location 양자화할 위치입니다.
+	 * @return 격자의 칸입니다.
+	 */
+	FIntVector GetSurfaceCellKey(const FVector& Location) const;
+
+	/**
+	 * 저장한 칸이 유효한지 확인하는 함수입니다.
+	 *
+	 * @param Entry 확인할 칸입니다.
+	 * @return 바닥이 남아있고 움직이지 않았으며 수명이 지나지 않았을 경우 true를 반환합니다.
+	 */
+	bool IsValidSurfaceEntry(const FPRSurfaceCacheEntry& Entry) const;
+
+	/**
+	 * 레벨이 월드에 추가되거나 제거되었을 때 실행하는 함수입니다.
+	 *
+	 * @param Level 추가되거나 제거된 레벨입니다.
+	 * @param World 레벨의 월드입니다.
+	 */
+	void OnLevelStreamingChanged(ULevel* Level, UWorld* World);
+
+	/** 저장한 칸의 수를 집계와 통계에 반영하는 함수입니다. */
+	void UpdateCachedCellCount();
+
+	/**
+	 * 주어진 Static이 아닌 바닥의 Transform이 갱신될 때 칸을 제거하도록 델리게이트를 바인딩하는 함수입니다.
+	 *
+	 * @param SurfaceComponent 추적할 바닥의 PrimitiveComponent입니다.
+	 */
+	void TrackMovableSurfaceComponent(UPrimitiveComponent* SurfaceComponent);
+
+	/** 추적 중인 모든 바닥의 델리게이트를 해제하는 함수입니다. */
+	void UntrackAllMovableSurfaceComponents();
+
+	/**
+	 * 추적 중인 바닥의 Transform이 갱신되었을 때 실행하는 함수입니다.
+	 * 바닥을 저장한 칸과 이동한 바닥의 영역과 겹치는 칸을 제거하고 추적을 중단합니다.
+	 *
+	 * @param UpdatedComponent Transform이 갱신된 바닥의 Component입니다.
+	 * @param UpdateTransformFlags Transform 갱신의 플래그입니다.
+	 * @param Teleport 순간이동 여부입니다.
+	 */
+	void OnSurfaceComponentTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** 등록한 모든 충돌의 델리게이트를 해제하는 함수입니다. */
+	void UnregisterAllMovingCollisionComponents();
+
+	/**
+	 * 등록한 충돌의 Transform이 갱신되었을 때 실행하는 함수입니다.
+	 * 움직이기 전의 영역과 이동한 영역과 겹치는 칸을 제거합니다.
+	 *
+	 * @param UpdatedComponent Transform이 갱신된 충돌의 Component입니다.
+	 * @param UpdateTransformFlags Transform 갱신의 플래그입니다.
+	 * @param Teleport 순간이동 여부입니다.
+	 */
+	void OnMovingCollisionTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+private:
+	/** 양자화한 위치를 키로 저장한 바닥의 표면입니다. */
+	TMap<FIntVector, FPRSurfaceCacheEntry> SurfaceCells;
+
+	/** Transform의 갱신을 추적 중인 Static이 아닌 바닥과 델리게이트의 Handle입니다. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FDelegateHandle> TrackedMovableSurfaceComponents;
+
+	/** 움직일 때마다 칸을 제거하도록 등록한 충돌과 추적 정보입니다. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FPRMovingCollisionRegistration> MovingCollisionComponents;
+
+	/** 사용 결과의 집계입니다. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "PRSurfaceCacheSubsystem", meta = (AllowPrivateAccess = "true"))
+	FPRSurfaceCacheStats SurfaceCacheStats;
+
+	/** 격자 한 칸의 XY 크기입니다. */
+	float CellSize;
+
+	/** 격자 한 칸의 높이 구간입니다. */
+	float HeightBandSize;
+
+	/** 저장한 칸의 수명입니다. 바닥 위에 새로 생긴 액터를 반영하기 위해 수명이 지난 칸은 다시 탐색합니다. */
+	float EntryLifespan;
+
+	/** 저장할 수 있는 칸의 최대 수입니다. 초과할 경우 캐시를 비웁니다. */
+	int32 MaxCachedCells;
+
+	/** 레벨이 월드에 추가되었을 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle LevelAddedHandle;
+
+	/** 레벨이 월드에서 제거되었을 때 실행하는 델리게이트의 Handle입니다. */
+	FDelegateHandle LevelRemovedHandle;
+
+public:
+	/** SurfaceCacheStats를 반환하는 함수입니다. */
+	FORCEINLINE const FPRSurfaceCacheStats& GetSurfaceCacheStats() const { return SurfaceCacheStats; }
+};
@@ -4,6 +4,7 @@
 
 #include "ProjectReplica.h"
 #include "GameFramework/Actor.h"
+#include "Effects/PRNiagaraParameterBlock.h"
 #include "PRBaseWeapon.generated.h"
 
 class APRBaseCharacter;
@@ -117,6 +118,18 @@ protected:
 	/** SpawnNiagaraEffect의 사용자 파라미터인 EffectColor의 이름입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRBaseWeapon|SpawnEffect")
 	FName EffectColorVariableName;
+
+	/** 메인 무기의 Spawn 이펙트에 적용할 사용자 파라미터입니다. BeginPlay에서 한 번 설정합니다. */
+	UPROPERTY(Transient)
+	FPRNiagaraParameterBlock MainWeaponSpawnEffectParameters;
+
+	/** 메인 무기를 집어넣을 때의 Spawn 이펙트에 적용할 사용자 파라미터입니다. WeaponMesh에 StaticMesh를 전달합니다. BeginPlay에서 한 번 설정합니다. */
+	UPROPERTY(Transient)
+	FPRNiagaraParameterBlock MainWeaponSheatheEffectParameters;
+
+public:
+	/** SpawnNiagaraEffect를 반환하는 함수입니다. */
+	FORCEINLINE UNiagaraSystem* GetSpawnNiagaraEffect() const { return SpawnNiagaraEffect; }
 #pragma endregion 
 
 #pragma region MainWeapon
@@ -16,6 +16,9 @@ class PROJECTREPLICA_API APRDualMeleeWeapon : public APRMeleeWeapon
 
 public:
 	APRDualMeleeWeapon();
+
+protected:
+	virtual void BeginPlay() override;
 	
 public:
 	/**
@@ -66,5 +69,9 @@ protected:
 	/** 서브 무기의 납도 회전 값 Offset입니다. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PRBaseWeapon|SubWeapon")
 	FRotator SubWeaponSheatheRotationOffset;
+
+	/** 서브 무기의 Spawn 이펙트에 적용할 사용자 파라미터입니다. BeginPlay에서 한 번 설정합니다. */
+	UPROPERTY(Transient)
+	FPRNiagaraParameterBlock SubWeaponSpawnEffectParameters;
 #pragma endregion 
 };